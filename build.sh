@@ -30,12 +30,16 @@ case "$1" in
         echo "Cleaning build files..."
         $PIO run --target clean
         ;;
+    "host")
+        echo "Building native host binary..."
+        cmake -S host -B build-host && cmake --build build-host -j"$(nproc)"
+        ;;
     "all")
         echo "Building, uploading, and monitoring..."
         $PIO run --target upload && $PIO device monitor
         ;;
     *)
-        echo "Usage: $0 {build|upload|monitor|clean|all}"
+        echo "Usage: $0 {build|upload|monitor|clean|all|host}"
         echo ""
         echo "Commands:"
         echo "  build    - Compile the project"
@@ -43,6 +47,7 @@ case "$1" in
         echo "  monitor  - Open serial monitor"
         echo "  clean    - Clean build files"
         echo "  all      - Build, upload, and monitor"
+        echo "  host     - Compile the firmware for Linux (build-host/subghz_host)"
         exit 1
         ;;
 esac
@@ -0,0 +1,272 @@
+// Runner for the benchmarks registered with BENCHMARK() (see bench.h)
+
+#include "bench.h"
+
+#include <regex>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_DEFAULT_MIN_TIME 0.5    // Seconds per benchmark/argument pair
+#define BENCH_MAX_ITERATIONS   1000000000ULL
+
+static uint64_t clockNs(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+BenchState::BenchState(const std::vector<int64_t>& args, uint64_t iterations) : args(args) {
+    maxIterations = iterations;
+    realNs = 0;
+    cpuNs = 0;
+    itemsProcessed = 0;
+    bytesProcessed = 0;
+    running = false;
+    realStart = 0;
+    cpuStart = 0;
+}
+
+void BenchState::start() {
+    running = true;
+    realStart = clockNs(CLOCK_MONOTONIC);
+    cpuStart = clockNs(CLOCK_THREAD_CPUTIME_ID);
+}
+
+void BenchState::stop() {
+    if (!running) return;
+    realNs += clockNs(CLOCK_MONOTONIC) - realStart;
+    cpuNs += clockNs(CLOCK_THREAD_CPUTIME_ID) - cpuStart;
+    running = false;
+}
+
+void BenchState::pauseTiming() {
+    stop();
+}
+
+void BenchState::resumeTiming() {
+    start();
+}
+
+void BenchState::counter(const char* name, double value) {
+    for (size_t i = 0; i < counterNames.size(); i++) {
+        if (strcmp(counterNames[i], name) == 0) {
+            counterValues[i] = value;
+            return;
+        }
+    }
+    counterNames.push_back(name);
+    counterValues.push_back(value);
+}
+
+BenchState::Iterator BenchState::begin() {
+    start();
+    return Iterator{this, maxIterations};
+}
+
+bool BenchState::Iterator::operator!=(const Iterator&) const {
+    if (left != 0) return true;
+    state->stop();
+    return false;
+}
+
+Benchmark::Benchmark(const char* name, BenchFunction fn) {
+    this->name = name;
+    this->fn = fn;
+}
+
+Benchmark* Benchmark::Arg(int64_t arg) {
+    argSets.push_back({arg});
+    return this;
+}
+
+Benchmark* Benchmark::Args(const std::vector<int64_t>& args) {
+    argSets.push_back(args);
+    return this;
+}
+
+static std::vector<Benchmark*>& registry() {
+    static std::vector<Benchmark*> benchmarks;
+    return benchmarks;
+}
+
+Benchmark* registerBenchmark(const char* name, BenchFunction fn) {
+    Benchmark* bench = new Benchmark(name, fn);
+    registry().push_back(bench);
+    return bench;
+}
+
+struct BenchResult {
+    std::string name;
+    uint64_t iterations;
+    double realNs;      // Per iteration
+    double cpuNs;
+    double itemsPerSecond;
+    double bytesPerSecond;
+    std::vector<const char*> counterNames;
+    std::vector<double> counterValues;
+};
+
+static std::string runName(const Benchmark* bench, const std::vector<int64_t>& args) {
+    std::string name = bench->name;
+    for (int64_t arg : args) {
+        name += "/" + std::to_string(arg);
+    }
+    return name;
+}
+
+// Grows the iteration count until one run lasts minTime, like Google Benchmark
+static BenchResult runOne(const Benchmark* bench, const std::vector<int64_t>& args, double minTime) {
+    uint64_t iterations = 1;
+    while (true) {
+        BenchState state(args, iterations);
+        bench->fn(state);
+
+        double seconds = state.realNs / 1e9;
+        if (seconds >= minTime || iterations >= BENCH_MAX_ITERATIONS) {
+            BenchResult result;
+            result.name = runName(bench, args);
+            result.iterations = iterations;
+            result.realNs = state.realNs / iterations;
+            result.cpuNs = state.cpuNs / iterations;
+            result.itemsPerSecond = seconds > 0 ? state.itemsProcessed / seconds : 0;
+            result.bytesPerSecond = seconds > 0 ? state.bytesProcessed / seconds : 0;
+            result.counterNames = state.counterNames;
+            result.counterValues = state.counterValues;
+            return result;
+        }
+
+        // Aim 40% past the target, growing at most 10x per attempt
+        double scale = seconds > 0 ? minTime * 1.4 / seconds : 10.0;
+        if (scale > 10.0) scale = 10.0;
+        uint64_t next = (uint64_t)(iterations * scale);
+        iterations = next > iterations ? next : iterations + 1;
+        if (iterations > BENCH_MAX_ITERATIONS) iterations = BENCH_MAX_ITERATIONS;
+    }
+}
+
+static void printConsole(const BenchResult& result) {
+    printf("%-40s %12.0f ns %12.0f ns %10llu", result.name.c_str(), result.realNs, result.cpuNs,
+           (unsigned long long)result.iterations);
+    if (result.itemsPerSecond > 0) printf("  items/s=%.4g", result.itemsPerSecond);
+    if (result.bytesPerSecond > 0) printf("  bytes/s=%.4g", result.bytesPerSecond);
+    for (size_t i = 0; i < result.counterNames.size(); i++) {
+        printf("  %s=%.4g", result.counterNames[i], result.counterValues[i]);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+static void writeJson(FILE* out, const std::vector<BenchResult>& results, const char* executable) {
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+    char host[64] = "";
+    gethostname(host, sizeof(host) - 1);
+
+    fprintf(out, "{\n  \"context\": {\n");
+    fprintf(out, "    \"date\": \"%s\",\n", date);
+    fprintf(out, "    \"host_name\": \"%s\",\n", host);
+    fprintf(out, "    \"executable\": \"%s\",\n", executable);
+    fprintf(out, "    \"num_cpus\": %ld,\n", sysconf(_SC_NPROCESSORS_ONLN));
+#ifdef NDEBUG
+    fprintf(out, "    \"library_build_type\": \"release\"\n");
+#else
+    fprintf(out, "    \"library_build_type\": \"debug\"\n");
+#endif
+    fprintf(out, "  },\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        fprintf(out, "    {\n");
+        fprintf(out, "      \"name\": \"%s\",\n", r.name.c_str());
+        fprintf(out, "      \"run_name\": \"%s\",\n", r.name.c_str());
+        fprintf(out, "      \"run_type\": \"iteration\",\n");
+        fprintf(out, "      \"iterations\": %llu,\n", (unsigned long long)r.iterations);
+        fprintf(out, "      \"real_time\": %.3f,\n", r.realNs);
+        fprintf(out, "      \"cpu_time\": %.3f,\n", r.cpuNs);
+        fprintf(out, "      \"time_unit\": \"ns\"");
+        if (r.itemsPerSecond > 0) fprintf(out, ",\n      \"items_per_second\": %.6g", r.itemsPerSecond);
+        if (r.bytesPerSecond > 0) fprintf(out, ",\n      \"bytes_per_second\": %.6g", r.bytesPerSecond);
+        for (size_t c = 0; c < r.counterNames.size(); c++) {
+            fprintf(out, ",\n      \"%s\": %.6g", r.counterNames[c], r.counterValues[c]);
+        }
+        fprintf(out, "\n    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+static const char* flagValue(const char* arg, const char* flag) {
+    size_t len = strlen(flag);
+    if (strncmp(arg, flag, len) == 0 && arg[len] == '=') return arg + len + 1;
+    return nullptr;
+}
+
+int main(int argc, char** argv) {
+    const char* filter = nullptr;
+    const char* outPath = nullptr;
+    bool jsonToStdout = false;
+    double minTime = BENCH_DEFAULT_MIN_TIME;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* value;
+        if ((value = flagValue(argv[i], "--benchmark_filter")) != nullptr) {
+            filter = value;
+        } else if ((value = flagValue(argv[i], "--benchmark_min_time")) != nullptr) {
+            minTime = atof(value);
+        } else if ((value = flagValue(argv[i], "--benchmark_out")) != nullptr) {
+            outPath = value;
+        } else if ((value = flagValue(argv[i], "--benchmark_format")) != nullptr) {
+            jsonToStdout = strcmp(value, "json") == 0;
+        } else if (strcmp(argv[i], "--benchmark_list_tests") == 0) {
+            list = true;
+        } else {
+            fprintf(stderr, "usage: %s [--benchmark_filter=<regex>] [--benchmark_min_time=<s>]\n"
+                            "          [--benchmark_out=<file>] [--benchmark_format=console|json]\n"
+                            "          [--benchmark_list_tests]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::regex pattern;
+    try {
+        pattern = std::regex(filter != nullptr ? filter : ".");
+    } catch (const std::regex_error&) {
+        fprintf(stderr, "bad --benchmark_filter: %s\n", filter);
+        return 2;
+    }
+
+    std::vector<BenchResult> results;
+    if (!jsonToStdout && !list) {
+        printf("%-40s %15s %15s %10s\n", "Benchmark", "Time", "CPU", "Iterations");
+    }
+    for (Benchmark* bench : registry()) {
+        std::vector<std::vector<int64_t>> argSets = bench->argSets;
+        if (argSets.empty()) argSets.push_back({});
+        for (const std::vector<int64_t>& args : argSets) {
+            std::string name = runName(bench, args);
+            if (!std::regex_search(name, pattern)) continue;
+            if (list) {
+                printf("%s\n", name.c_str());
+                continue;
+            }
+            results.push_back(runOne(bench, args, minTime));
+            if (!jsonToStdout) printConsole(results.back());
+        }
+    }
+
+    if (jsonToStdout) writeJson(stdout, results, argv[0]);
+    if (outPath != nullptr) {
+        FILE* out = fopen(outPath, "w");
+        if (out == nullptr) {
+            perror(outPath);
+            return 1;
+        }
+        writeJson(out, results, argv[0]);
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+// Minimal Google Benchmark-style harness for host microbenchmarks.
+//
+//   static void BM_Thing(BenchState& state) {
+//       setup(state.range(0));
+//       for (auto _ : state) thing();
+//       state.setItemsProcessed(state.iterations() * state.range(0));
+//   }
+//   BENCHMARK(BM_Thing)->Arg(64)->Arg(512);
+//
+// Each benchmark/argument pair runs for at least --benchmark_min_time
+// seconds. Results go to the console, and to JSON in the same schema as
+// Google Benchmark (--benchmark_out=<file> or --benchmark_format=json), so
+// tools/bench_compare.py can diff two runs.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+class BenchState {
+public:
+    BenchState(const std::vector<int64_t>& args, uint64_t iterations);
+
+    int64_t range(size_t i = 0) const { return i < args.size() ? args[i] : 0; }
+    uint64_t iterations() const { return maxIterations; }
+
+    // Time spent paused is excluded from both real and CPU time
+    void pauseTiming();
+    void resumeTiming();
+
+    void setItemsProcessed(int64_t items) { itemsProcessed = items; }
+    void setBytesProcessed(int64_t bytes) { bytesProcessed = bytes; }
+    // Extra per-run value reported as-is (e.g. overhead per edge)
+    void counter(const char* name, double value);
+
+    // What the loop variable holds: nothing, but of class type, so an
+    // unused "_" is not warned about (as in Google Benchmark)
+    struct [[maybe_unused]] Value {};
+    struct Iterator {
+        BenchState* state;
+        uint64_t left;
+        bool operator!=(const Iterator& end) const;
+        void operator++() { left--; }
+        Value operator*() const { return Value(); }
+    };
+    Iterator begin();
+    Iterator end() { return Iterator{this, 0}; }
+
+    // Filled in by the runner
+    double realNs;
+    double cpuNs;
+    int64_t itemsProcessed;
+    int64_t bytesProcessed;
+    std::vector<const char*> counterNames;
+    std::vector<double> counterValues;
+
+private:
+    std::vector<int64_t> args;
+    uint64_t maxIterations;
+    bool running;
+    uint64_t realStart;
+    uint64_t cpuStart;
+
+    void start();
+    void stop();
+};
+
+typedef void (*BenchFunction)(BenchState& state);
+
+class Benchmark {
+public:
+    Benchmark(const char* name, BenchFunction fn);
+    Benchmark* Arg(int64_t arg);
+    Benchmark* Args(const std::vector<int64_t>& args);
+
+    const char* name;
+    BenchFunction fn;
+    std::vector<std::vector<int64_t>> argSets;
+};
+
+Benchmark* registerBenchmark(const char* name, BenchFunction fn);
+
+#define BENCH_CONCAT2(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT2(a, b)
+#define BENCHMARK(fn) \
+    static Benchmark* BENCH_CONCAT(benchRegistration, __LINE__) __attribute__((unused)) = \
+        registerBenchmark(#fn, fn)
+
+// Keeps the optimizer from discarding a result
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif
@@ -0,0 +1,200 @@
+// Microbenchmarks for the firmware's hot paths: the spectrum and RSSI
+// waveform redraws, the TV-B-Gone code decoder, the capture/replay
+// timing loops, and the games' simulation ticks. Run with
+// --benchmark_out=<file> and diff two runs with tools/bench_compare.py.
+
+#include "bench.h"
+
+#include <M5StickCPlus.h>
+#include "cc1101_interface.h"
+#include "menu_system.h"
+#include "subghz_operations.h"
+#include "host_probe.h"
+#include "WORLD_IR_CODES.h"
+#include "games.h"
+#include "game_autopilot.h"
+
+// TV-B-Gone decoder state (subghz_operations.cpp)
+uint8_t read_bits(uint8_t count);
+extern uint8_t bitsleft_r;
+extern uint8_t code_ptr;
+extern volatile const IrCode* powerCode;
+
+static CC1101Interface radio;
+static MenuSystem menu;
+static SubGhzOperations operations(&radio, &menu);
+static Games games;
+
+// strong of the bins are above the red threshold, the rest at the floor
+static void fillSpectrum(int strong) {
+    int* spectrum = HostProbe::spectrumData(operations);
+    for (int i = 0; i < SPECTRUM_POINTS; i++) {
+        spectrum[i] = i < strong ? -40 : -95 + (i % 7);
+    }
+}
+
+static void fillHistory(int strong) {
+    int* history = HostProbe::rssiHistory(operations);
+    for (int i = 0; i < 120; i++) {
+        history[i] = i < strong ? -45 + (i % 11) : -98 + (i % 5);
+    }
+    HostProbe::historyIndex(operations) = 0;
+}
+
+// Args: bins above the signal threshold (bar height/colour work)
+static void BM_DrawSpectrum(BenchState& state) {
+    fillSpectrum(state.range(0));
+    for (auto _ : state) {
+        HostProbe::drawSpectrum(operations);
+    }
+    state.setItemsProcessed(state.iterations() * SPECTRUM_POINTS);
+}
+BENCHMARK(BM_DrawSpectrum)->Arg(0)->Arg(40)->Arg(120);
+
+// Args: history samples above the signal threshold
+static void BM_DrawRSSIWaveform(BenchState& state) {
+    fillHistory(state.range(0));
+    int& historyIndex = HostProbe::historyIndex(operations);
+    for (auto _ : state) {
+        // Step two samples so every call passes the redraw throttle
+        historyIndex = (historyIndex + 2) % 120;
+        HostProbe::drawRSSIWaveform(operations);
+    }
+    state.setItemsProcessed(state.iterations() * 115);
+}
+BENCHMARK(BM_DrawRSSIWaveform)->Arg(0)->Arg(60)->Arg(120);
+
+// Args: bits per timing index (the codes table uses 2..5), pairs decoded
+static void BM_ReadBits(BenchState& state) {
+    static uint16_t times[64];
+    static uint8_t codes[256];
+    for (size_t i = 0; i < sizeof(codes); i++) {
+        codes[i] = (uint8_t)(i * 37 + 11);
+    }
+    uint8_t bits = state.range(0);
+    uint8_t pairs = state.range(1);
+    IrCode code = {38, pairs, bits, times, codes};
+    uint16_t rawData[2 * 255];
+
+    for (auto _ : state) {
+        powerCode = &code;
+        code_ptr = 0;
+        bitsleft_r = 0;
+        for (uint8_t k = 0; k < pairs; k++) {
+            uint16_t ti = read_bits(bits) * 2;
+            rawData[k * 2] = code.times[ti] * 10;
+            rawData[k * 2 + 1] = code.times[ti + 1] * 10;
+        }
+        doNotOptimize(rawData);
+    }
+    state.setItemsProcessed(state.iterations() * pairs);
+}
+BENCHMARK(BM_ReadBits)->Args({2, 26})->Args({3, 64})->Args({5, 100})->Args({8, 255});
+
+// Decodes the whole North America table, as runTVBGone() does
+static void BM_DecodeAllNACodes(BenchState& state) {
+    uint16_t rawData[300];
+    int64_t pairsDecoded = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < sizeof(NApowerCodes) / sizeof(*NApowerCodes); i++) {
+            powerCode = NApowerCodes[i];
+            const uint8_t numpairs = powerCode->numpairs;
+            const uint8_t bitcompression = powerCode->bitcompression;
+            code_ptr = 0;
+            bitsleft_r = 0;
+            for (uint8_t k = 0; k < numpairs; k++) {
+                uint16_t ti = read_bits(bitcompression) * 2;
+                rawData[k * 2] = powerCode->times[ti] * 10;
+                rawData[k * 2 + 1] = powerCode->times[ti + 1] * 10;
+            }
+            pairsDecoded += numpairs;
+        }
+        doNotOptimize(rawData);
+    }
+    state.setItemsProcessed(pairsDecoded);
+}
+BENCHMARK(BM_DecodeAllNACodes);
+
+// GDO0 toggles on every poll, so each recordSignal() loop pass records an
+// edge and the time per item is the loop's cost per captured sample
+static int toggleEveryRead(uint8_t pin) {
+    static int level = LOW;
+    if (pin != CC1101_GDO0) return LOW;
+    level = !level;
+    return level;
+}
+
+// Args: samples captured per call
+static void BM_RecordSignal(BenchState& state) {
+    int samples = state.range(0);
+    int* timings = new int[samples];
+    hostPinSource = toggleEveryRead;
+    for (auto _ : state) {
+        bool captured = radio.recordSignal(timings, samples);
+        doNotOptimize(captured);
+    }
+    hostPinSource = nullptr;
+    delete[] timings;
+    state.setItemsProcessed(state.iterations() * samples);
+}
+BENCHMARK(BM_RecordSignal)->Arg(64)->Arg(256)->Arg(MAX_RECORDING_SAMPLES);
+
+// Args: samples, pulse width (us). overhead_ns is the time beyond the
+// requested pulse widths, per edge
+static void BM_ReplaySignal(BenchState& state) {
+    int samples = state.range(0);
+    int width = state.range(1);
+    int* timings = new int[samples];
+    for (int i = 0; i < samples; i++) {
+        timings[i] = width;
+    }
+    for (auto _ : state) {
+        radio.replaySignal(timings, samples);
+    }
+    delete[] timings;
+    state.setItemsProcessed(state.iterations() * samples);
+    double idealNs = (double)state.iterations() * samples * width * 1000.0;
+    state.counter("overhead_ns", (state.realNs - idealNs) / ((double)state.iterations() * samples));
+}
+BENCHMARK(BM_ReplaySignal)->Args({64, 10})->Args({MAX_RECORDING_SAMPLES, 10})->Args({MAX_RECORDING_SAMPLES, 100});
+
+// Args: 0 steps the simulation alone, 1 also draws each tick into the host
+// framebuffer through Games' renderers. The autopilot plays; a finished
+// game starts over. Items are ticks, so items_per_second is ticks/s
+template <typename State>
+static void benchGameTicks(BenchState& state, void (*reset)(State*),
+                           void (*step)(State*, const GameInput&),
+                           void (Games::*drawScreen)(const State&),
+                           void (Games::*render)(const State&, const State&)) {
+    bool draw = state.range(0) != 0;
+    GameAutopilot pilot;
+    State game;
+    reset(&game);
+    if (draw) (games.*drawScreen)(game);
+    for (auto _ : state) {
+        if (game.gameOver) {
+            reset(&game);
+            if (draw) (games.*drawScreen)(game);
+        }
+        State prev = game;
+        step(&game, pilot.next(game));
+        if (draw) (games.*render)(prev, game);
+        doNotOptimize(game);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+
+static void BM_DinoTick(BenchState& state) {
+    benchGameTicks(state, dinoReset, dinoStep, &Games::drawDinoScreen, &Games::renderDino);
+}
+BENCHMARK(BM_DinoTick)->Arg(0)->Arg(1);
+
+static void BM_ArkanoidTick(BenchState& state) {
+    benchGameTicks(state, arkanoidReset, arkanoidStep, &Games::drawArkanoidScreen, &Games::renderArkanoid);
+}
+BENCHMARK(BM_ArkanoidTick)->Arg(0)->Arg(1);
+
+static void BM_InvadersTick(BenchState& state) {
+    benchGameTicks(state, invadersReset, invadersStep, &Games::drawInvadersScreen, &Games::renderInvaders);
+}
+BENCHMARK(BM_InvadersTick)->Arg(0)->Arg(1);
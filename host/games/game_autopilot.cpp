@@ -0,0 +1,78 @@
+#include "game_autopilot.h"
+
+#define PILOT_DINO_LEAD  3    // Ticks ahead of the cactus, clears it at any speed
+#define PILOT_SLIP_ODDS  12   // One cactus or paddle return in this many goes wrong
+#define PILOT_FIRE_SLACK 4    // Bullet still hits up to this far off the alien's x
+
+static int16_t tiltFor(int move, int gain) {
+    int tilt = -move * gain;
+    return (int16_t)(tilt < -1000 ? -1000 : (tilt > 1000 ? 1000 : tilt));
+}
+
+GameAutopilot::GameAutopilot(uint32_t seed) {
+    rng = seed ? seed : 1;
+    dinoLead = PILOT_DINO_LEAD;
+    lastCactusX = 0;
+    paddleAim = 0;
+    lastBallVY = 0;
+    alienTarget = -1;
+}
+
+uint32_t GameAutopilot::random() {
+    // xorshift32
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+GameInput GameAutopilot::next(const DinoState& state) {
+    GameInput input = { false, 0 };
+    if (state.cactusX > lastCactusX) {
+        // New cactus: usually time it right, sometimes go far too early
+        dinoLead = random() % PILOT_SLIP_ODDS == 0 ? 8 + random() % 8 : PILOT_DINO_LEAD;
+    }
+    lastCactusX = state.cactusX;
+
+    int gap = state.cactusX - (DINO_X + DINO_SIZE);
+    input.fire = !state.jumping && gap >= 0 && gap <= state.cactusSpeed * dinoLead;
+    return input;
+}
+
+GameInput GameAutopilot::next(const ArkanoidState& state) {
+    if (state.ballVY > 0 && lastBallVY <= 0) {
+        // Ball on its way down: pick which part of the paddle meets it
+        paddleAim = (int)(random() % 21) - 10;
+        if (random() % PILOT_SLIP_ODDS == 0) paddleAim = random() % 2 ? 40 : -40;
+    }
+    lastBallVY = state.ballVY;
+
+    // arkanoidStep moves the paddle tiltMg * -25 / 1000 pixels
+    int move = state.ballX + paddleAim - (state.paddleX + ARKANOID_PADDLE_W / 2);
+    GameInput input = { false, tiltFor(move, 40) };
+    return input;
+}
+
+GameInput GameAutopilot::next(const InvadersState& state) {
+    if (alienTarget < 0 || !state.aliens[alienTarget].alive) {
+        alienTarget = -1;
+        if (state.aliveCount > 0) {
+            int pick = random() % state.aliveCount;
+            for (int i = 0; i < INVADERS_ALIENS; i++) {
+                if (state.aliens[i].alive && pick-- == 0) {
+                    alienTarget = i;
+                    break;
+                }
+            }
+        }
+    }
+    GameInput input = { false, 0 };
+    if (alienTarget < 0) return input;
+
+    // invadersStep moves the ship tiltMg * -20 / 1000 pixels and fires
+    // from playerX + 4, so playerX == alien.x is dead centre
+    int move = state.aliens[alienTarget].x - state.playerX;
+    input.tiltMg = tiltFor(move, 50);
+    input.fire = move >= -PILOT_FIRE_SLACK && move <= PILOT_FIRE_SLACK;
+    return input;
+}
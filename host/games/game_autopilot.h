@@ -0,0 +1,31 @@
+#ifndef HOST_GAME_AUTOPILOT_H
+#define HOST_GAME_AUTOPILOT_H
+
+// Scripted players for the games in src/game_sim.h, so benchmarks and
+// recorded input logs exercise real play: the dino jumps cacti, the paddle
+// follows the ball, the ship lines up under an alien and shoots. Each one
+// slips now and then, so games end. Same seed, same inputs.
+
+#include <stdint.h>
+#include "game_sim.h"
+
+class GameAutopilot {
+public:
+    explicit GameAutopilot(uint32_t seed = 1);
+
+    GameInput next(const DinoState& state);
+    GameInput next(const ArkanoidState& state);
+    GameInput next(const InvadersState& state);
+
+private:
+    uint32_t rng;
+    int dinoLead;        // Jump when the cactus is this many ticks away
+    int lastCactusX;
+    int paddleAim;       // Where under the ball the paddle centre goes
+    int lastBallVY;
+    int alienTarget;
+
+    uint32_t random();
+};
+
+#endif
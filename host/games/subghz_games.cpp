@@ -0,0 +1,254 @@
+// Replays game input logs through the simulation cores in src/game_sim.h
+// and checks each game ends as the device said it did. Usage:
+//
+//   subghz_games [--logs <dir>] [log ...]
+//   subghz_games --record <dino|arkanoid|invaders> <log> [--seed <n>] [--ticks <n>]
+//
+// Logs are serial captures from a -DGAME_INPUT_LOG build: "[GAME] begin
+// <game>", one "[GAME] <fire> <tiltMg>" per tick, then "[GAME] end <score>
+// <ticks>". Anything else on a line before [GAME], and any line without
+// it, is ignored, so a raw monitor capture works. With no logs given every
+// *.log in --logs (default host/games/logs/) is replayed. A game whose score
+// or tick count differs from its end line is a MISMATCH and the exit status
+// is 1. --record plays one game with the autopilot (game_autopilot.h) and
+// writes its log, stopping as B would after --ticks (default 20000).
+
+#include "game_sim.h"
+#include "game_autopilot.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define GAMES_LOG_TAG       "[GAME] "
+#define GAMES_RECORD_TICKS  20000
+
+// One begin..end stretch of a log
+struct GameSession {
+    std::string game;
+    int line;                  // Of the begin line
+    std::vector<GameInput> inputs;
+    bool ended;
+    int endScore;
+    uint32_t endTicks;
+};
+
+struct GameOutcome {
+    int score;
+    uint32_t ticks;
+    bool gameOver;
+    double runMs;
+};
+
+template <typename State>
+static GameOutcome replayGame(void (*reset)(State*), void (*step)(State*, const GameInput&),
+                              const std::vector<GameInput>& inputs) {
+    auto start = std::chrono::steady_clock::now();
+    State state;
+    reset(&state);
+    for (const GameInput& input : inputs) {
+        step(&state, input);
+    }
+    GameOutcome outcome = { state.score, state.ticks, state.gameOver, 0 };
+    outcome.runMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    return outcome;
+}
+
+static bool replaySession(const GameSession& session, GameOutcome* outcome) {
+    if (session.game == "dino") {
+        *outcome = replayGame(dinoReset, dinoStep, session.inputs);
+    } else if (session.game == "arkanoid") {
+        *outcome = replayGame(arkanoidReset, arkanoidStep, session.inputs);
+    } else if (session.game == "invaders") {
+        *outcome = replayGame(invadersReset, invadersStep, session.inputs);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Returns false and fills error if the file cannot be read or parsed
+static bool loadLog(const std::string& path, std::vector<GameSession>* sessions, std::string* error) {
+    std::ifstream in(path);
+    if (!in) {
+        *error = "cannot open " + path;
+        return false;
+    }
+    std::string text;
+    int lineNo = 0;
+    GameSession* open = nullptr;
+    while (std::getline(in, text)) {
+        lineNo++;
+        size_t tag = text.find(GAMES_LOG_TAG);
+        if (tag == std::string::npos) continue;
+        std::istringstream fields(text.substr(tag + strlen(GAMES_LOG_TAG)));
+        std::string first;
+        fields >> first;
+
+        if (first == "begin") {
+            sessions->push_back(GameSession());
+            open = &sessions->back();
+            open->line = lineNo;
+            open->ended = false;
+            fields >> open->game;
+        } else if (first == "end") {
+            if (open == nullptr || !(fields >> open->endScore >> open->endTicks)) {
+                *error = "line " + std::to_string(lineNo) + ": bad end";
+                return false;
+            }
+            open->ended = true;
+            open = nullptr;
+        } else if (open != nullptr) {
+            int fire, tilt;
+            std::istringstream tick(first);
+            if (!(tick >> fire) || !(fields >> tilt)) {
+                *error = "line " + std::to_string(lineNo) + ": bad tick";
+                return false;
+            }
+            open->inputs.push_back({ fire != 0, (int16_t)tilt });
+        }
+    }
+    return true;
+}
+
+static std::vector<std::string> listLogs(const std::string& dir) {
+    std::vector<std::string> logs;
+    DIR* d = opendir(dir.c_str());
+    if (d == nullptr) return logs;
+    while (struct dirent* entry = readdir(d)) {
+        std::string file = entry->d_name;
+        if (file.size() > 4 && file.compare(file.size() - 4, 4, ".log") == 0) {
+            logs.push_back(dir + "/" + file);
+        }
+    }
+    closedir(d);
+    std::sort(logs.begin(), logs.end());
+    return logs;
+}
+
+template <typename State>
+static void recordGame(void (*reset)(State*), void (*step)(State*, const GameInput&),
+                       GameAutopilot& pilot, uint32_t maxTicks, std::ostream& out) {
+    State state;
+    reset(&state);
+    while (!state.gameOver && state.ticks < maxTicks) {
+        GameInput input = pilot.next(state);
+        out << GAMES_LOG_TAG << (input.fire ? 1 : 0) << " " << input.tiltMg << "\n";
+        step(&state, input);
+    }
+    out << GAMES_LOG_TAG << "end " << state.score << " " << state.ticks << "\n";
+}
+
+static int record(const std::string& game, const std::string& path, uint32_t seed, uint32_t maxTicks) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", path.c_str());
+        return 2;
+    }
+    GameAutopilot pilot(seed);
+    out << GAMES_LOG_TAG << "begin " << game << "\n";
+    if (game == "dino") {
+        recordGame(dinoReset, dinoStep, pilot, maxTicks, out);
+    } else if (game == "arkanoid") {
+        recordGame(arkanoidReset, arkanoidStep, pilot, maxTicks, out);
+    } else if (game == "invaders") {
+        recordGame(invadersReset, invadersStep, pilot, maxTicks, out);
+    } else {
+        fprintf(stderr, "unknown game %s\n", game.c_str());
+        return 2;
+    }
+    return 0;
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr, "usage: %s [--logs <dir>] [log ...]\n"
+                    "       %s --record <dino|arkanoid|invaders> <log> [--seed <n>] [--ticks <n>]\n",
+            argv0, argv0);
+}
+
+int main(int argc, char** argv) {
+    std::string logDir = GAMES_LOG_DIR;
+    std::string recordGameName, recordPath;
+    uint32_t seed = 1;
+    uint32_t maxTicks = GAMES_RECORD_TICKS;
+    std::vector<std::string> logs;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--logs" && i + 1 < argc) {
+            logDir = argv[++i];
+        } else if (arg == "--record" && i + 2 < argc) {
+            recordGameName = argv[++i];
+            recordPath = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = strtoul(argv[++i], nullptr, 0);
+        } else if (arg == "--ticks" && i + 1 < argc) {
+            maxTicks = strtoul(argv[++i], nullptr, 0);
+        } else if (arg[0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            logs.push_back(arg);
+        }
+    }
+    if (!recordGameName.empty()) return record(recordGameName, recordPath, seed, maxTicks);
+
+    if (logs.empty()) logs = listLogs(logDir);
+    if (logs.empty()) {
+        fprintf(stderr, "no logs in %s\n", logDir.c_str());
+        return 2;
+    }
+
+    int games = 0;
+    int failures = 0;
+    uint64_t totalTicks = 0;
+    double totalMs = 0;
+    for (const std::string& path : logs) {
+        std::string name = path.substr(path.find_last_of('/') + 1);
+        std::vector<GameSession> sessions;
+        std::string error;
+        if (!loadLog(path, &sessions, &error)) {
+            printf("%-24s ERROR %s\n", name.c_str(), error.c_str());
+            failures++;
+            continue;
+        }
+
+        for (const GameSession& session : sessions) {
+            games++;
+            GameOutcome outcome;
+            if (!replaySession(session, &outcome)) {
+                printf("%-24s line %-6d ERROR unknown game '%s'\n", name.c_str(), session.line, session.game.c_str());
+                failures++;
+                continue;
+            }
+            totalTicks += outcome.ticks;
+            totalMs += outcome.runMs;
+
+            // A capture cut off before the end line has nothing to check
+            const char* status = "ok";
+            if (!session.ended) {
+                status = "no end line";
+            } else if (outcome.score != session.endScore || outcome.ticks != session.endTicks) {
+                status = "MISMATCH";
+                failures++;
+            }
+            printf("%-24s line %-6d %-9s ticks=%-7u score=%-5d %-6s %8.3f ms  %s\n",
+                   name.c_str(), session.line, session.game.c_str(), (unsigned)outcome.ticks,
+                   outcome.score, outcome.gameOver ? "over" : "exited", outcome.runMs, status);
+            if (status[0] == 'M') {
+                printf("%-24s %-11s %-9s ticks=%-7u score=%-5d (logged)\n",
+                       "", "", "", (unsigned)session.endTicks, session.endScore);
+            }
+        }
+    }
+    printf("%d games, %d failed, %llu ticks in %.1f ms\n",
+           games, failures, (unsigned long long)totalTicks, totalMs);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,46 @@
+// Runs the firmware's setup() and loop() on Linux, for profiling with
+// perf/valgrind. Usage:
+//
+//   subghz_host [loops] [keys]
+//
+// keys is pressed one character every HOST_KEY_INTERVAL loops:
+// A = button A, B = button B, P = power button, anything else = no press.
+// Set HOST_QUIET=1 to silence the firmware's serial log.
+
+#include <M5StickCPlus.h>
+
+#define HOST_DEFAULT_LOOPS 1000
+#define HOST_KEY_INTERVAL  50
+
+void setup();
+void loop();
+
+static void press(char key) {
+    switch (key) {
+        case 'A': M5.BtnA.hostPress(); break;
+        case 'B': M5.BtnB.hostPress(); break;
+        case 'P': M5.Axp.hostPress(); break;
+        default: break;
+    }
+}
+
+int main(int argc, char** argv) {
+    long loops = (argc > 1) ? atol(argv[1]) : HOST_DEFAULT_LOOPS;
+    const char* keys = (argc > 2) ? argv[2] : "";
+    size_t keyCount = strlen(keys);
+
+    setup();
+
+    unsigned long start = micros();
+    for (long i = 0; i < loops; i++) {
+        if (i % HOST_KEY_INTERVAL == 0 && (size_t)(i / HOST_KEY_INTERVAL) < keyCount) {
+            press(keys[i / HOST_KEY_INTERVAL]);
+        }
+        loop();
+    }
+    unsigned long elapsed = micros() - start;
+
+    fprintf(stderr, "[HOST] %ld loops in %lu us (%.1f us/loop)\n", loops, elapsed,
+            loops > 0 ? (double)elapsed / loops : 0.0);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#ifndef HOST_PROBE_H
+#define HOST_PROBE_H
+
+// Reaches into SubGhzOperations and WiFiAP (a friend of both) for host
+// tools that need to set up or read state the public API does not expose
+
+#include "subghz_operations.h"
+#include "wifi_ap.h"
+
+class HostProbe {
+public:
+    static int* spectrumData(SubGhzOperations& ops) { return ops.spectrumData; }
+    static int* rssiHistory(SubGhzOperations& ops) { return ops.rssiHistory; }
+    static int& historyIndex(SubGhzOperations& ops) { return ops.historyIndex; }
+    static int signalCount(SubGhzOperations& ops) { return ops.signalCount; }
+
+    static void drawSpectrum(SubGhzOperations& ops) { ops.drawSpectrum(); }
+    static void drawRSSIWaveform(SubGhzOperations& ops) { ops.drawRSSIWaveform(); }
+
+    // The server the web handlers are registered on, for hostHandle()
+    static AsyncWebServer* webServer(WiFiAP& ap) { return ap.server; }
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "png_image.h"
+
+#include <fstream>
+#include <iterator>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+static const uint8_t pngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+static void putU32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void putChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    putU32(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putU32(out, crc32(0, out.data() + start, out.size() - start));
+}
+
+bool writePng565(const std::string& path, const uint16_t* pixels, int width, int height) {
+    // Filter byte 0 (none) then RGB888 per row
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (width * 3 + 1));
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        for (int x = 0; x < width; x++) {
+            uint16_t c = pixels[y * width + x];
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >> 5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            raw.push_back((r << 3) | (r >> 2));
+            raw.push_back((g << 2) | (g >> 4));
+            raw.push_back((b << 3) | (b >> 2));
+        }
+    }
+
+    uLongf packedLen = compressBound(raw.size());
+    std::vector<uint8_t> packed(packedLen);
+    if (compress2(packed.data(), &packedLen, raw.data(), raw.size(), Z_BEST_COMPRESSION) != Z_OK) {
+        return false;
+    }
+    packed.resize(packedLen);
+
+    std::vector<uint8_t> header;
+    putU32(header, width);
+    putU32(header, height);
+    header.push_back(8);  // Bit depth
+    header.push_back(2);  // Truecolor
+    header.push_back(0);  // Deflate
+    header.push_back(0);  // Adaptive filtering
+    header.push_back(0);  // Not interlaced
+
+    std::vector<uint8_t> file(pngSignature, pngSignature + 8);
+    putChunk(file, "IHDR", header);
+    putChunk(file, "IDAT", packed);
+    putChunk(file, "IEND", std::vector<uint8_t>());
+
+    std::ofstream out(path, std::ios::binary);
+    out.write((const char*)file.data(), file.size());
+    return (bool)out;
+}
+
+static uint8_t paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    if (pb <= pc) return b;
+    return c;
+}
+
+bool readPng565(const std::string& path, std::vector<uint16_t>* pixels, int* width, int* height,
+                std::string* error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        *error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (file.size() < 8 || memcmp(file.data(), pngSignature, 8) != 0) {
+        *error = path + ": not a PNG";
+        return false;
+    }
+
+    std::vector<uint8_t> packed;
+    int w = 0;
+    int h = 0;
+    int channels = 0;
+    size_t pos = 8;
+    while (pos + 12 <= file.size()) {
+        uint32_t length = getU32(&file[pos]);
+        if (pos + 12 + length > file.size()) break;
+        const char* type = (const char*)&file[pos + 4];
+        const uint8_t* data = &file[pos + 8];
+        if (memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+            w = getU32(data);
+            h = getU32(data + 4);
+            // 8-bit RGB or RGBA, not interlaced
+            if (data[8] != 8 || (data[9] != 2 && data[9] != 6) || data[12] != 0) {
+                *error = path + ": only 8-bit RGB/RGBA, non-interlaced PNGs are supported";
+                return false;
+            }
+            channels = (data[9] == 6) ? 4 : 3;
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            packed.insert(packed.end(), data, data + length);
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        pos += 12 + length;
+    }
+    if (w <= 0 || h <= 0 || packed.empty()) {
+        *error = path + ": missing image data";
+        return false;
+    }
+
+    size_t stride = (size_t)w * channels;
+    std::vector<uint8_t> raw((stride + 1) * h);
+    uLongf rawLen = raw.size();
+    if (uncompress(raw.data(), &rawLen, packed.data(), packed.size()) != Z_OK || rawLen != raw.size()) {
+        *error = path + ": corrupt image data";
+        return false;
+    }
+
+    // Undo the row filters in place
+    for (int y = 0; y < h; y++) {
+        uint8_t filter = raw[y * (stride + 1)];
+        uint8_t* row = &raw[y * (stride + 1) + 1];
+        const uint8_t* prev = (y > 0) ? &raw[(y - 1) * (stride + 1) + 1] : nullptr;
+        for (size_t i = 0; i < stride; i++) {
+            int a = (i >= (size_t)channels) ? row[i - channels] : 0;
+            int b = prev ? prev[i] : 0;
+            int c = (prev && i >= (size_t)channels) ? prev[i - channels] : 0;
+            switch (filter) {
+                case 0: break;
+                case 1: row[i] += a; break;
+                case 2: row[i] += b; break;
+                case 3: row[i] += (a + b) / 2; break;
+                case 4: row[i] += paeth(a, b, c); break;
+                default:
+                    *error = path + ": bad row filter";
+                    return false;
+            }
+        }
+    }
+
+    pixels->resize((size_t)w * h);
+    for (int y = 0; y < h; y++) {
+        const uint8_t* row = &raw[y * (stride + 1) + 1];
+        for (int x = 0; x < w; x++) {
+            const uint8_t* p = row + x * channels;
+            (*pixels)[y * w + x] = ((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3);
+        }
+    }
+    *width = w;
+    *height = h;
+    return true;
+}
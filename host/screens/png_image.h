@@ -0,0 +1,18 @@
+#ifndef HOST_PNG_IMAGE_H
+#define HOST_PNG_IMAGE_H
+
+// RGB565 framebuffers to and from 8-bit RGB PNG files (zlib for deflate).
+// The reader handles what the writer produces plus any row filters, which
+// is enough for golden images that were optimized by other tools.
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+bool writePng565(const std::string& path, const uint16_t* pixels, int width, int height);
+
+// Returns false and fills error on a missing file or an unsupported PNG
+bool readPng565(const std::string& path, std::vector<uint16_t>* pixels, int* width, int* height,
+                std::string* error);
+
+#endif
@@ -0,0 +1,169 @@
+// Walks the firmware through its screens on the host framebuffer and
+// compares each one with host/screens/golden/<screen>.png. Usage:
+//
+//   subghz_screens [--update] [--out <dir>] [screen ...]
+//
+// The walk is one boot on the virtual clock, so every run draws the same
+// pixels. For each screen it prints the draw calls and pixels written
+// getting there (frames are loop passes that drew anything) and whether
+// the snapshot matches. Mismatches are written to --out (default
+// screens-out/) next to a copy of the golden; --update accepts the
+// current snapshots as the new goldens.
+
+#include <M5StickCPlus.h>
+#include "png_image.h"
+
+#include <set>
+#include <string>
+#include <sys/stat.h>
+
+#define SCREENS_KEY_LOOPS    30   // Loop passes after each key press
+#define SCREENS_SETTLE_LOOPS 60   // Extra passes before the snapshot
+
+void setup();
+void loop();
+
+// Keys as in subghz_host: A, B, P (power). Each step starts where the
+// previous one left off; B backs out to the main menu first
+struct ScreenStep {
+    const char* name;
+    const char* keys;
+};
+
+static const ScreenStep steps[] = {
+    { "main_menu", "" },
+    { "scan", "A" },
+    { "spectrum", "BBA" },
+    { "listen", "BBA" },
+    { "record", "BBA" },
+    { "replay", "BBA" },
+    { "hacks", "BBA" },
+    { "games", "BBA" },
+    { "wifi_ap", "BBA" },
+    { "settings", "BBA" },
+    { "about", "PA" },
+    { "spi_bus", "BPA" },
+};
+
+struct StepStats {
+    uint32_t calls;
+    uint64_t pixels;
+    int frames;
+    uint64_t maxFramePixels;
+};
+
+static void press(char key) {
+    switch (key) {
+        case 'A': M5.BtnA.hostPress(); break;
+        case 'B': M5.BtnB.hostPress(); break;
+        case 'P': M5.Axp.hostPress(); break;
+        default: break;
+    }
+}
+
+static void runLoops(int count, StepStats* stats) {
+    for (int i = 0; i < count; i++) {
+        M5.Lcd.hostResetStats();
+        loop();
+        const HostDrawStats& frame = M5.Lcd.hostStats();
+        if (frame.calls == 0) continue;
+        stats->calls += frame.calls;
+        stats->pixels += frame.pixels;
+        stats->frames++;
+        if (frame.pixels > stats->maxFramePixels) stats->maxFramePixels = frame.pixels;
+    }
+}
+
+// Pixels that differ, or -1 if the sizes do
+static long countDiff(const std::vector<uint16_t>& golden, int width, int height) {
+    if (width != M5.Lcd.width() || height != M5.Lcd.height()) return -1;
+    const uint16_t* actual = M5.Lcd.hostPixels();
+    long diff = 0;
+    for (size_t i = 0; i < golden.size(); i++) {
+        if (golden[i] != actual[i]) diff++;
+    }
+    return diff;
+}
+
+int main(int argc, char** argv) {
+    std::string goldenDir = SCREENS_GOLDEN_DIR;
+    std::string outDir = "screens-out";
+    bool update = false;
+    std::set<std::string> only;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else if (arg == "--out" && i + 1 < argc) {
+            outDir = argv[++i];
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "usage: %s [--update] [--out <dir>] [screen ...]\n", argv[0]);
+            return 2;
+        } else {
+            only.insert(arg);
+        }
+    }
+
+    hostUseVirtualClock(true);
+    setup();
+
+    int failures = 0;
+    int checked = 0;
+    bool outMade = false;
+    for (const ScreenStep& step : steps) {
+        StepStats stats = {};
+        for (const char* key = step.keys; *key != '\0'; key++) {
+            press(*key);
+            runLoops(SCREENS_KEY_LOOPS, &stats);
+        }
+        runLoops(SCREENS_SETTLE_LOOPS, &stats);
+        if (!only.empty() && only.count(step.name) == 0) continue;
+        checked++;
+
+        std::string goldenPath = goldenDir + "/" + step.name + ".png";
+        const char* status = "ok";
+        char detail[64] = "";
+        if (update) {
+            if (!writePng565(goldenPath, M5.Lcd.hostPixels(), M5.Lcd.width(), M5.Lcd.height())) {
+                status = "WRITE FAILED";
+                failures++;
+            } else {
+                status = "updated";
+            }
+        } else {
+            std::vector<uint16_t> golden;
+            int width;
+            int height;
+            std::string error;
+            long diff = -1;
+            if (!readPng565(goldenPath, &golden, &width, &height, &error)) {
+                status = "NO GOLDEN";
+                snprintf(detail, sizeof(detail), " (%s)", error.c_str());
+            } else if ((diff = countDiff(golden, width, height)) != 0) {
+                status = "MISMATCH";
+                if (diff > 0) {
+                    snprintf(detail, sizeof(detail), " (%ld pixels differ)", diff);
+                } else {
+                    snprintf(detail, sizeof(detail), " (golden is %dx%d)", width, height);
+                }
+            }
+            if (diff != 0) {
+                failures++;
+                if (!outMade) {
+                    mkdir(outDir.c_str(), 0755);
+                    outMade = true;
+                }
+                writePng565(outDir + "/" + step.name + ".png", M5.Lcd.hostPixels(), M5.Lcd.width(), M5.Lcd.height());
+                if (diff > 0) {
+                    writePng565(outDir + "/" + step.name + ".golden.png", golden.data(), width, height);
+                }
+            }
+        }
+        printf("%-12s calls=%-6u pixels=%-8llu frames=%-4d max_frame_px=%-7llu %s%s\n",
+               step.name, stats.calls, (unsigned long long)stats.pixels, stats.frames,
+               (unsigned long long)stats.maxFramePixels, status, detail);
+    }
+    printf("%d screens, %d failed\n", checked, failures);
+    if (failures > 0 && !update) printf("actual snapshots written to %s/\n", outDir.c_str());
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+#include "sim_trace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <math.h>
+#include <sstream>
+
+bool SimTrace::load(const std::string& path, std::string* error) {
+    std::ifstream in(path);
+    if (!in) {
+        *error = "cannot open " + path;
+        return false;
+    }
+
+    size_t slash = path.find_last_of('/');
+    name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+    size_t dot = name.rfind(".trace");
+    if (dot != std::string::npos) name = name.substr(0, dot);
+
+    freq = 0;
+    rssiTimes.clear();
+    rssiLevels.clear();
+    edges.clear();
+
+    // High intervals of every burst, merged below
+    std::vector<std::pair<uint64_t, uint64_t>> highs;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream fields(line);
+        std::string directive;
+        if (!(fields >> directive)) continue;
+
+        bool ok = true;
+        if (directive == "freq") {
+            ok = (bool)(fields >> freq);
+        } else if (directive == "rssi") {
+            uint64_t t;
+            int dbm;
+            ok = (bool)(fields >> t >> dbm) && (rssiTimes.empty() || t >= rssiTimes.back());
+            if (ok) {
+                rssiTimes.push_back(t);
+                rssiLevels.push_back(dbm);
+            }
+        } else if (directive == "burst") {
+            uint64_t t;
+            ok = (bool)(fields >> t);
+            uint64_t duration;
+            bool high = true;
+            while (ok && fields >> duration) {
+                if (high) highs.push_back({t, t + duration});
+                t += duration;
+                high = !high;
+            }
+        } else {
+            ok = false;
+        }
+
+        if (!ok) {
+            *error = path + ":" + std::to_string(lineNumber) + ": bad line";
+            return false;
+        }
+    }
+    if (freq <= 0) {
+        *error = path + ": missing freq";
+        return false;
+    }
+
+    std::sort(highs.begin(), highs.end());
+    for (const auto& high : highs) {
+        if (!edges.empty() && high.first <= edges.back()) {
+            // Overlaps (or touches) the previous high: extend it
+            edges.back() = std::max(edges.back(), high.second);
+        } else {
+            edges.push_back(high.first);
+            edges.push_back(high.second);
+        }
+    }
+    return true;
+}
+
+int SimTrace::rssiAt(uint64_t t, float tunedMHz) const {
+    if (fabsf(tunedMHz - freq) > SIM_TUNE_MHZ) return SIM_FLOOR_DBM;
+    auto next = std::upper_bound(rssiTimes.begin(), rssiTimes.end(), t);
+    if (next == rssiTimes.begin()) return SIM_FLOOR_DBM;
+    return rssiLevels[next - rssiTimes.begin() - 1];
+}
+
+int SimTrace::levelAt(uint64_t t) const {
+    size_t toggles = std::upper_bound(edges.begin(), edges.end(), t) - edges.begin();
+    return toggles & 1;
+}
+
+uint64_t SimTrace::getEndUs() const {
+    uint64_t end = rssiTimes.empty() ? 0 : rssiTimes.back();
+    if (!edges.empty()) end = std::max(end, edges.back());
+    return end;
+}
@@ -0,0 +1,37 @@
+#ifndef HOST_SIM_TRACE_H
+#define HOST_SIM_TRACE_H
+
+// A recorded RF scene (see tools/make_corpus.py for the file format): an
+// RSSI level over time on one frequency, and the GDO0 edges a receiver
+// tuned there would output. Times are microseconds from the trace start.
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#define SIM_FLOOR_DBM   -98
+#define SIM_TUNE_MHZ    0.2   // RSSI is the floor further than this from freq
+
+class SimTrace {
+public:
+    // Returns false and fills error if the file cannot be read or parsed
+    bool load(const std::string& path, std::string* error);
+
+    const std::string& getName() const { return name; }
+    float getFreq() const { return freq; }
+    int rssiAt(uint64_t t, float tunedMHz) const;
+    int levelAt(uint64_t t) const;
+    uint64_t getEndUs() const;   // Last RSSI change or edge
+
+    // Times at which GDO0 toggles, starting low; overlapping bursts are OR-ed
+    const std::vector<uint64_t>& getEdges() const { return edges; }
+
+private:
+    std::string name;
+    float freq;
+    std::vector<uint64_t> rssiTimes;
+    std::vector<int> rssiLevels;
+    std::vector<uint64_t> edges;
+};
+
+#endif
@@ -0,0 +1,274 @@
+// Plays the traces in host/corpus/ through SubGhzOperations on the host
+// and checks the outcome against host/corpus/golden.txt. Usage:
+//
+//   subghz_sim [--update] [--fidelity] [--corpus <dir>] [case ...]
+//
+// Each case runs Listen over the whole trace, then Record from the start of
+// the trace, then replays the capture with button A. The clock is virtual
+// (see hostUseVirtualClock), so results are exact and repeatable; the run
+// time printed per case is real CPU-bound wall time, for spotting slowdowns.
+// --update rewrites golden.txt from the current results. --fidelity scores
+// each replay from the TX log by pulse-width class (replay_fidelity.h).
+
+#include <M5StickCPlus.h>
+#include <ELECHOUSE_CC1101_SRC_DRV.h>
+#include "cc1101_interface.h"
+#include "menu_system.h"
+#include "subghz_operations.h"
+#include "host_probe.h"
+#include "sim_trace.h"
+#include "replay_fidelity.h"
+
+#include <dirent.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#define SIM_TAIL_US     200000   // Keep running this long after the trace ends
+#define SIM_GOLDEN_FILE "golden.txt"
+
+struct SimResult {
+    int bursts;           // Signals counted by Listen
+    int samples;          // Timings in the capture, 0 if nothing was captured
+    int captureErrUs;     // Worst recorded timing vs. the trace's edges
+    int replayEdges;      // GDO0 writes made by the replay
+    int replayErrUs;      // Worst replayed pulse vs. the recorded timing
+    double runMs;
+};
+
+// The trace being played and where the current phase started
+static const SimTrace* trace = nullptr;
+static uint64_t phaseStart = 0;
+static int lastLevel = LOW;
+static int64_t firstObservedEdge = -1;
+static std::vector<uint64_t> replayWrites;
+
+static uint64_t phaseUs() {
+    return hostNowUs() - phaseStart;
+}
+
+static void startPhase() {
+    phaseStart = hostNowUs();
+    lastLevel = LOW;
+    firstObservedEdge = -1;
+}
+
+static int simRssi(float mhz) {
+    return trace->rssiAt(phaseUs(), mhz);
+}
+
+static int simPin(uint8_t pin) {
+    if (pin != CC1101_GDO0) return LOW;
+    int level = trace->levelAt(phaseUs());
+    if (level != lastLevel && firstObservedEdge < 0) firstObservedEdge = phaseUs();
+    lastLevel = level;
+    return level;
+}
+
+static void simPinWrite(uint8_t pin, uint8_t value) {
+    if (pin == CC1101_GDO0) replayWrites.push_back(hostNowUs());
+}
+
+// Recorded timings after the first are edge-to-edge intervals; line them
+// up with the trace from the first edge the capture loop saw
+static int captureError(const int* timings, int count) {
+    const std::vector<uint64_t>& edges = trace->getEdges();
+    if (count < 2 || firstObservedEdge < 0) return 0;
+    size_t k = std::upper_bound(edges.begin(), edges.end(), (uint64_t)firstObservedEdge) - edges.begin();
+    if (k == 0) return 0;
+    k--;
+
+    int worst = 0;
+    for (int i = 1; i < count && k + i < edges.size(); i++) {
+        int expected = edges[k + i] - edges[k + i - 1];
+        worst = max(worst, abs(timings[i] - expected));
+    }
+    return worst;
+}
+
+// Every GDO0 write is logged, including the first LOW, so starts line up
+// with timings[0]
+static void scoreReplay(const int* timings, int count) {
+    std::vector<uint32_t> starts(replayWrites.begin(), replayWrites.end());
+    replayFidelity.analyze(REPLAY_BACKEND, timings, count, starts.data(), starts.size(), 0);
+}
+
+static int replayError(const int* timings, int count) {
+    int worst = 0;
+    for (size_t i = 0; i + 1 < replayWrites.size() && (int)i < count; i++) {
+        int actual = replayWrites[i + 1] - replayWrites[i];
+        worst = max(worst, abs(actual - timings[i]));
+    }
+    return worst;
+}
+
+static SimResult runCase(const SimTrace& scene) {
+    SimResult result = {};
+    auto wallStart = std::chrono::steady_clock::now();
+
+    trace = &scene;
+    CC1101Interface radio;
+    MenuSystem menu;
+    SubGhzOperations ops(&radio, &menu);
+    ops.begin();
+    menu.setFrequency(scene.getFreq());
+    ELECHOUSE_cc1101.hostSetRssiSource(simRssi);
+    hostPinSource = simPin;
+    uint64_t end = scene.getEndUs() + SIM_TAIL_US;
+
+    // Listen, idling between updates like the main loop
+    menu.setMode(MODE_LISTENING);
+    startPhase();
+    while (phaseUs() < end) {
+        ops.update();
+        unsigned long wait = ops.getTimeUntilNextUpdate();
+        if (wait != NO_UPDATE_DUE && wait > 0) delay(wait);
+    }
+    result.bursts = HostProbe::signalCount(ops);
+
+    // Record from the top of the trace
+    menu.setMode(MODE_RECORDING);
+    startPhase();
+    while (!ops.hasCapture() && phaseUs() < end) {
+        ops.update();
+    }
+    if (ops.hasCapture()) {
+        result.samples = ops.getCaptureSampleCount();
+        result.captureErrUs = captureError(ops.getCaptureTimings(), result.samples);
+
+        // Replay it (Record has already switched to Replay)
+        hostPinSource = nullptr;
+        replayWrites.clear();
+        hostPinSink = simPinWrite;
+        M5.BtnA.hostPress();
+        M5.update();
+        ops.update();
+        hostPinSink = nullptr;
+        M5.update();
+        result.replayEdges = replayWrites.size();
+        result.replayErrUs = replayError(ops.getCaptureTimings(), result.samples);
+        scoreReplay(ops.getCaptureTimings(), result.samples);
+    }
+
+    hostPinSource = nullptr;
+    ELECHOUSE_cc1101.hostSetRssiSource(nullptr);
+    trace = nullptr;
+    result.runMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+    return result;
+}
+
+static std::string formatResult(const SimResult& r) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "bursts=%d samples=%d capture_err_us=%d replay_edges=%d replay_err_us=%d",
+             r.bursts, r.samples, r.captureErrUs, r.replayEdges, r.replayErrUs);
+    return buf;
+}
+
+static std::map<std::string, std::string> loadGolden(const std::string& path) {
+    std::map<std::string, std::string> golden;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        size_t space = line.find(' ');
+        if (space == std::string::npos) continue;
+        golden[line.substr(0, space)] = line.substr(space + 1);
+    }
+    return golden;
+}
+
+static std::vector<std::string> listCases(const std::string& dir) {
+    std::vector<std::string> cases;
+    DIR* d = opendir(dir.c_str());
+    if (d == nullptr) return cases;
+    while (struct dirent* entry = readdir(d)) {
+        std::string name = entry->d_name;
+        if (name.size() > 6 && name.compare(name.size() - 6, 6, ".trace") == 0) {
+            cases.push_back(name.substr(0, name.size() - 6));
+        }
+    }
+    closedir(d);
+    std::sort(cases.begin(), cases.end());
+    return cases;
+}
+
+int main(int argc, char** argv) {
+    std::string corpus = SIM_CORPUS_DIR;
+    bool update = false;
+    bool fidelity = false;
+    std::vector<std::string> cases;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else if (arg == "--fidelity") {
+            fidelity = true;
+        } else if (arg == "--corpus" && i + 1 < argc) {
+            corpus = argv[++i];
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "usage: %s [--update] [--fidelity] [--corpus <dir>] [case ...]\n", argv[0]);
+            return 2;
+        } else {
+            cases.push_back(arg);
+        }
+    }
+    if (cases.empty()) cases = listCases(corpus);
+    if (cases.empty()) {
+        fprintf(stderr, "no traces in %s\n", corpus.c_str());
+        return 2;
+    }
+
+    hostUseVirtualClock(true);
+    std::string goldenPath = corpus + "/" SIM_GOLDEN_FILE;
+    std::map<std::string, std::string> golden = loadGolden(goldenPath);
+
+    int failures = 0;
+    double totalMs = 0;
+    for (const std::string& name : cases) {
+        SimTrace scene;
+        std::string error;
+        if (!scene.load(corpus + "/" + name + ".trace", &error)) {
+            printf("%-24s ERROR %s\n", name.c_str(), error.c_str());
+            failures++;
+            continue;
+        }
+
+        replayFidelity.clear();
+        SimResult result = runCase(scene);
+        totalMs += result.runMs;
+        std::string actual = formatResult(result);
+        auto expected = golden.find(name);
+        const char* status = "ok";
+        if (update) {
+            golden[name] = actual;
+            status = "updated";
+        } else if (expected == golden.end()) {
+            status = "NO GOLDEN";
+            failures++;
+        } else if (expected->second != actual) {
+            status = "MISMATCH";
+            failures++;
+        }
+        printf("%-24s %-80s %8.1f ms  %s\n", name.c_str(), actual.c_str(), result.runMs, status);
+        if (!update && expected != golden.end() && expected->second != actual) {
+            printf("%-24s %s (expected)\n", "", expected->second.c_str());
+        }
+        if (fidelity && replayFidelity.hasResult()) {
+            char report[1024];
+            replayFidelity.formatReport(report, sizeof(report));
+            printf("%s", report);
+        }
+    }
+    printf("%zu cases, %d failed, %.1f ms\n", cases.size(), failures, totalMs);
+
+    if (update) {
+        std::ofstream out(goldenPath);
+        out << "# Expected subghz_sim results per corpus trace; regenerate with --update\n";
+        for (const auto& entry : golden) {
+            out << entry.first << " " << entry.second << "\n";
+        }
+    }
+    return failures > 0 ? 1 : 0;
+}
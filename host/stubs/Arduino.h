@@ -0,0 +1,177 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the ESP32 Arduino core: just enough of the API the
+// firmware uses to compile and run on Linux. Time is the real monotonic
+// clock; pins are plain variables a harness can drive.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "freertos/FreeRTOS.h"
+#include "pgmspace.h"
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW    0
+#define HIGH   1
+#define INPUT  0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define F(s) (s)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// C linkage as in the ESP32 core, so link-time wrapping (spi_profiler.h)
+// names the same symbols on both
+extern "C" {
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// Pin levels seen by digitalRead(); written by digitalWrite() and by
+// harnesses feeding the radio's GDO0 output
+#define HOST_PIN_COUNT 40
+extern volatile uint8_t hostPinLevel[HOST_PIN_COUNT];
+extern uint32_t hostPinWrites[HOST_PIN_COUNT];  // digitalWrite() calls per pin
+// When set, digitalRead() returns this instead of hostPinLevel, so a
+// harness can generate edges exactly when the firmware polls for them
+typedef int (*HostPinSource)(uint8_t pin);
+extern HostPinSource hostPinSource;
+// When set, called after every digitalWrite(), e.g. to timestamp replay edges
+typedef void (*HostPinSink)(uint8_t pin, uint8_t value);
+extern HostPinSink hostPinSink;
+
+// Switches millis()/micros() to a simulated clock for deterministic runs:
+// delay() and delayMicroseconds() advance it instantly, and every clock
+// read advances it by HOST_VIRTUAL_READ_US, about what one pass of a
+// polling loop costs on the ESP32. It starts from zero, so switch it on
+// before setup(). Single-threaded harnesses only; tasks created while it
+// is on run to completion before xTaskCreate returns.
+#define HOST_VIRTUAL_READ_US 1
+void hostUseVirtualClock(bool enabled);
+uint64_t hostNowUs();  // Current time without advancing the virtual clock
+
+class String {
+public:
+    String() {}
+    String(const char* s) : s(s != nullptr ? s : "") {}
+    String(const std::string& s) : s(s) {}
+    String(char c) : s(1, c) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    String(double v, unsigned int decimals = 2);
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.length(); }
+    char operator[](unsigned int i) const { return i < s.length() ? s[i] : 0; }
+
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator==(const char* o) const { return s == o; }
+    bool operator!=(const String& o) const { return s != o.s; }
+    bool operator!=(const char* o) const { return s != o; }
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* o) { s += o; return *this; }
+    String& operator+=(char c) { s += c; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+
+    bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.length(), prefix.s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return s.length() >= suffix.s.length() &&
+               s.compare(s.length() - suffix.s.length(), suffix.s.length(), suffix.s) == 0;
+    }
+    int indexOf(char c) const {
+        size_t i = s.find(c);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    int indexOf(const String& sub) const {
+        size_t i = s.find(sub.s);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    String substring(unsigned int from) const { return from < s.length() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        return from < to && from < s.length() ? String(s.substr(from, to - from)) : String();
+    }
+    void toLowerCase() { for (char& c : s) c = tolower((unsigned char)c); }
+    void toUpperCase() { for (char& c : s) c = toupper((unsigned char)c); }
+    void trim();
+    long toInt() const { return atol(s.c_str()); }
+    float toFloat() const { return atof(s.c_str()); }
+
+private:
+    std::string s;
+};
+
+// Serial output goes to stdout unless HOST_QUIET is set in the environment
+class HardwareSerial {
+public:
+    void begin(unsigned long baud) {}
+    size_t print(const char* s);
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(char c);
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned int v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(double v, int decimals = 2) { return printf("%.*f", decimals, v); }
+    // Printable-style values such as IPAddress
+    template <typename T, typename = decltype(std::declval<const T&>().toString())>
+    size_t print(const T& v) { return print(v.toString()); }
+    size_t println() { return print("\n"); }
+    template <typename T> size_t println(T v) { return print(v) + println(); }
+    size_t println(double v, int decimals) { return print(v, decimals) + println(); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t write(const uint8_t* data, size_t len);
+    void flush() { fflush(stdout); }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+// Cycle counter at HOST_CPU_MHZ, derived from the (possibly virtual) clock
+#define HOST_CPU_MHZ 240
+class EspClass {
+public:
+    uint32_t getCycleCount() { return (uint32_t)(hostNowUs() * HOST_CPU_MHZ); }
+    uint32_t getCpuFreqMHz() { return HOST_CPU_MHZ; }
+    // Fixed figures shaped like a running ESP32 (several heap regions)
+    uint32_t getFreeHeap() { return 180000; }
+    uint32_t getMaxAllocHeap() { return 110580; }
+    uint32_t getMinFreeHeap() { return 165000; }
+};
+
+extern EspClass ESP;
+
+#endif
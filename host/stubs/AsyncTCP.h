@@ -0,0 +1,60 @@
+#ifndef HOST_ASYNCTCP_H
+#define HOST_ASYNCTCP_H
+
+// Host stand-in for an AsyncTCP connection. Writes land in hostOutput
+// within a fixed send window; the harness acknowledges bytes with
+// hostAck() to open the window again, as a real peer would.
+
+#include <Arduino.h>
+#include <functional>
+
+class AsyncClient;
+
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void*, AsyncClient*, int8_t error)> AcErrorHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+typedef std::function<void(void*, AsyncClient*, uint32_t time)> AcTimeoutHandler;
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+#define HOST_TCP_WINDOW       5744  // Default lwIP TCP_SND_BUF on ESP32
+
+class AsyncClient {
+public:
+    AsyncClient();
+
+    size_t space() { return window - inFlight; }
+    bool canSend() { return space() > 0; }
+    size_t add(const char* data, size_t size, uint8_t flags = ASYNC_WRITE_FLAG_COPY);
+    bool send() { return connected; }
+    size_t write(const char* data, size_t size) { return add(data, size); }
+    void close(bool now = false);  // Runs the disconnect handler, which may delete this
+    int8_t abort() { connected = false; return -13; }  // ERR_ABRT; handlers run later on the device
+    bool connected;
+
+    void setRxTimeout(uint32_t timeout) {}
+    void onConnect(AcConnectHandler cb, void* arg = nullptr) {}
+    void onDisconnect(AcConnectHandler cb, void* arg = nullptr) { disconnectCb = cb; disconnectArg = arg; }
+    void onAck(AcAckHandler cb, void* arg = nullptr) { ackCb = cb; ackArg = arg; }
+    void onError(AcErrorHandler cb, void* arg = nullptr) {}
+    void onData(AcDataHandler cb, void* arg = nullptr) {}
+    void onTimeout(AcTimeoutHandler cb, void* arg = nullptr) {}
+    void onPoll(AcConnectHandler cb, void* arg = nullptr) { pollCb = cb; pollArg = arg; }
+
+    // Harness controls
+    std::string hostOutput;
+    size_t window;
+    void hostAck(size_t len);  // Peer acknowledged len bytes
+    void hostPoll();
+
+private:
+    size_t inFlight;
+    AcConnectHandler disconnectCb;
+    void* disconnectArg;
+    AcAckHandler ackCb;
+    void* ackArg;
+    AcConnectHandler pollCb;
+    void* pollArg;
+};
+
+#endif
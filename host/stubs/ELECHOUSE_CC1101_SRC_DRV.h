@@ -0,0 +1,161 @@
+#ifndef HOST_ELECHOUSE_CC1101_SRC_DRV_H
+#define HOST_ELECHOUSE_CC1101_SRC_DRV_H
+
+// Host stand-in for the SmartRC CC1101 driver: a register file plus a
+// simple RF model. RSSI is a deterministic noise floor with any carriers
+// the harness adds on top; received packets come from hostQueuePacket().
+// Register access goes over the SPI stub one chip select at a time, in the
+// pattern the SmartRC driver uses, so SPI profiling sees the same traffic.
+
+#include <Arduino.h>
+
+// Configuration registers
+#define CC1101_IOCFG2   0x00
+#define CC1101_IOCFG1   0x01
+#define CC1101_IOCFG0   0x02
+#define CC1101_FIFOTHR  0x03
+#define CC1101_SYNC1    0x04
+#define CC1101_SYNC0    0x05
+#define CC1101_PKTLEN   0x06
+#define CC1101_PKTCTRL1 0x07
+#define CC1101_PKTCTRL0 0x08
+#define CC1101_ADDR     0x09
+#define CC1101_CHANNR   0x0A
+#define CC1101_FSCTRL1  0x0B
+#define CC1101_FSCTRL0  0x0C
+#define CC1101_FREQ2    0x0D
+#define CC1101_FREQ1    0x0E
+#define CC1101_FREQ0    0x0F
+#define CC1101_MDMCFG4  0x10
+#define CC1101_MDMCFG3  0x11
+#define CC1101_MDMCFG2  0x12
+#define CC1101_MDMCFG1  0x13
+#define CC1101_MDMCFG0  0x14
+#define CC1101_DEVIATN  0x15
+#define CC1101_MCSM2    0x16
+#define CC1101_MCSM1    0x17
+#define CC1101_MCSM0    0x18
+#define CC1101_FOCCFG   0x19
+#define CC1101_BSCFG    0x1A
+#define CC1101_AGCCTRL2 0x1B
+#define CC1101_AGCCTRL1 0x1C
+#define CC1101_AGCCTRL0 0x1D
+#define CC1101_WOREVT1  0x1E
+#define CC1101_WOREVT0  0x1F
+#define CC1101_WORCTRL  0x20
+#define CC1101_FREND1   0x21
+#define CC1101_FREND0   0x22
+#define CC1101_FSCAL3   0x23
+#define CC1101_FSCAL2   0x24
+#define CC1101_FSCAL1   0x25
+#define CC1101_FSCAL0   0x26
+#define CC1101_RCCTRL1  0x27
+#define CC1101_RCCTRL0  0x28
+#define CC1101_FSTEST   0x29
+#define CC1101_PTEST    0x2A
+#define CC1101_AGCTEST  0x2B
+#define CC1101_TEST2    0x2C
+#define CC1101_TEST1    0x2D
+#define CC1101_TEST0    0x2E
+
+// Strobes
+#define CC1101_SRES     0x30
+#define CC1101_SFSTXON  0x31
+#define CC1101_SXOFF    0x32
+#define CC1101_SCAL     0x33
+#define CC1101_SRX      0x34
+#define CC1101_STX      0x35
+#define CC1101_SIDLE    0x36
+#define CC1101_SAFC     0x37
+#define CC1101_SWOR     0x38
+#define CC1101_SPWD     0x39
+#define CC1101_SFRX     0x3A
+#define CC1101_SFTX     0x3B
+#define CC1101_SWORRST  0x3C
+#define CC1101_SNOP     0x3D
+#define CC1101_PATABLE  0x3E
+#define CC1101_TXFIFO   0x3F
+#define CC1101_RXFIFO   0x3F
+
+#define HOST_CC1101_MAX_CARRIERS 8
+
+class ELECHOUSE_CC1101 {
+public:
+    ELECHOUSE_CC1101();
+
+    void Init();
+    bool getCC1101() { return present; }
+    void setSpiPin(byte sck, byte miso, byte mosi, byte ss) { ssPin = ss; }
+    void setGDO0(byte gdo0) { gdo0Pin = gdo0; }
+    void setGDO(byte gdo0, byte gdo2) { gdo0Pin = gdo0; }
+    void setBeginEndLogic(bool enabled) {}
+    void setModulation(byte modulation);
+    void setMHZ(float mhz);
+    void setDRate(float kbaud);
+    void setRxBW(float khz);
+    void setPA(int dbm) { writePaTable(); }
+
+    void SetRx();
+    void SetTx();
+    void setSidle() { SpiStrobe(CC1101_SIDLE); }
+    int getRssi();
+    byte getLqi() { return 0; }
+
+    bool CheckRxFifo(int t);
+    byte ReceiveData(byte* rxBuffer);
+    void SendData(byte* txBuffer, byte size);
+    bool CheckCRC() { return true; }
+
+    void SpiStrobe(byte strobe);
+    void SpiWriteReg(byte addr, byte value);
+    void SpiWriteBurstReg(byte addr, byte* buffer, byte num);
+    byte SpiReadReg(byte addr);
+    void SpiReadBurstReg(byte addr, byte* buffer, byte num);
+    byte SpiReadStatus(byte addr);
+
+    // Harness controls
+    void hostSetPresent(bool present) { this->present = present; }
+    void hostSetNoise(int floorDbm, int spreadDb);
+    bool hostAddCarrier(float mhz, int dbm, float widthMHz);
+    void hostClearCarriers();
+    void hostQueuePacket(const byte* data, byte length);
+    // Replaces the noise/carrier model, e.g. with a recorded RSSI trace
+    void hostSetRssiSource(int (*source)(float mhz)) { rssiSource = source; }
+    float hostGetMHz() { return mhz; }
+    byte hostGetState() { return state; }
+    uint32_t hostGetTxBytes() { return txBytes; }
+
+private:
+    bool present;
+    byte ssPin;
+    byte gdo0Pin;
+    byte modulation;
+    byte state;
+    float mhz;
+    byte regs[0x30];
+    byte paTable[8];
+    int paBand;  // Band the PA table was last written for
+    int noiseFloor;
+    int noiseSpread;
+    uint32_t noiseState;
+
+    struct Carrier {
+        float mhz;
+        float width;
+        int dbm;
+    };
+    Carrier carriers[HOST_CC1101_MAX_CARRIERS];
+    int carrierCount;
+    int (*rssiSource)(float mhz);
+
+    byte rxPacket[64];
+    byte rxLength;
+    uint32_t txBytes;
+
+    void busTransaction(byte header, int dataBytes);
+    void writePaTable();
+};
+
+extern ELECHOUSE_CC1101 ELECHOUSE_cc1101;
+
+#endif
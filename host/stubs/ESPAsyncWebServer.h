@@ -0,0 +1,264 @@
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+// Host stand-in for ESPAsyncWebServer with the same class shapes the
+// firmware relies on (custom responses override the same _respond/_ack/
+// _fillBuffer hooks). There is no socket: a harness builds a request,
+// passes it to AsyncWebServer::hostHandle() and gets the reply back.
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef uint8_t WebRequestMethodComposite;
+#define HTTP_GET     0x01
+#define HTTP_POST    0x02
+#define HTTP_DELETE  0x04
+#define HTTP_PUT     0x08
+#define HTTP_PATCH   0x10
+#define HTTP_HEAD    0x20
+#define HTTP_OPTIONS 0x40
+#define HTTP_ANY     0x7F
+
+class AsyncWebServerRequest;
+class AsyncWebServerResponse;
+
+typedef std::function<void(void)> ArDisconnectHandler;
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String& filename, size_t index,
+                           uint8_t* data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t* data, size_t len,
+                           size_t index, size_t total)> ArBodyHandlerFunction;
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::function<String(const String&)> AwsTemplateProcessor;
+
+// What a handler sent, as the client would have received it
+struct HostResponse {
+    int code = 0;
+    std::string contentType;
+    std::string headers;  // "Name: value\r\n" lines
+    std::string body;
+    bool stream = false;  // Connection taken over (e.g. SSE)
+    size_t formBytes = 0; // Request body the server held in memory as form params
+    bool aborted = false; // Connection dropped before the body was complete
+    std::function<void(size_t sent)> onSegment;  // Harness hook after each body segment
+};
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value, bool post)
+        : paramName(name), paramValue(value), post(post) {}
+    const String& name() const { return paramName; }
+    const String& value() const { return paramValue; }
+    bool isPost() const { return post; }
+    bool isFile() const { return false; }
+
+private:
+    String paramName;
+    String paramValue;
+    bool post;
+};
+
+enum WebResponseState {
+    RESPONSE_SETUP,
+    RESPONSE_HEADERS,
+    RESPONSE_CONTENT,
+    RESPONSE_WAIT_ACK,
+    RESPONSE_END,
+    RESPONSE_FAILED
+};
+
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse();
+    virtual ~AsyncWebServerResponse() {}
+    void setCode(int code) { _code = code; }
+    void setContentLength(size_t len) { _contentLength = len; }
+    void setContentType(const String& type) { _contentType = type; }
+    void addHeader(const String& name, const String& value);
+    String _assembleHead(uint8_t version);
+
+    virtual void _respond(AsyncWebServerRequest* request);
+    virtual size_t _ack(AsyncWebServerRequest* request, size_t len, uint32_t time) { return 0; }
+    virtual bool _sourceValid() const { return false; }
+
+protected:
+    friend class AsyncWebServerRequest;
+    int _code;
+    std::vector<std::pair<String, String>> _headers;
+    String _contentType;
+    size_t _contentLength;
+    bool _sendContentLength;
+    bool _chunked;
+    size_t _headLength;
+    WebResponseState _state;
+};
+
+// Body produced by _fillBuffer(); on the host it is drained in one go
+class AsyncAbstractResponse : public AsyncWebServerResponse {
+public:
+    void _respond(AsyncWebServerRequest* request) override;
+    virtual size_t _fillBuffer(uint8_t* buf, size_t maxLen) { return 0; }
+};
+
+class AsyncBasicResponse : public AsyncWebServerResponse {
+public:
+    AsyncBasicResponse(int code, const String& contentType = String(), const String& content = String());
+    void _respond(AsyncWebServerRequest* request) override;
+    bool _sourceValid() const override { return true; }
+
+private:
+    String content;
+};
+
+class AsyncCallbackResponse : public AsyncAbstractResponse {
+public:
+    AsyncCallbackResponse(const String& contentType, size_t len, AwsResponseFiller callback, bool chunked);
+    bool _sourceValid() const override { return true; }
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override;
+
+private:
+    AwsResponseFiller filler;
+    size_t filled;
+};
+
+class AsyncProgmemResponse : public AsyncAbstractResponse {
+public:
+    AsyncProgmemResponse(int code, const String& contentType, const uint8_t* content, size_t len);
+    bool _sourceValid() const override { return true; }
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override;
+
+private:
+    const uint8_t* content;
+    size_t offset;
+};
+
+class AsyncResponseStream : public AsyncAbstractResponse {
+public:
+    AsyncResponseStream(const String& contentType);
+    size_t write(const uint8_t* data, size_t len);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    bool _sourceValid() const override { return true; }
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override;
+
+private:
+    std::string buffer;
+    size_t offset;
+};
+
+class AsyncWebServerRequest {
+public:
+    AsyncWebServerRequest(WebRequestMethodComposite method, const char* url);
+    ~AsyncWebServerRequest();
+
+    AsyncClient* client() { return tcp; }
+    uint8_t version() { return 1; }
+    WebRequestMethodComposite method() { return requestMethod; }
+    const String& url() const { return requestUrl; }
+    const String& contentType() const { return requestContentType; }
+
+    bool hasParam(const char* name, bool post = false, bool file = false);
+    AsyncWebParameter* getParam(const char* name, bool post = false, bool file = false);
+    bool hasHeader(const char* name);
+    String header(const char* name);
+
+    void onDisconnect(ArDisconnectHandler fn) { disconnectHandler = fn; }  // Runs just before deletion
+
+    void send(AsyncWebServerResponse* response);
+    void send(int code, const String& contentType = String(), const String& content = String());
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(),
+                                          const String& content = String());
+    AsyncWebServerResponse* beginResponse(const String& contentType, size_t len, AwsResponseFiller callback,
+                                          AwsTemplateProcessor templateCallback = nullptr);
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller callback,
+                                                 AwsTemplateProcessor templateCallback = nullptr);
+    AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460);
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content,
+                                            size_t len, AwsTemplateProcessor callback = nullptr);
+
+    // Harness side
+    void hostAddParam(const char* name, const char* value, bool post = false);
+    void hostAddHeader(const char* name, const char* value);
+    void hostSetBody(const char* contentType, const uint8_t* data, size_t len);
+    std::string hostBody;
+    size_t hostDropAt;  // Body bytes delivered before the client goes away (default: all)
+    HostResponse* hostResult;
+    bool* hostDeleted;  // Set when the request is destroyed (a stream takes it over)
+
+private:
+    AsyncClient* tcp;
+    bool tcpTaken;  // A stream response took the connection over
+    WebRequestMethodComposite requestMethod;
+    String requestUrl;
+    String requestContentType;
+    std::vector<AsyncWebParameter*> params;
+    std::vector<std::pair<String, String>> headers;
+    AsyncWebServerResponse* response;
+    ArDisconnectHandler disconnectHandler;
+};
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+    virtual bool canHandle(AsyncWebServerRequest* request) { return false; }
+    virtual void handleRequest(AsyncWebServerRequest* request) {}
+    virtual void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index,
+                              uint8_t* data, size_t len, bool final) {}
+    virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                            size_t index, size_t total) {}
+    // The server skips the body of a request whose handler is trivial
+    virtual bool isRequestHandlerTrivial() { return true; }
+};
+
+// What on() registers: exact URI or a sub-path of it, any of the methods
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+    AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method,
+                            ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload,
+                            ArBodyHandlerFunction onBody);
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override;
+    void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                    size_t index, size_t total) override;
+    bool isRequestHandlerTrivial() override { return !onRequest; }
+
+private:
+    String uri;
+    WebRequestMethodComposite method;
+    ArRequestHandlerFunction onRequest;
+    ArUploadHandlerFunction onUpload;
+    ArBodyHandlerFunction onBody;
+};
+
+class AsyncWebServer {
+public:
+    AsyncWebServer(uint16_t port);
+    ~AsyncWebServer();
+    void begin() {}
+    void end() {}
+    void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+    void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+            ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody = nullptr);
+    void onNotFound(ArRequestHandlerFunction fn);
+    void addHandler(AsyncWebHandler* handler) { handlers.push_back(handler); }  // Owned from here on
+
+    // Runs the request through the first handler, in the order added, that
+    // can handle it (else the not-found one) and deletes it; returns false
+    // if no added handler took it. The body goes to the handler as the
+    // library delivers it: urlencoded bodies (and text/plain ones opening
+    // with "name=") are parsed into form params if the handler is not
+    // trivial and skipped if it is, anything else goes to handleBody() in
+    // segment-sized pieces. A request with hostDropAt inside its body is
+    // deleted there, as a disconnect mid-upload would, without reaching
+    // the request handler
+    bool hostHandle(AsyncWebServerRequest* request, HostResponse* result);
+
+private:
+    std::vector<AsyncWebHandler*> handlers;
+    AsyncCallbackWebHandler* catchAll;
+};
+
+#endif
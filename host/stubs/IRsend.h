@@ -0,0 +1,17 @@
+#ifndef HOST_IRSEND_H
+#define HOST_IRSEND_H
+
+#include <Arduino.h>
+
+// Counts what would be sent; no carrier is generated on the host
+class IRsend {
+public:
+    IRsend(uint16_t pin) {}
+    void begin() {}
+    void sendRaw(const uint16_t* buf, uint16_t len, uint16_t hz);
+
+    static uint32_t hostCodesSent;
+    static uint64_t hostMarkSpaceUs;  // Total duration of all sent codes
+};
+
+#endif
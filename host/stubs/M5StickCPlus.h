@@ -0,0 +1,171 @@
+#ifndef HOST_M5STICKCPLUS_H
+#define HOST_M5STICKCPLUS_H
+
+// Host stand-in for the M5StickC Plus library. The display draws into an
+// in-memory RGB565 framebuffer and counts draw calls and pixels, so
+// screens can be snapshotted and compared (see host/screens/); buttons
+// are pressed by the harness through hostPress(). TFT_eSPI/TFT_eSprite
+// keep the names the real display classes have.
+
+#include <Arduino.h>
+
+#define BLACK       0x0000
+#define NAVY        0x000F
+#define DARKGREEN   0x03E0
+#define DARKCYAN    0x03EF
+#define MAROON      0x7800
+#define PURPLE      0x780F
+#define OLIVE       0x7BE0
+#define LIGHTGREY   0xC618
+#define DARKGREY    0x7BEF
+#define BLUE        0x001F
+#define GREEN       0x07E0
+#define CYAN        0x07FF
+#define RED         0xF800
+#define MAGENTA     0xF81F
+#define YELLOW      0xFFE0
+#define WHITE       0xFFFF
+#define ORANGE      0xFD20
+#define GREENYELLOW 0xAFE5
+#define PINK        0xF81F
+
+#define TFT_WIDTH  135
+#define TFT_HEIGHT 240
+
+// Draw calls made on a display or sprite and the pixels they wrote
+// (after clipping) since the last hostResetStats()
+struct HostDrawStats {
+    uint32_t calls;
+    uint64_t pixels;
+};
+
+class TFT_eSPI {
+public:
+    TFT_eSPI();
+    void setRotation(uint8_t rotation);
+    int16_t width() { return screenWidth; }
+    int16_t height() { return screenHeight; }
+
+    void startWrite() {}
+    void endWrite() {}
+    void fillScreen(uint16_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void drawPixel(int32_t x, int32_t y, uint16_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint16_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint16_t color);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint16_t color);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    void setCursor(int16_t x, int16_t y);
+    int16_t getCursorX() { return cursorX; }
+    int16_t getCursorY() { return cursorY; }
+    void setTextSize(uint8_t size);
+    void setTextColor(uint16_t color);                      // Transparent background
+    void setTextColor(uint16_t color, uint16_t background);
+
+    // Text uses a 5x7 font in 6x8 cells and wraps at the right edge
+    size_t print(const char* s);
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(char c);
+    size_t print(int v);
+    size_t print(unsigned int v);
+    size_t print(long v);
+    size_t print(unsigned long v);
+    size_t print(double v, int decimals = 2);
+    size_t println() { return print("\n"); }
+    template <typename T> size_t println(T v) { return print(v) + println(); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    // RGB565 pixels, width() x height(), row-major
+    const uint16_t* hostPixels() { return pixels; }
+    const HostDrawStats& hostStats() { return stats; }
+    void hostResetStats();
+
+protected:
+    uint16_t* pixels;  // nullptr for a sprite without a buffer
+    int16_t screenWidth;
+    int16_t screenHeight;
+    HostDrawStats stats;
+
+    void fillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void drawChar(char c);
+
+private:
+    int16_t cursorX;
+    int16_t cursorY;
+    uint8_t textSize;
+    uint16_t textColor;
+    uint16_t textBackground;
+    bool textFill;
+};
+
+// Off-screen RGB565 buffer, drawn with the same calls as the screen
+class TFT_eSprite : public TFT_eSPI {
+public:
+    TFT_eSprite(TFT_eSPI* parent);
+    ~TFT_eSprite();
+    void setColorDepth(int8_t bits) {}
+    void* createSprite(int16_t width, int16_t height);
+    void deleteSprite();
+    void fillSprite(uint16_t color);
+    void pushSprite(int32_t x, int32_t y);
+
+private:
+    TFT_eSPI* parent;
+};
+
+class HostButton {
+public:
+    HostButton();
+    bool wasPressed() { return pressedEdge; }
+    bool wasReleased() { return false; }
+    bool isPressed() { return held; }
+    void hostPress();    // Reported by wasPressed() after the next update
+    void hostHold(bool down);
+    void read();         // Called by M5.update()
+
+private:
+    volatile bool pending;
+    volatile bool held;
+    bool pressedEdge;
+};
+
+class HostAxp {
+public:
+    HostAxp() { pending = 0; }
+    uint8_t GetBtnPress();        // 2 = short press, read once
+    void hostPress() { pending = 2; }
+    float GetBatVoltage() { return 4.1; }
+
+private:
+    volatile uint8_t pending;
+};
+
+class HostImu {
+public:
+    int Init() { return 0; }
+    void getAccelData(float* x, float* y, float* z);
+    void hostSetAccel(float x, float y, float z);
+
+private:
+    float accel[3] = {0.0, 0.0, 1.0};
+};
+
+class M5StickCPlus {
+public:
+    void begin(bool lcd = true, bool power = true, bool serial = true) {}
+    void update();
+
+    TFT_eSPI Lcd;
+    HostButton BtnA;
+    HostButton BtnB;
+    HostAxp Axp;
+    HostImu Imu;
+};
+
+extern M5StickCPlus M5;
+
+#endif
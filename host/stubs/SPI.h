@@ -0,0 +1,19 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+// The radio driver stub clocks its register traffic through transfer(),
+// out of line as on the device so the SPI profiler can wrap it; the bytes
+// themselves go nowhere
+#define HOST_SPI_BYTE_US 8  // Virtual-clock cost of one byte
+class SPIClass {
+public:
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+    uint8_t transfer(uint8_t data);
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+    WIFI_OFF,
+    WIFI_STA,
+    WIFI_AP,
+    WIFI_AP_STA
+} wifi_mode_t;
+
+class IPAddress {
+public:
+    IPAddress() : octets{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+    uint8_t operator[](int i) const { return octets[i]; }
+    String toString() const;
+
+private:
+    uint8_t octets[4];
+};
+
+// The soft AP "runs" on 192.168.4.1; the station count is set by the harness
+class WiFiClass {
+public:
+    WiFiClass() : apMode(WIFI_OFF), stations(0) {}
+    bool mode(wifi_mode_t mode) { apMode = mode; return true; }
+    bool softAP(const char* ssid, const char* password = nullptr) { return true; }
+    bool softAPdisconnect(bool wifiOff = false) { return true; }
+    IPAddress softAPIP() { return apMode == WIFI_OFF ? IPAddress() : IPAddress(192, 168, 4, 1); }
+    uint8_t softAPgetStationNum() { return stations; }
+
+    void hostSetStations(uint8_t count) { stations = count; }
+
+private:
+    wifi_mode_t apMode;
+    uint8_t stations;
+};
+
+extern WiFiClass WiFi;
+
+#endif
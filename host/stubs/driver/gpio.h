@@ -0,0 +1,19 @@
+#ifndef HOST_DRIVER_GPIO_H
+#define HOST_DRIVER_GPIO_H
+
+typedef int gpio_num_t;
+
+typedef enum {
+    GPIO_INTR_DISABLE,
+    GPIO_INTR_LOW_LEVEL = 4,
+    GPIO_INTR_HIGH_LEVEL = 5
+} gpio_int_type_t;
+
+#define GPIO_NUM_37 37
+#define GPIO_NUM_39 39
+
+inline int gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+#include <stdint.h>
+#include "driver/gpio.h"
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_GPIO
+} esp_sleep_wakeup_cause_t;
+
+// Light sleep is a plain wait for the armed timer; GPIO wakeups never fire
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_light_sleep_start();
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+
+#endif
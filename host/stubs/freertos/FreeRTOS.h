@@ -0,0 +1,57 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+// FreeRTOS primitives the firmware uses, backed by host threads. Queues
+// copy fixed-size items like the real ones; mutexes are non-recursive.
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+struct HostQueue;
+struct HostMutex;
+typedef HostQueue* QueueHandle_t;
+typedef HostMutex* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  pdTRUE
+#define portMAX_DELAY   0xFFFFFFFFUL
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait);
+BaseType_t xQueueReset(QueueHandle_t queue);
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth,
+                                   void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core);
+// Host threads cannot be killed: deleting another task is a no-op, so it
+// runs to completion
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+inline BaseType_t xPortGetCoreID() { return 1; }  // Everything runs as the loop task
+
+// Task list for stack telemetry: the loop task, plus any created tasks
+// while they run. Stack use isn't measured; high-water marks are nominal
+#define tskNO_AFFINITY 0x7FFFFFFF
+struct TaskStatus_t {
+    TaskHandle_t xHandle;
+    const char* pcTaskName;
+    uint32_t usStackHighWaterMark;
+    BaseType_t xCoreID;
+};
+UBaseType_t uxTaskGetSystemState(TaskStatus_t* status, UBaseType_t maxCount, uint32_t* totalRunTime);
+
+#endif
@@ -0,0 +1,556 @@
+// M5StickC Plus, CC1101, IR and WiFi models for host builds
+
+#include <M5StickCPlus.h>
+#include <ELECHOUSE_CC1101_SRC_DRV.h>
+#include <IRsend.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include "host_font.h"
+
+M5StickCPlus M5;
+ELECHOUSE_CC1101 ELECHOUSE_cc1101;
+SPIClass SPI;
+WiFiClass WiFi;
+
+void M5StickCPlus::update() {
+    BtnA.read();
+    BtnB.read();
+}
+
+// Display
+
+static uint16_t hostScreen[TFT_WIDTH * TFT_HEIGHT];
+
+TFT_eSPI::TFT_eSPI() {
+    pixels = hostScreen;
+    screenWidth = TFT_WIDTH;
+    screenHeight = TFT_HEIGHT;
+    stats = {0, 0};
+    cursorX = 0;
+    cursorY = 0;
+    textSize = 1;
+    textColor = WHITE;
+    textBackground = BLACK;
+    textFill = false;
+}
+
+// The framebuffer keeps its size; only the row length changes
+void TFT_eSPI::setRotation(uint8_t rotation) {
+    bool landscape = rotation & 1;
+    screenWidth = landscape ? TFT_HEIGHT : TFT_WIDTH;
+    screenHeight = landscape ? TFT_WIDTH : TFT_HEIGHT;
+}
+
+void TFT_eSPI::hostResetStats() {
+    stats = {0, 0};
+}
+
+void TFT_eSPI::fillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (pixels == nullptr) return;
+    int32_t x0 = max(x, (int32_t)0);
+    int32_t y0 = max(y, (int32_t)0);
+    int32_t x1 = min(x + w, (int32_t)screenWidth);
+    int32_t y1 = min(y + h, (int32_t)screenHeight);
+    if (x0 >= x1 || y0 >= y1) return;
+    for (int32_t row = y0; row < y1; row++) {
+        uint16_t* line = pixels + row * screenWidth;
+        for (int32_t col = x0; col < x1; col++) {
+            line[col] = color;
+        }
+    }
+    stats.pixels += (uint64_t)(x1 - x0) * (y1 - y0);
+}
+
+void TFT_eSPI::fillScreen(uint16_t color) {
+    stats.calls++;
+    fillClipped(0, 0, screenWidth, screenHeight, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    stats.calls++;
+    fillClipped(x, y, w, h, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    stats.calls++;
+    fillClipped(x, y, w, 1, color);
+    fillClipped(x, y + h - 1, w, 1, color);
+    fillClipped(x, y + 1, 1, h - 2, color);
+    fillClipped(x + w - 1, y + 1, 1, h - 2, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint16_t color) {
+    stats.calls++;
+    fillClipped(x, y, 1, 1, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
+    stats.calls++;
+    // Bresenham
+    int32_t dx = abs(x1 - x0);
+    int32_t dy = -abs(y1 - y0);
+    int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx + dy;
+    while (true) {
+        fillClipped(x0, y0, 1, 1, color);
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint16_t color) {
+    stats.calls++;
+    fillClipped(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint16_t color) {
+    stats.calls++;
+    fillClipped(x, y, 1, h, color);
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint16_t color) {
+    stats.calls++;
+    for (int32_t dy = -r; dy <= r; dy++) {
+        int32_t dx = (int32_t)sqrt((double)(r * r - dy * dy));
+        fillClipped(x - dx, y + dy, 2 * dx + 1, 1, color);
+    }
+}
+
+void TFT_eSPI::drawCircle(int32_t x, int32_t y, int32_t r, uint16_t color) {
+    stats.calls++;
+    // Midpoint circle, one pixel per octant step
+    int32_t dx = r;
+    int32_t dy = 0;
+    int32_t err = 1 - r;
+    while (dx >= dy) {
+        const int32_t points[8][2] = {
+            {dx, dy}, {dy, dx}, {-dy, dx}, {-dx, dy},
+            {-dx, -dy}, {-dy, -dx}, {dy, -dx}, {dx, -dy},
+        };
+        for (const auto& p : points) {
+            fillClipped(x + p[0], y + p[1], 1, 1, color);
+        }
+        dy++;
+        if (err < 0) {
+            err += 2 * dy + 1;
+        } else {
+            dx--;
+            err += 2 * (dy - dx) + 1;
+        }
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    stats.calls++;
+    if (pixels == nullptr) return;
+    for (int32_t row = 0; row < h; row++) {
+        int32_t py = y + row;
+        if (py < 0 || py >= screenHeight) continue;
+        for (int32_t col = 0; col < w; col++) {
+            int32_t px = x + col;
+            if (px < 0 || px >= screenWidth) continue;
+            pixels[py * screenWidth + px] = data[row * w + col];
+            stats.pixels++;
+        }
+    }
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+}
+
+void TFT_eSPI::setTextSize(uint8_t size) {
+    textSize = size > 0 ? size : 1;
+}
+
+void TFT_eSPI::setTextColor(uint16_t color) {
+    textColor = color;
+    textFill = false;
+}
+
+void TFT_eSPI::setTextColor(uint16_t color, uint16_t background) {
+    textColor = color;
+    textBackground = background;
+    textFill = true;
+}
+
+// One 6x8 cell at the cursor, scaled by the text size
+void TFT_eSPI::drawChar(char c) {
+    int cell = 6 * textSize;
+    if (cursorX + cell > screenWidth) {
+        cursorX = 0;
+        cursorY += 8 * textSize;
+    }
+    bool known = (uint8_t)c >= HOST_FONT_FIRST && (uint8_t)c <= HOST_FONT_LAST;
+    for (int col = 0; col < 6; col++) {
+        uint8_t bits = (known && col < 5) ? hostFont5x7[(uint8_t)c - HOST_FONT_FIRST][col] : 0;
+        for (int row = 0; row < 8; row++) {
+            bool on = bits & (1 << row);
+            if (!on && !textFill) continue;
+            fillClipped(cursorX + col * textSize, cursorY + row * textSize, textSize, textSize,
+                        on ? textColor : textBackground);
+        }
+    }
+    cursorX += cell;
+}
+
+size_t TFT_eSPI::print(const char* s) {
+    stats.calls++;
+    size_t n = 0;
+    for (; s[n] != '\0'; n++) {
+        if (s[n] == '\n') {
+            cursorX = 0;
+            cursorY += 8 * textSize;
+        } else if (s[n] != '\r') {
+            drawChar(s[n]);
+        }
+    }
+    return n;
+}
+
+size_t TFT_eSPI::print(char c) {
+    char s[2] = {c, '\0'};
+    return print(s);
+}
+
+size_t TFT_eSPI::print(int v) {
+    return printf("%d", v);
+}
+
+size_t TFT_eSPI::print(unsigned int v) {
+    return printf("%u", v);
+}
+
+size_t TFT_eSPI::print(long v) {
+    return printf("%ld", v);
+}
+
+size_t TFT_eSPI::print(unsigned long v) {
+    return printf("%lu", v);
+}
+
+size_t TFT_eSPI::print(double v, int decimals) {
+    return printf("%.*f", decimals, v);
+}
+
+size_t TFT_eSPI::printf(const char* format, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return print(buf);
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* parent) {
+    this->parent = parent;
+    pixels = nullptr;
+    screenWidth = 0;
+    screenHeight = 0;
+}
+
+TFT_eSprite::~TFT_eSprite() {
+    deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t width, int16_t height) {
+    deleteSprite();
+    pixels = (uint16_t*)calloc((size_t)width * height, sizeof(uint16_t));
+    if (pixels != nullptr) {
+        screenWidth = width;
+        screenHeight = height;
+    }
+    return pixels;
+}
+
+void TFT_eSprite::deleteSprite() {
+    free(pixels);
+    pixels = nullptr;
+    screenWidth = 0;
+    screenHeight = 0;
+}
+
+void TFT_eSprite::fillSprite(uint16_t color) {
+    fillRect(0, 0, screenWidth, screenHeight, color);
+}
+
+// Counted as one call on the parent
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    if (pixels != nullptr) parent->pushImage(x, y, screenWidth, screenHeight, pixels);
+}
+
+// Buttons and sensors
+
+HostButton::HostButton() {
+    pending = false;
+    held = false;
+    pressedEdge = false;
+}
+
+void HostButton::hostPress() {
+    pending = true;
+}
+
+void HostButton::hostHold(bool down) {
+    if (down && !held) pending = true;
+    held = down;
+}
+
+void HostButton::read() {
+    pressedEdge = pending;
+    pending = false;
+}
+
+uint8_t HostAxp::GetBtnPress() {
+    uint8_t press = pending;
+    pending = 0;
+    return press;
+}
+
+void HostImu::getAccelData(float* x, float* y, float* z) {
+    *x = accel[0];
+    *y = accel[1];
+    *z = accel[2];
+}
+
+void HostImu::hostSetAccel(float x, float y, float z) {
+    accel[0] = x;
+    accel[1] = y;
+    accel[2] = z;
+}
+
+// CC1101
+
+// Status registers, read with the burst bit set
+#define HOST_CC1101_RSSI    0x34
+#define HOST_CC1101_RXBYTES 0x3B
+#define HOST_CC1101_READ    0x80
+#define HOST_CC1101_BURST   0x40
+
+#define HOST_CC1101_INIT_WRITES 24  // RegConfigSettings() after the reset strobe
+
+ELECHOUSE_CC1101::ELECHOUSE_CC1101() {
+    present = true;
+    ssPin = 0;
+    gdo0Pin = 0;
+    modulation = 0;
+    state = CC1101_SIDLE;
+    mhz = 433.92;
+    memset(regs, 0, sizeof(regs));
+    memset(paTable, 0, sizeof(paTable));
+    paBand = -1;
+    regs[CC1101_FSCTRL1] = 0x06;  // SmartRC defaults that applyConfig() keeps
+    regs[CC1101_MDMCFG2] = 0x30;
+    noiseFloor = -98;
+    noiseSpread = 6;
+    noiseState = 12345;
+    carrierCount = 0;
+    rssiSource = nullptr;
+    rxLength = 0;
+    txBytes = 0;
+}
+
+// One chip select: header byte, then data bytes. Register contents are
+// handled by the callers; this only puts the traffic on the bus
+void ELECHOUSE_CC1101::busTransaction(byte header, int dataBytes) {
+    digitalWrite(ssPin, LOW);
+    SPI.transfer(header);
+    for (int i = 0; i < dataBytes; i++) {
+        SPI.transfer(0);
+    }
+    digitalWrite(ssPin, HIGH);
+}
+
+// setPA(): the whole PA table, then FREND0
+void ELECHOUSE_CC1101::writePaTable() {
+    busTransaction(CC1101_PATABLE | HOST_CC1101_BURST, 8);
+    busTransaction(CC1101_FREND0, 1);
+}
+
+void ELECHOUSE_CC1101::Init() {
+    SpiStrobe(CC1101_SRES);
+    for (int i = 0; i < HOST_CC1101_INIT_WRITES; i++) {
+        busTransaction(i, 1);
+    }
+    writePaTable();
+    state = CC1101_SIDLE;
+}
+
+// FREQ2..0, then Calibrate(): FSCTRL0 and TEST0, the FSCAL2 check in the
+// upper part of each band, and a PA table rewrite when the band changes
+void ELECHOUSE_CC1101::setMHZ(float mhz) {
+    this->mhz = mhz;
+    busTransaction(CC1101_FREQ2, 1);
+    busTransaction(CC1101_FREQ1, 1);
+    busTransaction(CC1101_FREQ0, 1);
+    busTransaction(CC1101_FSCTRL0, 1);
+    busTransaction(CC1101_TEST0, 1);
+    int band = (mhz < 348.0) ? 0 : (mhz < 464.0) ? 1 : (mhz < 900.0) ? 2 : 3;
+    static const float upperHalf[] = {322.88, 430.5, 861.0, 905.0};
+    if (mhz >= upperHalf[band]) {
+        busTransaction(CC1101_FSCAL2 | HOST_CC1101_READ | HOST_CC1101_BURST, 1);
+        if (band != paBand) writePaTable();
+    }
+    paBand = band;
+}
+
+// Split_MDMCFG2() reads the register back, then the write and setPA()
+void ELECHOUSE_CC1101::setModulation(byte modulation) {
+    this->modulation = modulation;
+    busTransaction(CC1101_MDMCFG2 | HOST_CC1101_READ | HOST_CC1101_BURST, 1);
+    busTransaction(CC1101_MDMCFG2, 1);
+    writePaTable();
+}
+
+// Split_MDMCFG4() reads the register back, then MDMCFG4 and MDMCFG3
+void ELECHOUSE_CC1101::setDRate(float kbaud) {
+    busTransaction(CC1101_MDMCFG4 | HOST_CC1101_READ | HOST_CC1101_BURST, 1);
+    busTransaction(CC1101_MDMCFG4, 1);
+    busTransaction(CC1101_MDMCFG3, 1);
+}
+
+void ELECHOUSE_CC1101::setRxBW(float khz) {
+    busTransaction(CC1101_MDMCFG4 | HOST_CC1101_READ | HOST_CC1101_BURST, 1);
+    busTransaction(CC1101_MDMCFG4, 1);
+}
+
+void ELECHOUSE_CC1101::SetRx() {
+    SpiStrobe(CC1101_SIDLE);
+    SpiStrobe(CC1101_SRX);
+}
+
+void ELECHOUSE_CC1101::SetTx() {
+    SpiStrobe(CC1101_SIDLE);
+    SpiStrobe(CC1101_STX);
+}
+
+int ELECHOUSE_CC1101::getRssi() {
+    busTransaction(HOST_CC1101_RSSI | HOST_CC1101_READ | HOST_CC1101_BURST, 1);
+    if (rssiSource != nullptr) return rssiSource(mhz);
+    noiseState = noiseState * 1664525 + 1013904223;
+    int rssi = noiseFloor + (int)((noiseState >> 16) % (uint32_t)(noiseSpread + 1));
+
+    // Strongest carrier within its bandwidth, with a linear roll-off
+    for (int i = 0; i < carrierCount; i++) {
+        float offset = fabsf(mhz - carriers[i].mhz);
+        if (offset > carriers[i].width) continue;
+        int level = carriers[i].dbm - (int)(20.0 * offset / carriers[i].width);
+        if (level > rssi) rssi = level;
+    }
+    return rssi;
+}
+
+bool ELECHOUSE_CC1101::CheckRxFifo(int t) {
+    SpiReadStatus(HOST_CC1101_RXBYTES);
+    return state == CC1101_SRX && rxLength > 0;
+}
+
+// Length byte, payload, then the two status bytes; flush and back to RX
+byte ELECHOUSE_CC1101::ReceiveData(byte* rxBuffer) {
+    SpiReadStatus(HOST_CC1101_RXBYTES);
+    busTransaction(CC1101_RXFIFO | HOST_CC1101_READ, 1);
+    busTransaction(CC1101_RXFIFO | HOST_CC1101_READ | HOST_CC1101_BURST, rxLength + 2);
+    SpiStrobe(CC1101_SFRX);
+    SpiStrobe(CC1101_SRX);
+    byte length = rxLength;
+    memcpy(rxBuffer, rxPacket, length);
+    rxLength = 0;
+    return length;
+}
+
+void ELECHOUSE_CC1101::SendData(byte* txBuffer, byte size) {
+    busTransaction(CC1101_TXFIFO, 1);
+    busTransaction(CC1101_TXFIFO | HOST_CC1101_BURST, size);
+    SpiStrobe(CC1101_SIDLE);
+    SpiStrobe(CC1101_STX);
+    SpiStrobe(CC1101_SFTX);
+    state = CC1101_SIDLE;  // TXOFF_MODE after the packet
+    txBytes += size;
+}
+
+void ELECHOUSE_CC1101::SpiStrobe(byte strobe) {
+    busTransaction(strobe, 0);
+    if (strobe == CC1101_SRX || strobe == CC1101_STX || strobe == CC1101_SIDLE) {
+        state = strobe;
+    }
+}
+
+void ELECHOUSE_CC1101::SpiWriteReg(byte addr, byte value) {
+    busTransaction(addr, 1);
+    if (addr < sizeof(regs)) regs[addr] = value;
+}
+
+void ELECHOUSE_CC1101::SpiWriteBurstReg(byte addr, byte* buffer, byte num) {
+    busTransaction(addr | HOST_CC1101_BURST, num);
+    if (addr == CC1101_PATABLE) {
+        memcpy(paTable, buffer, min((size_t)num, sizeof(paTable)));
+        return;
+    }
+    for (int i = 0; i < num && addr + i < (int)sizeof(regs); i++) {
+        regs[addr + i] = buffer[i];
+    }
+}
+
+byte ELECHOUSE_CC1101::SpiReadReg(byte addr) {
+    busTransaction(addr | HOST_CC1101_READ, 1);
+    return addr < sizeof(regs) ? regs[addr] : 0;
+}
+
+void ELECHOUSE_CC1101::SpiReadBurstReg(byte addr, byte* buffer, byte num) {
+    busTransaction(addr | HOST_CC1101_READ | HOST_CC1101_BURST, num);
+    for (int i = 0; i < num; i++) {
+        buffer[i] = (addr + i < (int)sizeof(regs)) ? regs[addr + i] : 0;
+    }
+}
+
+byte ELECHOUSE_CC1101::SpiReadStatus(byte addr) {
+    busTransaction(addr | HOST_CC1101_READ | HOST_CC1101_BURST, 1);
+    return 0;
+}
+
+void ELECHOUSE_CC1101::hostSetNoise(int floorDbm, int spreadDb) {
+    noiseFloor = floorDbm;
+    noiseSpread = spreadDb > 0 ? spreadDb : 0;
+}
+
+bool ELECHOUSE_CC1101::hostAddCarrier(float mhz, int dbm, float widthMHz) {
+    if (carrierCount >= HOST_CC1101_MAX_CARRIERS || widthMHz <= 0) return false;
+    carriers[carrierCount].mhz = mhz;
+    carriers[carrierCount].dbm = dbm;
+    carriers[carrierCount].width = widthMHz;
+    carrierCount++;
+    return true;
+}
+
+void ELECHOUSE_CC1101::hostClearCarriers() {
+    carrierCount = 0;
+}
+
+void ELECHOUSE_CC1101::hostQueuePacket(const byte* data, byte length) {
+    rxLength = min((size_t)length, sizeof(rxPacket));
+    memcpy(rxPacket, data, rxLength);
+}
+
+// IR
+
+uint32_t IRsend::hostCodesSent = 0;
+uint64_t IRsend::hostMarkSpaceUs = 0;
+
+void IRsend::sendRaw(const uint16_t* buf, uint16_t len, uint16_t hz) {
+    hostCodesSent++;
+    for (uint16_t i = 0; i < len; i++) {
+        hostMarkSpaceUs += buf[i];
+    }
+}
+
+// WiFi
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(buf);
+}
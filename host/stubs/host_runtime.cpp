@@ -0,0 +1,332 @@
+// Arduino core, FreeRTOS and ESP-IDF pieces for host builds
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <SPI.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+volatile uint8_t hostPinLevel[HOST_PIN_COUNT];
+uint32_t hostPinWrites[HOST_PIN_COUNT];
+HostPinSource hostPinSource = nullptr;
+HostPinSink hostPinSink = nullptr;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+static bool virtualClock = false;
+static uint64_t virtualUs = 0;
+
+static uint64_t elapsedUs() {
+    if (virtualClock) {
+        virtualUs += HOST_VIRTUAL_READ_US;
+        return virtualUs;
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+}
+
+uint64_t hostNowUs() {
+    if (virtualClock) return virtualUs;
+    return elapsedUs();
+}
+
+void hostUseVirtualClock(bool enabled) {
+    // From zero, not the real time so far, or boot timings would vary with
+    // how long the process took to start
+    if (enabled && !virtualClock) virtualUs = 0;
+    virtualClock = enabled;
+}
+
+unsigned long millis() {
+    return (unsigned long)(elapsedUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)elapsedUs();
+}
+
+void delay(unsigned long ms) {
+    if (virtualClock) {
+        virtualUs += (uint64_t)ms * 1000;
+        return;
+    }
+    if (ms > 0) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    if (virtualClock) {
+        virtualUs += us;
+        return;
+    }
+    // Busy-wait like the ROM delay, so short timing loops stay accurate
+    uint64_t end = elapsedUs() + us;
+    while (elapsedUs() < end) {
+    }
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+// Out of line and away from its callers, so --wrap can reach it. On the
+// virtual clock each byte takes as long as at SPIClass's default 1 MHz
+uint8_t SPIClass::transfer(uint8_t data) {
+    if (virtualClock) virtualUs += HOST_SPI_BYTE_US;
+    return 0;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin >= HOST_PIN_COUNT) return;
+    hostPinLevel[pin] = value ? HIGH : LOW;
+    hostPinWrites[pin]++;
+    if (hostPinSink != nullptr) hostPinSink(pin, value);
+}
+
+int digitalRead(uint8_t pin) {
+    if (hostPinSource != nullptr) return hostPinSource(pin);
+    return pin < HOST_PIN_COUNT ? hostPinLevel[pin] : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+    return 0;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Same LCG on every run so host results are reproducible
+static uint32_t randomState = 1;
+
+void randomSeed(unsigned long seed) {
+    if (seed != 0) randomState = seed;
+}
+
+long random(long max) {
+    if (max <= 0) return 0;
+    randomState = randomState * 1103515245 + 12345;
+    return (long)((randomState >> 1) % (unsigned long)max);
+}
+
+long random(long min, long max) {
+    if (min >= max) return min;
+    return min + random(max - min);
+}
+
+String::String(double v, unsigned int decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    s = buf;
+}
+
+void String::trim() {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    size_t last = s.find_last_not_of(" \t\r\n");
+    s = (first == std::string::npos) ? std::string() : s.substr(first, last - first + 1);
+}
+
+static bool serialQuiet() {
+    static int quiet = -1;
+    if (quiet < 0) quiet = getenv("HOST_QUIET") != nullptr;
+    return quiet;
+}
+
+size_t HardwareSerial::print(const char* s) {
+    if (serialQuiet()) return strlen(s);
+    return fputs(s, stdout) >= 0 ? strlen(s) : 0;
+}
+
+size_t HardwareSerial::print(char c) {
+    if (!serialQuiet()) putchar(c);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t len) {
+    if (serialQuiet()) return len;
+    return fwrite(data, 1, len, stdout);
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = serialQuiet() ? vsnprintf(nullptr, 0, format, args) : vprintf(format, args);
+    va_end(args);
+    return n > 0 ? n : 0;
+}
+
+// FreeRTOS
+
+// Ring of length items, allocated once as FreeRTOS does in xQueueCreate()
+struct HostQueue {
+    std::mutex lock;
+    std::vector<uint8_t> storage;
+    size_t length;
+    size_t itemSize;
+    size_t head;
+    size_t count;
+};
+
+struct HostMutex {
+    std::timed_mutex lock;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    HostQueue* queue = new HostQueue();
+    queue->storage.resize((size_t)length * itemSize);
+    queue->length = length;
+    queue->itemSize = itemSize;
+    queue->head = 0;
+    queue->count = 0;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+    std::lock_guard<std::mutex> guard(queue->lock);
+    if (queue->count >= queue->length) return pdFALSE;
+    size_t tail = (queue->head + queue->count) % queue->length;
+    memcpy(queue->storage.data() + tail * queue->itemSize, item, queue->itemSize);
+    queue->count++;
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+    std::lock_guard<std::mutex> guard(queue->lock);
+    if (queue->count == 0) return pdFALSE;
+    memcpy(item, queue->storage.data() + queue->head * queue->itemSize, queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> guard(queue->lock);
+    queue->head = 0;
+    queue->count = 0;
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new HostMutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t wait) {
+    if (wait == portMAX_DELAY) {
+        mutex->lock.lock();
+        return pdTRUE;
+    }
+    return mutex->lock.try_lock_for(std::chrono::milliseconds(wait)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+    mutex->lock.unlock();
+    return pdTRUE;
+}
+
+struct HostTask {
+    const char* name;
+    uint32_t stackDepth;
+    BaseType_t core;
+};
+
+static std::mutex taskLock;
+static std::vector<HostTask> runningTasks;
+static thread_local const char* currentTaskName = nullptr;
+
+static void endTask() {
+    std::lock_guard<std::mutex> guard(taskLock);
+    for (size_t i = 0; i < runningTasks.size(); i++) {
+        if (runningTasks[i].name == currentTaskName) {
+            runningTasks.erase(runningTasks.begin() + i);
+            break;
+        }
+    }
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth,
+                                   void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core) {
+    static uintptr_t tasksCreated = 0;
+    uintptr_t id;
+    {
+        std::lock_guard<std::mutex> guard(taskLock);
+        runningTasks.push_back({name, stackDepth, core});
+        id = ++tasksCreated;
+    }
+    std::thread thread([task, param, name]() {
+        currentTaskName = name;
+        task(param);
+        endTask();
+    });
+    // On the virtual clock the creator's delay() loop would race the task
+    // for simulated time, so the task runs to completion first
+    if (virtualClock) {
+        thread.join();
+    } else {
+        thread.detach();
+    }
+    // Non-null, so that deleting it is not taken for a self-delete
+    if (handle != nullptr) *handle = (TaskHandle_t)id;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == nullptr) {
+        endTask();
+        pthread_exit(nullptr);
+    }
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t* status, UBaseType_t maxCount, uint32_t* totalRunTime) {
+    std::lock_guard<std::mutex> guard(taskLock);
+    if (runningTasks.size() + 1 > maxCount) return 0;
+    status[0] = {nullptr, "loopTask", 5000, 1};
+    for (size_t i = 0; i < runningTasks.size(); i++) {
+        status[i + 1] = {nullptr, runningTasks[i].name, runningTasks[i].stackDepth / 2, runningTasks[i].core};
+    }
+    if (totalRunTime != nullptr) *totalRunTime = 0;
+    return runningTasks.size() + 1;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks);
+}
+
+// ESP-IDF
+
+int64_t esp_timer_get_time() {
+    return (int64_t)elapsedUs();
+}
+
+static uint64_t sleepTimerUs = 0;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+    sleepTimerUs = us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+    return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+    if (virtualClock) {
+        virtualUs += sleepTimerUs;
+        return ESP_OK;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(sleepTimerUs));
+    return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+    return ESP_SLEEP_WAKEUP_TIMER;
+}
@@ -0,0 +1,470 @@
+// AsyncTCP and ESPAsyncWebServer models for host builds
+
+#include <ESPAsyncWebServer.h>
+
+#define HOST_FILL_CHUNK 1460  // One TCP segment per _fillBuffer() call, as on the device
+
+// AsyncClient
+
+AsyncClient::AsyncClient() {
+    connected = true;
+    window = HOST_TCP_WINDOW;
+    inFlight = 0;
+    disconnectArg = nullptr;
+    ackArg = nullptr;
+    pollArg = nullptr;
+}
+
+size_t AsyncClient::add(const char* data, size_t size, uint8_t flags) {
+    if (!connected) return 0;
+    size_t n = min(size, space());
+    hostOutput.append(data, n);
+    inFlight += n;
+    return n;
+}
+
+void AsyncClient::close(bool now) {
+    if (!connected) return;
+    connected = false;
+    if (disconnectCb) disconnectCb(disconnectArg, this);
+}
+
+void AsyncClient::hostAck(size_t len) {
+    inFlight -= min(len, inFlight);
+    if (ackCb) ackCb(ackArg, this, len, 0);
+}
+
+void AsyncClient::hostPoll() {
+    if (pollCb) pollCb(pollArg, this);
+}
+
+// Responses
+
+static const char* reasonPhrase(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 202: return "Accepted";
+        case 206: return "Partial Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 409: return "Conflict";
+        case 413: return "Payload Too Large";
+        case 415: return "Unsupported Media Type";
+        case 416: return "Range Not Satisfiable";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+AsyncWebServerResponse::AsyncWebServerResponse() {
+    _code = 0;
+    _contentLength = 0;
+    _sendContentLength = true;
+    _chunked = false;
+    _headLength = 0;
+    _state = RESPONSE_SETUP;
+}
+
+void AsyncWebServerResponse::addHeader(const String& name, const String& value) {
+    _headers.push_back(std::make_pair(name, value));
+}
+
+String AsyncWebServerResponse::_assembleHead(uint8_t version) {
+    char line[128];
+    snprintf(line, sizeof(line), "HTTP/1.%d %d %s\r\n", version, _code, reasonPhrase(_code));
+    std::string head = line;
+    if (_sendContentLength) {
+        snprintf(line, sizeof(line), "Content-Length: %u\r\n", (unsigned)_contentLength);
+        head += line;
+    }
+    if (_contentType.length() > 0) {
+        head += "Content-Type: ";
+        head += _contentType.c_str();
+        head += "\r\n";
+    }
+    for (const auto& header : _headers) {
+        head += header.first.c_str();
+        head += ": ";
+        head += header.second.c_str();
+        head += "\r\n";
+    }
+    head += "\r\n";
+    _headLength = head.length();
+    return String(head);
+}
+
+static void recordHead(AsyncWebServerRequest* request, int code, const String& contentType,
+                       const std::vector<std::pair<String, String>>& headers) {
+    HostResponse* result = request->hostResult;
+    if (result == nullptr) return;
+    result->code = code;
+    result->contentType = contentType.c_str();
+    for (const auto& header : headers) {
+        result->headers += header.first.c_str();
+        result->headers += ": ";
+        result->headers += header.second.c_str();
+        result->headers += "\r\n";
+    }
+}
+
+void AsyncWebServerResponse::_respond(AsyncWebServerRequest* request) {
+    recordHead(request, _code, _contentType, _headers);
+    _state = RESPONSE_END;
+}
+
+void AsyncAbstractResponse::_respond(AsyncWebServerRequest* request) {
+    recordHead(request, _code, _contentType, _headers);
+
+    // Drain the body the way the server would, one segment at a time
+    uint8_t chunk[HOST_FILL_CHUNK];
+    size_t total = 0;
+    while (_chunked || total < _contentLength) {
+        size_t want = _chunked ? sizeof(chunk) : min(sizeof(chunk), _contentLength - total);
+        size_t n = _fillBuffer(chunk, want);
+        if (!request->client()->connected) {
+            if (request->hostResult != nullptr) request->hostResult->aborted = true;
+            break;
+        }
+        if (n == 0) break;
+        total += n;
+        if (request->hostResult != nullptr) {
+            request->hostResult->body.append((const char*)chunk, n);
+            if (request->hostResult->onSegment) request->hostResult->onSegment(total);
+        }
+    }
+    _state = RESPONSE_END;
+}
+
+AsyncBasicResponse::AsyncBasicResponse(int code, const String& contentType, const String& content) {
+    _code = code;
+    _contentType = contentType;
+    this->content = content;
+    _contentLength = content.length();
+}
+
+void AsyncBasicResponse::_respond(AsyncWebServerRequest* request) {
+    AsyncWebServerResponse::_respond(request);
+    if (request->hostResult != nullptr) request->hostResult->body = content.c_str();
+}
+
+AsyncCallbackResponse::AsyncCallbackResponse(const String& contentType, size_t len,
+                                             AwsResponseFiller callback, bool chunked) {
+    _code = 200;
+    _contentType = contentType;
+    _contentLength = len;
+    _chunked = chunked;
+    _sendContentLength = !chunked;
+    filler = callback;
+    filled = 0;
+}
+
+size_t AsyncCallbackResponse::_fillBuffer(uint8_t* buf, size_t maxLen) {
+    size_t n = filler(buf, maxLen, filled);
+    filled += n;
+    return n;
+}
+
+AsyncProgmemResponse::AsyncProgmemResponse(int code, const String& contentType,
+                                           const uint8_t* content, size_t len) {
+    _code = code;
+    _contentType = contentType;
+    _contentLength = len;
+    this->content = content;
+    offset = 0;
+}
+
+size_t AsyncProgmemResponse::_fillBuffer(uint8_t* buf, size_t maxLen) {
+    size_t n = min(maxLen, _contentLength - offset);
+    memcpy(buf, content + offset, n);
+    offset += n;
+    return n;
+}
+
+AsyncResponseStream::AsyncResponseStream(const String& contentType) {
+    _code = 200;
+    _contentType = contentType;
+    offset = 0;
+}
+
+size_t AsyncResponseStream::write(const uint8_t* data, size_t len) {
+    buffer.append((const char*)data, len);
+    _contentLength = buffer.length();
+    return len;
+}
+
+size_t AsyncResponseStream::_fillBuffer(uint8_t* buf, size_t maxLen) {
+    size_t n = min(maxLen, buffer.length() - offset);
+    memcpy(buf, buffer.data() + offset, n);
+    offset += n;
+    return n;
+}
+
+// Requests
+
+AsyncWebServerRequest::AsyncWebServerRequest(WebRequestMethodComposite method, const char* url) {
+    tcp = new AsyncClient();
+    tcpTaken = false;
+    requestMethod = method;
+    requestUrl = url;
+    hostDropAt = SIZE_MAX;
+    hostResult = nullptr;
+    hostDeleted = nullptr;
+    response = nullptr;
+}
+
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+    // The library deletes a request when its connection closes
+    if (disconnectHandler) disconnectHandler();
+    for (AsyncWebParameter* param : params) {
+        delete param;
+    }
+    delete response;
+    if (!tcpTaken) delete tcp;
+    if (hostDeleted != nullptr) *hostDeleted = true;
+}
+
+bool AsyncWebServerRequest::hasParam(const char* name, bool post, bool file) {
+    return getParam(name, post, file) != nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(const char* name, bool post, bool file) {
+    for (AsyncWebParameter* param : params) {
+        if (param->isPost() == post && param->name() == name) return param;
+    }
+    return nullptr;
+}
+
+bool AsyncWebServerRequest::hasHeader(const char* name) {
+    for (const auto& header : headers) {
+        if (strcasecmp(header.first.c_str(), name) == 0) return true;
+    }
+    return false;
+}
+
+String AsyncWebServerRequest::header(const char* name) {
+    for (const auto& header : headers) {
+        if (strcasecmp(header.first.c_str(), name) == 0) return header.second;
+    }
+    return String();
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response) {
+    if (this->response != nullptr) {
+        delete response;  // Only the first response counts, as in the library
+        return;
+    }
+    this->response = response;
+    if (!response->_sourceValid()) {
+        delete response;
+        this->response = new AsyncBasicResponse(500);
+    }
+
+    this->response->_respond(this);
+    if (this->response->_state == RESPONSE_WAIT_ACK) {
+        // Headers went out on the connection; the peer acknowledges them
+        // at once and the response may take the connection (and delete
+        // this request) in _ack()
+        if (hostResult != nullptr) {
+            hostResult->code = this->response->_code;
+            hostResult->contentType = this->response->_contentType.c_str();
+            hostResult->stream = true;
+        }
+        tcpTaken = true;
+        size_t head = this->response->_headLength;
+        this->response->_ack(this, head, 0);
+    }
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content) {
+    send(new AsyncBasicResponse(code, contentType, content));
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType,
+                                                             const String& content) {
+    return new AsyncBasicResponse(code, contentType, content);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(const String& contentType, size_t len,
+                                                             AwsResponseFiller callback,
+                                                             AwsTemplateProcessor templateCallback) {
+    return new AsyncCallbackResponse(contentType, len, callback, false);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const String& contentType,
+                                                                    AwsResponseFiller callback,
+                                                                    AwsTemplateProcessor templateCallback) {
+    return new AsyncCallbackResponse(contentType, 0, callback, true);
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const String& contentType, size_t bufferSize) {
+    return new AsyncResponseStream(contentType);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const String& contentType,
+                                                               const uint8_t* content, size_t len,
+                                                               AwsTemplateProcessor callback) {
+    return new AsyncProgmemResponse(code, contentType, content, len);
+}
+
+void AsyncWebServerRequest::hostAddParam(const char* name, const char* value, bool post) {
+    params.push_back(new AsyncWebParameter(name, value, post));
+}
+
+void AsyncWebServerRequest::hostAddHeader(const char* name, const char* value) {
+    headers.push_back(std::make_pair(String(name), String(value)));
+}
+
+void AsyncWebServerRequest::hostSetBody(const char* contentType, const uint8_t* data, size_t len) {
+    requestContentType = contentType;
+    hostBody.assign((const char*)data, len);
+}
+
+// Handlers
+
+AsyncCallbackWebHandler::AsyncCallbackWebHandler(const String& uri, WebRequestMethodComposite method,
+                                                 ArRequestHandlerFunction onRequest,
+                                                 ArUploadHandlerFunction onUpload,
+                                                 ArBodyHandlerFunction onBody) {
+    this->uri = uri;
+    this->method = method;
+    this->onRequest = onRequest;
+    this->onUpload = onUpload;
+    this->onBody = onBody;
+}
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest* request) {
+    if (!(method & request->method())) return false;
+    std::string url = request->url().c_str();
+    std::string prefix = uri.c_str();
+    return url == prefix || url.compare(0, prefix.length() + 1, prefix + "/") == 0;
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest* request) {
+    if (onRequest) {
+        onRequest(request);
+    } else {
+        request->send(500);
+    }
+}
+
+void AsyncCallbackWebHandler::handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                                         size_t index, size_t total) {
+    if (onBody) onBody(request, data, len, index, total);
+}
+
+// Server
+
+static bool isParamChar(char c) {
+    return c != '\0' && c != '{' && c != '[' && c != '&' && c != '=';
+}
+
+// Bodies the library parses as a form instead of handing them over
+static bool isPlainPost(const String& contentType, const std::string& body) {
+    if (contentType.startsWith("application/x-www-form-urlencoded")) return true;
+    if (contentType != "text/plain") return false;
+    size_t first = min(body.length(), (size_t)HOST_FILL_CHUNK);
+    size_t i = 0;
+    while (i < first && isParamChar(body[i])) i++;
+    return i > 0 && i < first && body[i] == '=';
+}
+
+static std::string urlDecode(const std::string& text) {
+    std::string decoded;
+    for (size_t i = 0; i < text.length(); i++) {
+        if (text[i] == '+') {
+            decoded += ' ';
+        } else if (text[i] == '%' && i + 2 < text.length()) {
+            decoded += (char)strtol(text.substr(i + 1, 2).c_str(), nullptr, 16);
+            i += 2;
+        } else {
+            decoded += text[i];
+        }
+    }
+    return decoded;
+}
+
+// "a=1&b=2" as post params; a field without '=' is all value, named "body"
+static void parseForm(AsyncWebServerRequest* request, const std::string& body) {
+    size_t start = 0;
+    while (start <= body.length()) {
+        size_t end = body.find('&', start);
+        if (end == std::string::npos) end = body.length();
+        std::string field = body.substr(start, end - start);
+        std::string name = "body";
+        std::string value = field;
+        size_t eq = field.find('=');
+        if (field[0] != '{' && field[0] != '[' && eq != std::string::npos && eq > 0) {
+            name = field.substr(0, eq);
+            value = field.substr(eq + 1);
+        }
+        request->hostAddParam(urlDecode(name).c_str(), urlDecode(value).c_str(), true);
+        start = end + 1;
+    }
+}
+
+AsyncWebServer::AsyncWebServer(uint16_t port) {
+    catchAll = nullptr;
+}
+
+AsyncWebServer::~AsyncWebServer() {
+    for (AsyncWebHandler* handler : handlers) {
+        delete handler;
+    }
+    delete catchAll;
+}
+
+void AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest) {
+    on(uri, method, onRequest, nullptr, nullptr);
+}
+
+void AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                        ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody) {
+    addHandler(new AsyncCallbackWebHandler(uri, method, onRequest, onUpload, onBody));
+}
+
+void AsyncWebServer::onNotFound(ArRequestHandlerFunction fn) {
+    delete catchAll;
+    catchAll = new AsyncCallbackWebHandler("", HTTP_ANY, fn, nullptr, nullptr);
+}
+
+bool AsyncWebServer::hostHandle(AsyncWebServerRequest* request, HostResponse* result) {
+    bool deleted = false;
+    request->hostResult = result;
+    request->hostDeleted = &deleted;
+
+    AsyncWebHandler* handler = nullptr;
+    for (AsyncWebHandler* candidate : handlers) {
+        if (candidate->canHandle(request)) {
+            handler = candidate;
+            break;
+        }
+    }
+    bool matched = (handler != nullptr);
+    if (!matched) handler = catchAll;
+
+    // Bodies arrive before the request handler runs, in segment-sized
+    // pieces as they would off the network
+    const std::string& body = request->hostBody;
+    if (handler != nullptr && !body.empty()) {
+        if (!isPlainPost(request->contentType(), body)) {
+            size_t delivered = min(body.length(), request->hostDropAt);
+            for (size_t i = 0; i < delivered; i += HOST_FILL_CHUNK) {
+                size_t n = min((size_t)HOST_FILL_CHUNK, delivered - i);
+                handler->handleBody(request, (uint8_t*)body.data() + i, n, i, body.length());
+            }
+            if (delivered < body.length()) {
+                delete request;
+                return matched;
+            }
+        } else if (!handler->isRequestHandlerTrivial()) {
+            parseForm(request, body);
+            if (result != nullptr) result->formBytes = body.length();
+        }
+    }
+    if (handler != nullptr) handler->handleRequest(request);
+
+    if (!deleted) delete request;
+    return matched;
+}
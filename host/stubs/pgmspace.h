@@ -0,0 +1,9 @@
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+// Flash and RAM share one address space on the host
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+// Assertions for the host tests under ctest. A failed CHECK prints where
+// it was and carries on, so one run reports every failure; main() ends
+// with checkResult(), which prints a summary and gives the exit status.
+
+#include <stdio.h>
+
+inline int checksRun = 0;
+inline int checksFailed = 0;
+
+#define CHECK(cond) do { \
+    checksRun++; \
+    if (!(cond)) { \
+        checksFailed++; \
+        fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    } \
+} while (0)
+
+// Integral values, printed when they differ
+#define CHECK_EQ(actual, expected) do { \
+    checksRun++; \
+    long long a_ = (long long)(actual); \
+    long long e_ = (long long)(expected); \
+    if (a_ != e_) { \
+        checksFailed++; \
+        fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", \
+                __FILE__, __LINE__, #actual, #expected, a_, e_); \
+    } \
+} while (0)
+
+inline int checkResult(const char* test) {
+    printf("%s: %d checks, %d failed\n", test, checksRun, checksFailed);
+    return checksFailed > 0 ? 1 : 0;
+}
+
+#endif
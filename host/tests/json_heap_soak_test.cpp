@@ -0,0 +1,157 @@
+// Heap soak for the JSON API: many thousands of mixed requests (status
+// snapshots, accepted commands, errors, listings) with the main loop
+// running between them, counting every operator new/delete. Checks that:
+//
+//   - no block a reply allocates is much larger than its body, where a
+//     fixed JSON_RESPONSE_MAX_LEN body used to go with every reply
+//   - the soak leaves exactly the bytes live that it started with
+//   - the allocator's arena does not grow over the soak, i.e. the
+//     request/reply churn does not fragment the heap into unusable holes
+//
+// The host allocator is glibc's, not the ESP32's, so the arena figure is a
+// proxy: growth here means allocation patterns that fragment any heap.
+
+#include "check.h"
+#include "host_probe.h"
+#include "json_response.h"
+
+#include <malloc.h>
+#include <new>
+
+#define SOAK_ROUNDS      20000
+#define SOAK_WARMUP      200
+#define SOAK_BLOCK_SLACK 256    // Largest block a reply may allocate beyond its body length
+#define SOAK_ARENA_SLACK 65536  // Allowed arena growth over the whole soak
+
+// Every allocation carries its size in front, so frees can be counted
+struct AllocHeader {
+    size_t size;
+    size_t pad;  // Keeps the block 16-byte aligned, as malloc's is
+};
+
+static size_t liveBytes = 0;
+static size_t allocatedBytes = 0;
+static size_t largestBlock = 0;  // Since last reset by the test
+
+static void* trackedAlloc(size_t size) {
+    AllocHeader* header = (AllocHeader*)malloc(sizeof(AllocHeader) + size);
+    if (header == nullptr) throw std::bad_alloc();
+    header->size = size;
+    liveBytes += size;
+    allocatedBytes += size;
+    if (size > largestBlock) largestBlock = size;
+    return header + 1;
+}
+
+static void trackedFree(void* ptr) {
+    if (ptr == nullptr) return;
+    AllocHeader* header = (AllocHeader*)ptr - 1;
+    liveBytes -= header->size;
+    free(header);
+}
+
+void* operator new(size_t size) { return trackedAlloc(size); }
+void* operator new[](size_t size) { return trackedAlloc(size); }
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+
+static CC1101Interface radio;
+static MenuSystem menu;
+static SubGhzOperations operations(&radio, &menu);
+static WiFiAP wifiAP(&operations, &menu);
+static AsyncWebServer* server;
+
+struct SoakRequest {
+    const char* name;
+    WebRequestMethodComposite method;
+    const char* url;
+    const char* param;  // "name=value" form field, or null
+    int code;           // Expected status; 0 for either 200 or 503
+};
+
+static const SoakRequest requests[] = {
+    { "status", HTTP_GET, "/status", nullptr, 200 },
+    { "listen", HTTP_POST, "/listen", "frequency=433.92", 0 },
+    { "listen_missing", HTTP_POST, "/listen", nullptr, 400 },
+    { "listen_band", HTTP_POST, "/listen", "frequency=100", 400 },
+    { "tune", HTTP_POST, "/tune", "frequency=315", 0 },
+    { "stop", HTTP_POST, "/stop", nullptr, 0 },
+    { "recordings", HTTP_GET, "/recordings", nullptr, 200 },
+    { "download_none", HTTP_GET, "/recordings/latest", nullptr, 404 },
+    { "sweep_none", HTTP_GET, "/sweep", nullptr, 404 },
+    { "not_found", HTTP_GET, "/nope", nullptr, 404 },
+};
+#define SOAK_REQUEST_COUNT (sizeof(requests) / sizeof(requests[0]))
+
+// Runs one request; returns false if the status is not the expected one
+static bool run(const SoakRequest& spec, HostResponse* response) {
+    AsyncWebServerRequest* request = new AsyncWebServerRequest(spec.method, spec.url);
+    if (spec.param != nullptr) {
+        std::string field = spec.param;
+        size_t eq = field.find('=');
+        request->hostAddParam(field.substr(0, eq).c_str(), field.substr(eq + 1).c_str(), true);
+    }
+    server->hostHandle(request, response);
+    if (spec.code != 0) return response->code == spec.code;
+    return response->code == 200 || response->code == 202 || response->code == 503;
+}
+
+static size_t arenaBytes() {
+    struct mallinfo2 info = mallinfo2();
+    return info.arena + info.hblkhd;
+}
+
+int main() {
+    wifiAP.begin();
+    server = HostProbe::webServer(wifiAP);
+    CHECK(server != nullptr);
+    if (server == nullptr) return checkResult("json_heap_soak_test");
+
+    // Warm up, so first-use allocations (statics, queue storage, snapshot
+    // strings) are not counted against the soak
+    for (int i = 0; i < SOAK_WARMUP; i++) {
+        HostResponse response;
+        run(requests[i % SOAK_REQUEST_COUNT], &response);
+        wifiAP.update();
+    }
+
+    // The largest block each kind of reply allocates, against its body
+    printf("%-16s %5s %6s %10s %8s\n", "request", "code", "body", "allocated", "largest");
+    for (size_t i = 0; i < SOAK_REQUEST_COUNT; i++) {
+        HostResponse response;
+        size_t before = allocatedBytes;
+        largestBlock = 0;
+        bool ok = run(requests[i], &response);
+        size_t allocated = allocatedBytes - before;
+        size_t largest = largestBlock;
+        wifiAP.update();
+        printf("%-16s %5d %6zu %10zu %8zu\n", requests[i].name, response.code,
+               response.body.length(), allocated, largest);
+        CHECK(ok);
+        CHECK(largest < response.body.length() + SOAK_BLOCK_SLACK);
+    }
+
+    size_t liveBefore = liveBytes;
+    size_t arenaBefore = arenaBytes();
+    size_t allocatedBefore = allocatedBytes;
+    int unexpected = 0;
+    for (int i = 0; i < SOAK_ROUNDS; i++) {
+        HostResponse response;
+        if (!run(requests[i % SOAK_REQUEST_COUNT], &response)) unexpected++;
+        if (i % 3 == 0) wifiAP.update();
+    }
+    wifiAP.update();
+    size_t arenaAfter = arenaBytes();
+
+    printf("%d requests: %.1f MB allocated, live %zu -> %zu bytes, arena %zu -> %zu bytes\n",
+           SOAK_ROUNDS, (allocatedBytes - allocatedBefore) / 1048576.0,
+           liveBefore, liveBytes, arenaBefore, arenaAfter);
+    CHECK_EQ(unexpected, 0);
+    CHECK_EQ(liveBytes, liveBefore);
+    CHECK(arenaAfter <= arenaBefore + SOAK_ARENA_SLACK);
+
+    wifiAP.stop();
+    return checkResult("json_heap_soak_test");
+}
@@ -0,0 +1,139 @@
+// Round trip of the binary spectrum frame (src/spectrum_frame.h): every
+// header field and bin survives encode -> decode, out-of-range bins clamp
+// to int8, and short or damaged buffers are rejected rather than read past.
+
+#include "check.h"
+#include "spectrum_frame.h"
+
+#include <string.h>
+
+#define TEST_BINS 120  // SPECTRUM_POINTS in src/subghz_operations.h
+
+static void testSweepRoundTrip() {
+    int dbm[TEST_BINS];
+    for (int i = 0; i < TEST_BINS; i++) {
+        dbm[i] = -120 + i;  // -120 .. -1
+    }
+    uint8_t buffer[SPECTRUM_FRAME_SIZE(TEST_BINS)];
+    size_t length = encodeSpectrumFrame(buffer, sizeof(buffer), SPECTRUM_FRAME_SWEEP,
+                                        433.05f, 0.025f, 123456789, dbm, TEST_BINS);
+    CHECK_EQ(length, SPECTRUM_FRAME_SIZE(TEST_BINS));
+
+    SpectrumFrame frame;
+    CHECK(decodeSpectrumFrame(buffer, length, &frame));
+    CHECK_EQ(frame.version, SPECTRUM_FRAME_VERSION);
+    CHECK_EQ(frame.type, SPECTRUM_FRAME_SWEEP);
+    CHECK_EQ(frame.count, TEST_BINS);
+    CHECK_EQ(frame.startKHz, 433050);
+    CHECK_EQ(frame.stepHz, 25000);
+    CHECK_EQ(frame.timestamp, 123456789);
+    CHECK(frame.bins == (const int8_t*)(buffer + SPECTRUM_FRAME_HEADER_SIZE));
+    int wrong = 0;
+    for (int i = 0; i < TEST_BINS; i++) {
+        if (frame.bins[i] != dbm[i]) wrong++;
+    }
+    CHECK_EQ(wrong, 0);
+}
+
+static void testRSSIRoundTrip() {
+    // One frequency, no step; the top of the band and a wrapped timestamp
+    int dbm[3] = { -90, -45, -91 };
+    uint8_t buffer[SPECTRUM_FRAME_SIZE(3)];
+    size_t length = encodeSpectrumFrame(buffer, sizeof(buffer), SPECTRUM_FRAME_RSSI,
+                                        928.0f, 0.0f, 0xFFFFFFFF, dbm, 3);
+    SpectrumFrame frame;
+    CHECK(decodeSpectrumFrame(buffer, length, &frame));
+    CHECK_EQ(frame.type, SPECTRUM_FRAME_RSSI);
+    CHECK_EQ(frame.count, 3);
+    CHECK_EQ(frame.startKHz, 928000);
+    CHECK_EQ(frame.stepHz, 0);
+    CHECK_EQ(frame.timestamp, 0xFFFFFFFFu);
+    CHECK_EQ(frame.bins[0], -90);
+    CHECK_EQ(frame.bins[1], -45);
+    CHECK_EQ(frame.bins[2], -91);
+}
+
+static void testClamping() {
+    int dbm[8] = { -1000, -129, -128, -127, 126, 127, 128, 1000 };
+    int expected[8] = { -128, -128, -128, -127, 126, 127, 127, 127 };
+    uint8_t buffer[SPECTRUM_FRAME_SIZE(8)];
+    size_t length = encodeSpectrumFrame(buffer, sizeof(buffer), SPECTRUM_FRAME_SWEEP,
+                                        300.0f, 0.1f, 0, dbm, 8);
+    SpectrumFrame frame;
+    CHECK(decodeSpectrumFrame(buffer, length, &frame));
+    for (int i = 0; i < 8; i++) {
+        CHECK_EQ(frame.bins[i], expected[i]);
+    }
+}
+
+static void testEmpty() {
+    uint8_t buffer[SPECTRUM_FRAME_HEADER_SIZE];
+    size_t length = encodeSpectrumFrame(buffer, sizeof(buffer), SPECTRUM_FRAME_RSSI,
+                                        433.92f, 0.0f, 1, nullptr, 0);
+    CHECK_EQ(length, SPECTRUM_FRAME_HEADER_SIZE);
+    SpectrumFrame frame;
+    CHECK(decodeSpectrumFrame(buffer, length, &frame));
+    CHECK_EQ(frame.count, 0);
+}
+
+static void testEncodeCapacity() {
+    int dbm[4] = { -60, -60, -60, -60 };
+    uint8_t buffer[SPECTRUM_FRAME_SIZE(4)];
+    memset(buffer, 0xAA, sizeof(buffer));
+    CHECK_EQ(encodeSpectrumFrame(buffer, sizeof(buffer) - 1, SPECTRUM_FRAME_SWEEP,
+                                 433.0f, 0.1f, 0, dbm, 4), 0);
+    CHECK_EQ(buffer[0], 0xAA);  // Nothing written
+}
+
+static void testRejects() {
+    int dbm[16];
+    for (int i = 0; i < 16; i++) {
+        dbm[i] = -70;
+    }
+    uint8_t buffer[SPECTRUM_FRAME_SIZE(16)];
+    size_t length = encodeSpectrumFrame(buffer, sizeof(buffer), SPECTRUM_FRAME_SWEEP,
+                                        433.0f, 0.1f, 0, dbm, 16);
+    SpectrumFrame frame;
+
+    // Every cut short of the full frame, inside the header or the bins
+    int accepted = 0;
+    for (size_t cut = 0; cut < length; cut++) {
+        if (decodeSpectrumFrame(buffer, cut, &frame)) accepted++;
+    }
+    CHECK_EQ(accepted, 0);
+    CHECK(decodeSpectrumFrame(buffer, length, &frame));
+
+    // Trailing bytes are not part of the frame
+    uint8_t longer[SPECTRUM_FRAME_SIZE(16) + 4] = {};
+    memcpy(longer, buffer, length);
+    CHECK(decodeSpectrumFrame(longer, sizeof(longer), &frame));
+    CHECK_EQ(frame.count, 16);
+
+    uint8_t damaged[SPECTRUM_FRAME_SIZE(16)];
+    memcpy(damaged, buffer, length);
+    damaged[0] = 'X';
+    CHECK(!decodeSpectrumFrame(damaged, length, &frame));
+
+    memcpy(damaged, buffer, length);
+    damaged[1] = 'X';
+    CHECK(!decodeSpectrumFrame(damaged, length, &frame));
+
+    memcpy(damaged, buffer, length);
+    damaged[2] = SPECTRUM_FRAME_VERSION + 1;
+    CHECK(!decodeSpectrumFrame(damaged, length, &frame));
+
+    // A count larger than the bytes that follow
+    memcpy(damaged, buffer, length);
+    damaged[4] = 17;
+    CHECK(!decodeSpectrumFrame(damaged, length, &frame));
+}
+
+int main() {
+    testSweepRoundTrip();
+    testRSSIRoundTrip();
+    testClamping();
+    testEmpty();
+    testEncodeCapacity();
+    testRejects();
+    return checkResult("spectrum_frame_test");
+}
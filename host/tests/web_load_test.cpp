@@ -0,0 +1,173 @@
+// Floods the web handlers with /status reads and /listen commands while
+// the main loop runs WiFiAP::update(), and checks that:
+//
+//   - every accepted command is applied exactly once, in the order it was
+//     accepted, and only on the main loop
+//   - /status always returns a whole snapshot, and never shows the
+//     frequency going backwards
+//   - update() never waits on the handlers
+//
+// On the device every handler runs in the one async TCP task, so a single
+// client thread stands in for it. A 503 (queue full) is retried as a
+// browser would; it is not a lost command. MenuSystem::setFrequency() is
+// wrapped at link time to see each command as the main loop applies it.
+
+#include "check.h"
+#include "host_probe.h"
+#include "menu_system.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define LOAD_COMMANDS       3000
+#define LOAD_BASE_CENTI_MHZ 40000  // 400.00 MHz, stepped by 0.01 per command
+// update() takes microseconds, but the client's time slices land inside
+// some passes (all of them on a single core). A pass waiting on a handler
+// would be slow every time, not in one pass in a thousand.
+#define LOAD_SLOW_UPDATE_US 1000
+#define LOAD_MAX_UPDATE_US  100000
+
+static CC1101Interface radio;
+static MenuSystem menu;
+static SubGhzOperations operations(&radio, &menu);
+static WiFiAP wifiAP(&operations, &menu);
+
+static std::thread::id mainThread;
+static std::vector<float> applied;
+static int offMainThread = 0;
+
+extern "C" void __real__ZN10MenuSystem12setFrequencyEf(MenuSystem* menu, float mhz);
+
+extern "C" void __wrap__ZN10MenuSystem12setFrequencyEf(MenuSystem* menu, float mhz) {
+    if (std::this_thread::get_id() != mainThread) offMainThread++;
+    applied.push_back(mhz);
+    __real__ZN10MenuSystem12setFrequencyEf(menu, mhz);
+}
+
+static float commandFrequency(int i) {
+    return (LOAD_BASE_CENTI_MHZ + i) / 100.0f;
+}
+
+// The top-level "frequency" of a /status body, or -1 if there is none
+static float statusFrequency(const std::string& body) {
+    size_t at = body.find("\"frequency\":");
+    if (at == std::string::npos) return -1;
+    return strtof(body.c_str() + at + 12, nullptr);
+}
+
+struct ClientStats {
+    int accepted = 0;
+    int busy = 0;
+    int statusReads = 0;
+    int badStatus = 0;       // Not 200, or not a whole JSON object
+    int backwards = 0;       // Frequency lower than an earlier read
+    int otherErrors = 0;
+};
+
+static void runClient(AsyncWebServer* server, ClientStats* stats) {
+    float lastSeen = 0;
+    for (int i = 0; i < LOAD_COMMANDS; i++) {
+        char freq[16];
+        snprintf(freq, sizeof(freq), "%.2f", commandFrequency(i));
+        for (;;) {
+            AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_POST, "/listen");
+            request->hostAddParam("frequency", freq, true);
+            HostResponse response;
+            server->hostHandle(request, &response);
+            if (response.code == 200) {
+                stats->accepted++;
+                break;
+            }
+            if (response.code != 503) {
+                stats->otherErrors++;
+                break;
+            }
+            stats->busy++;
+            std::this_thread::yield();
+        }
+
+        AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_GET, "/status");
+        HostResponse response;
+        server->hostHandle(request, &response);
+        stats->statusReads++;
+        const std::string& body = response.body;
+        if (response.code != 200 || body.empty() || body.front() != '{' || body.back() != '}') {
+            stats->badStatus++;
+            continue;
+        }
+        // Until the first command lands it shows the boot frequency
+        float seen = statusFrequency(body);
+        bool isCommand = seen > commandFrequency(0) - 0.005f &&
+                         seen < commandFrequency(LOAD_COMMANDS - 1) + 0.005f;
+        if (!isCommand) {
+            if (lastSeen > 0) stats->backwards++;
+            continue;
+        }
+        if (seen < lastSeen) stats->backwards++;
+        if (seen > lastSeen) lastSeen = seen;
+    }
+}
+
+int main() {
+    mainThread = std::this_thread::get_id();
+    wifiAP.begin();
+    AsyncWebServer* server = HostProbe::webServer(wifiAP);
+    CHECK(server != nullptr);
+    if (server == nullptr) return checkResult("web_load_test");
+
+    ClientStats stats;
+    std::atomic<bool> done(false);
+    std::thread client([&] {
+        runClient(server, &stats);
+        done = true;
+    });
+
+    // The main loop: as in loop(), update() runs back to back
+    unsigned long passes = 0;
+    unsigned long maxUpdateUs = 0;
+    unsigned long slowPasses = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (!done) {
+        auto before = std::chrono::steady_clock::now();
+        wifiAP.update();
+        unsigned long us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - before).count();
+        if (us > maxUpdateUs) maxUpdateUs = us;
+        if (us > LOAD_SLOW_UPDATE_US) slowPasses++;
+        passes++;
+    }
+    client.join();
+    wifiAP.update();  // Whatever the last requests queued
+    double totalMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    printf("%d commands (%d busy retries), %d status reads, %lu update passes in %.1f ms, "
+           "%lu over %d us, longest %lu us\n",
+           stats.accepted, stats.busy, stats.statusReads, passes, totalMs,
+           slowPasses, LOAD_SLOW_UPDATE_US, maxUpdateUs);
+
+    CHECK_EQ(stats.accepted, LOAD_COMMANDS);
+    CHECK_EQ(stats.otherErrors, 0);
+    CHECK_EQ(stats.statusReads, LOAD_COMMANDS);
+    CHECK_EQ(stats.badStatus, 0);
+    CHECK_EQ(stats.backwards, 0);
+
+    // None lost, none repeated, none out of order
+    CHECK_EQ(applied.size(), LOAD_COMMANDS);
+    int outOfPlace = 0;
+    for (size_t i = 0; i < applied.size(); i++) {
+        if (fabsf(applied[i] - commandFrequency(i)) > 0.001f) outOfPlace++;
+    }
+    CHECK_EQ(outOfPlace, 0);
+    CHECK_EQ(offMainThread, 0);
+    CHECK(menu.getMode() == MODE_LISTENING);
+    CHECK(fabsf(menu.getSelectedFrequency() - commandFrequency(LOAD_COMMANDS - 1)) < 0.001f);
+
+    CHECK(slowPasses <= passes / 1000);
+    CHECK(maxUpdateUs < LOAD_MAX_UPDATE_US);
+
+    wifiAP.stop();
+    return checkResult("web_load_test");
+}
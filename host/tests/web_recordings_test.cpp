@@ -0,0 +1,244 @@
+// POST /recordings and GET /recordings/<id> with large transfers:
+//
+//   - a multi-megabyte text upload (512 durations among megabytes of
+//     comments) streams through the parser and becomes the capture
+//   - a multi-megabyte raw upload with too many samples is refused with
+//     413 at the first sample past the limit
+//   - a multi-megabyte body sent as application/x-www-form-urlencoded
+//     (curl's default for --data-binary) gets 415, without the server
+//     holding any of it in memory as form params
+//   - an upload whose client goes away mid-body does not hold the slot
+//     or leak into a retry, even one whose request lands at the same address
+//   - downloads, full and ranged, raw and text, adding up to megabytes,
+//     match the capture byte for byte
+//   - malformed ranges (trailing garbage, signs) get 416, not a guess
+//   - a download whose capture is replaced partway through fails with a
+//     dropped connection instead of ending as a short, valid-looking file
+//
+// A capture holds at most MAX_RECORDING_SAMPLES, so one download is at
+// most a few KB; the download side repeats them instead.
+
+#include "check.h"
+#include "host_probe.h"
+
+#include <string>
+
+#define UPLOAD_COMMENT_BYTES 6000       // Comment between durations in the text upload
+#define UPLOAD_RAW_BYTES     (3 << 20)  // Oversized raw upload
+#define UPLOAD_FORM_BYTES    (3 << 20)  // Urlencoded upload
+#define DOWNLOAD_TOTAL_BYTES (4 << 20)  // Downloaded across all requests
+
+static CC1101Interface radio;
+static MenuSystem menu;
+static SubGhzOperations operations(&radio, &menu);
+static WiFiAP wifiAP(&operations, &menu);
+static AsyncWebServer* server;
+
+static int expectedTimings[MAX_RECORDING_SAMPLES];
+
+static void upload(const char* contentType, const std::string& body, HostResponse* response) {
+    AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_POST, "/recordings");
+    request->hostSetBody(contentType, (const uint8_t*)body.data(), body.length());
+    server->hostHandle(request, response);
+    wifiAP.update();  // Installs an accepted upload
+}
+
+static void download(const char* format, const char* range, HostResponse* response) {
+    AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_GET, "/recordings/latest");
+    request->hostAddParam("format", format);
+    if (range != nullptr) request->hostAddHeader("Range", range);
+    server->hostHandle(request, response);
+}
+
+static void testTextUpload() {
+    std::string body;
+    std::string comment = "# " + std::string(UPLOAD_COMMENT_BYTES, 'x') + "\n";
+    for (int i = 0; i < MAX_RECORDING_SAMPLES; i++) {
+        expectedTimings[i] = 100 + (i * 37) % 9000;
+        body += comment;
+        body += (i % 2 == 0 ? "-" : "+") + std::to_string(expectedTimings[i]) + "\n";
+    }
+
+    HostResponse response;
+    upload("text/plain", body, &response);
+    printf("text upload: %.1f MB -> %d %s\n", body.length() / 1048576.0, response.code, response.body.c_str());
+    CHECK(body.length() > (2u << 20));
+    CHECK_EQ(response.code, 200);
+    CHECK_EQ(response.formBytes, 0);
+    CHECK(response.body.find("\"samples\":512") != std::string::npos);
+
+    CHECK(operations.hasCapture());
+    CHECK_EQ(operations.getCaptureSampleCount(), MAX_RECORDING_SAMPLES);
+    int wrong = 0;
+    for (int i = 0; i < operations.getCaptureSampleCount(); i++) {
+        if (operations.getCaptureTimings()[i] != expectedTimings[i]) wrong++;
+    }
+    CHECK_EQ(wrong, 0);
+}
+
+static void testRawTooMany() {
+    std::string body(UPLOAD_RAW_BYTES, '\0');
+    for (size_t i = 0; i < body.length(); i += RECORDING_RAW_SAMPLE_BYTES) {
+        body[i] = (char)0xE8;  // 1000 us
+        body[i + 1] = 0x03;
+    }
+
+    HostResponse response;
+    upload("application/octet-stream", body, &response);
+    printf("raw upload: %.1f MB -> %d %s\n", body.length() / 1048576.0, response.code, response.body.c_str());
+    CHECK_EQ(response.code, 413);
+    CHECK_EQ(response.formBytes, 0);
+    // Reported within the first sample past the limit
+    size_t at = response.body.find("\"offset\":");
+    unsigned long offset = (at == std::string::npos) ? 0 : strtoul(response.body.c_str() + at + 9, nullptr, 10);
+    CHECK(offset >= MAX_RECORDING_SAMPLES * RECORDING_RAW_SAMPLE_BYTES);
+    CHECK(offset < (MAX_RECORDING_SAMPLES + 1) * RECORDING_RAW_SAMPLE_BYTES);
+    CHECK_EQ(operations.getCaptureTimings()[0], expectedTimings[0]);  // Capture kept
+}
+
+static void testFormRejected() {
+    // What curl --data-binary @capture.txt sends without a -H option
+    std::string body;
+    while (body.length() < UPLOAD_FORM_BYTES) {
+        body += "-000350\n+000700\n";
+    }
+
+    HostResponse response;
+    upload("application/x-www-form-urlencoded", body, &response);
+    printf("form upload: %.1f MB -> %d %s, %zu bytes held as params\n",
+           body.length() / 1048576.0, response.code, response.body.c_str(), response.formBytes);
+    CHECK_EQ(response.code, 415);
+    CHECK_EQ(response.formBytes, 0);
+    CHECK_EQ(operations.getCaptureSampleCount(), MAX_RECORDING_SAMPLES);
+
+    // The upload slot was never taken, so the next upload goes through
+    HostResponse next;
+    upload("text/plain", "350 700 350", &next);
+    CHECK_EQ(next.code, 200);
+    CHECK_EQ(operations.getCaptureSampleCount(), 3);
+}
+
+static void testDroppedUpload() {
+    std::string first;
+    while (first.length() < 4 * 1460) {
+        first += "111 ";
+    }
+    AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_POST, "/recordings");
+    request->hostSetBody("text/plain", (const uint8_t*)first.data(), first.length());
+    request->hostDropAt = 1460;  // Gone after the first segment
+    uintptr_t droppedAt = (uintptr_t)request;
+    HostResponse dropped;
+    server->hostHandle(request, &dropped);
+    CHECK_EQ(dropped.code, 0);
+    
+    // Retried at once with another capture
+    std::string body;
+    for (int i = 0; i < 500; i++) {
+        body += (i % 2 == 0) ? "222 " : "333 ";
+    }
+    request = new AsyncWebServerRequest(HTTP_POST, "/recordings");
+    printf("dropped upload: retry at %s address\n", (uintptr_t)request == droppedAt ? "the same" : "another");
+    request->hostSetBody("text/plain", (const uint8_t*)body.data(), body.length());
+    HostResponse response;
+    server->hostHandle(request, &response);
+    wifiAP.update();
+    CHECK_EQ(response.code, 200);
+    CHECK_EQ(operations.getCaptureSampleCount(), 500);
+    int wrong = 0;
+    for (int i = 0; i < operations.getCaptureSampleCount(); i++) {
+        if (operations.getCaptureTimings()[i] != ((i % 2 == 0) ? 222 : 333)) wrong++;
+    }
+    CHECK_EQ(wrong, 0);
+}
+
+static std::string encoded(RecordingFormat format) {
+    int samples = operations.getCaptureSampleCount();
+    std::string bytes(recordingEncodedSize(format, samples), '\0');
+    encodeRecordingRange(format, operations.getCaptureTimings(), samples, 0,
+                         (uint8_t*)&bytes[0], bytes.length());
+    return bytes;
+}
+
+static void testDownloads() {
+    // Back to a full-size capture
+    operations.loadCapture(expectedTimings, MAX_RECORDING_SAMPLES);
+    const char* formats[2] = { "raw", "text" };
+    std::string expected[2] = { encoded(RECORDING_FORMAT_RAW), encoded(RECORDING_FORMAT_TEXT) };
+
+    size_t total = 0;
+    int requests = 0;
+    int mismatches = 0;
+    uint32_t seed = 1;
+    while (total < DOWNLOAD_TOTAL_BYTES) {
+        int f = requests % 2;
+        const std::string& full = expected[f];
+        HostResponse response;
+        if (requests % 4 < 2) {
+            download(formats[f], nullptr, &response);
+            if (response.code != 200 || response.body != full) mismatches++;
+        } else {
+            seed = seed * 1103515245 + 12345;
+            size_t start = (seed >> 8) % full.length();
+            size_t end = start + (seed >> 4) % (full.length() - start);
+            char range[48];
+            snprintf(range, sizeof(range), "bytes=%zu-%zu", start, end);
+            download(formats[f], range, &response);
+            if (response.code != 206 || response.body != full.substr(start, end - start + 1)) mismatches++;
+        }
+        total += response.body.length();
+        requests++;
+    }
+    printf("downloads: %d requests, %.1f MB\n", requests, total / 1048576.0);
+    CHECK_EQ(mismatches, 0);
+}
+
+static void testBadRanges() {
+    const char* bad[] = { "bytes=5-10xyz", "bytes=-5abc", "bytes=5x-10", "bytes=5--3",
+                          "bytes=+5-10", "bytes=- 5", "bytes=5-+10", "bytes=" };
+    for (const char* range : bad) {
+        HostResponse response;
+        download("raw", range, &response);
+        if (response.code != 416) printf("%s -> %d\n", range, response.code);
+        CHECK_EQ(response.code, 416);
+    }
+    HostResponse spaced;
+    download("raw", "bytes=5-10 ", &spaced);
+    CHECK_EQ(spaced.code, 206);
+    CHECK_EQ(spaced.body.length(), 6);
+}
+
+static void testDownloadReplaced() {
+    int replacement[3] = { 350, 700, 350 };
+    const char* ranges[2] = { nullptr, "bytes=100-" };  // Chunked, then 206
+    for (int i = 0; i < 2; i++) {
+        operations.loadCapture(expectedTimings, MAX_RECORDING_SAMPLES);
+        size_t full = recordingEncodedSize(RECORDING_FORMAT_TEXT, MAX_RECORDING_SAMPLES);
+        HostResponse response;
+        response.onSegment = [&](size_t) {
+            if (operations.getCaptureSampleCount() != 3) operations.loadCapture(replacement, 3);
+        };
+        download("text", ranges[i], &response);
+        printf("download replaced after one segment: %d, %zu of %zu bytes, %s\n", response.code,
+               response.body.length(), full, response.aborted ? "aborted" : "ended");
+        CHECK(response.aborted);
+        CHECK(response.body.length() < full / 2);
+    }
+}
+
+int main() {
+    wifiAP.begin();
+    server = HostProbe::webServer(wifiAP);
+    CHECK(server != nullptr);
+    if (server == nullptr) return checkResult("web_recordings_test");
+
+    testTextUpload();
+    testRawTooMany();
+    testFormRejected();
+    testDroppedUpload();
+    testDownloads();
+    testBadRanges();
+    testDownloadReplaced();
+
+    wifiAP.stop();
+    return checkResult("web_recordings_test");
+}
@@ -0,0 +1,99 @@
+// Work the web handlers reserve before the main loop applies a command is
+// released again when the command never runs, so the AP keeps accepting
+// new work:
+//
+//   - a sweep still queued when WiFiAP::stop() resets the queue
+//   - a sweep the main loop fails to start
+//   - an upload still waiting to be installed when stop() resets the queue
+//
+// SubGhzOperations::startSweep() is wrapped at link time so a start can
+// be made to fail.
+
+#include "check.h"
+#include "host_probe.h"
+
+static CC1101Interface radio;
+static MenuSystem menu;
+static SubGhzOperations operations(&radio, &menu);
+static WiFiAP wifiAP(&operations, &menu);
+
+static bool failSweepStart = false;
+
+extern "C" bool __real__ZN16SubGhzOperations10startSweepEjRK11SweepParams(
+    SubGhzOperations* ops, uint32_t id, const SweepParams& params);
+
+extern "C" bool __wrap__ZN16SubGhzOperations10startSweepEjRK11SweepParams(
+    SubGhzOperations* ops, uint32_t id, const SweepParams& params) {
+    if (failSweepStart) return false;
+    return __real__ZN16SubGhzOperations10startSweepEjRK11SweepParams(ops, id, params);
+}
+
+static int postSweep() {
+    AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_POST, "/sweep");
+    request->hostAddParam("start", "433.0", true);
+    request->hostAddParam("stop", "434.0", true);
+    request->hostAddParam("step", "0.1", true);
+    HostResponse response;
+    HostProbe::webServer(wifiAP)->hostHandle(request, &response);
+    return response.code;
+}
+
+static void finishSweep() {
+    for (int i = 0; i < 10000 && operations.getSweep().isRunning(); i++) {
+        operations.update();
+    }
+    wifiAP.update();
+}
+
+static void testSweepDroppedByStop() {
+    CHECK_EQ(postSweep(), 202);
+    CHECK_EQ(postSweep(), 409);  // Queued, not started yet
+    wifiAP.stop();
+    wifiAP.begin();
+    CHECK_EQ(postSweep(), 202);
+    wifiAP.update();
+    finishSweep();
+    CHECK(!operations.getSweep().isRunning());
+}
+
+static void testSweepStartFails() {
+    failSweepStart = true;
+    CHECK_EQ(postSweep(), 202);
+    wifiAP.update();
+    failSweepStart = false;
+    CHECK_EQ(postSweep(), 202);
+    wifiAP.update();
+    CHECK(operations.getSweep().isRunning());
+    finishSweep();
+}
+
+static int postUpload(const char* body) {
+    AsyncWebServerRequest* request = new AsyncWebServerRequest(HTTP_POST, "/recordings");
+    request->hostSetBody("text/plain", (const uint8_t*)body, strlen(body));
+    HostResponse response;
+    HostProbe::webServer(wifiAP)->hostHandle(request, &response);
+    return response.code;
+}
+
+static void testUploadDroppedByStop() {
+    CHECK_EQ(postUpload("350 700 350"), 200);
+    CHECK_EQ(postUpload("350 700 350"), 409);  // Not installed yet
+    wifiAP.stop();
+    wifiAP.begin();
+    CHECK_EQ(postUpload("100 200 300 400"), 200);
+    wifiAP.update();
+    CHECK_EQ(operations.getCaptureSampleCount(), 4);
+}
+
+int main() {
+    wifiAP.begin();
+    CHECK(HostProbe::webServer(wifiAP) != nullptr);
+    if (HostProbe::webServer(wifiAP) == nullptr) return checkResult("web_stop_test");
+
+    testSweepDroppedByStop();
+    testSweepStartFails();
+    testUploadDroppedByStop();
+
+    wifiAP.stop();
+    return checkResult("web_stop_test");
+}
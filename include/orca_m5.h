@@ -7,9 +7,20 @@
 extern "C" {
 #endif
 
-// Orca image data - converted from 24-bit RGB to RGB565
+// Orca splash image - RLE-compressed RGB565, generated at build time
+// from assets/orca_m5.c by tools/splash_rle.py
 // Image size: 240x135 pixels
-extern const uint8_t image_data_orca_m5[97200];
+#define ORCA_M5_WIDTH  240
+#define ORCA_M5_HEIGHT 135
+
+// Token stream:
+// - bit 15 set:   repeat run, low 15 bits = count, next word = color
+// - bit 15 clear: literal run, low 15 bits = count, next <count> words = colors
+#define ORCA_M5_RLE_REPEAT 0x8000
+#define ORCA_M5_RLE_COUNT  0x7FFF
+
+extern const uint16_t image_data_orca_m5_rle[];
+extern const uint32_t image_data_orca_m5_rle_len;
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,23 @@
+#ifndef WEB_UI_H
+#define WEB_UI_H
+
+#include <stdint.h>
+#include <pgmspace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Web UI page - minified and gzipped at build time from web/index.html
+// by tools/web_ui_gz.py. Served as-is with Content-Encoding: gzip.
+extern const uint8_t web_ui_gz[];
+extern const uint32_t web_ui_gz_len;
+
+// Strong ETag (quoted) derived from the compressed bytes
+extern const char web_ui_etag[];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
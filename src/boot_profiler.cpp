@@ -0,0 +1,58 @@
+#include "boot_profiler.h"
+
+// Global boot profiler instance
+BootProfiler bootProfiler;
+
+BootProfiler::BootProfiler() {
+    phaseCount = 0;
+    lastMark = 0;
+}
+
+void BootProfiler::mark(const char* phase) {
+    unsigned long now = millis();
+    record(phase, lastMark, now);
+    lastMark = now;
+}
+
+void BootProfiler::record(const char* phase, unsigned long startMs, unsigned long endMs) {
+    if (phaseCount >= MAX_BOOT_PHASES) return;
+    
+    phaseNames[phaseCount] = phase;
+    phaseStart[phaseCount] = startMs;
+    phaseEnd[phaseCount] = endMs;
+    phaseCount++;
+    
+    Serial.printf("[BOOT] %6lums  %s (%lums)\n", endMs, phase, endMs - startMs);
+}
+
+void BootProfiler::printSummary() {
+    Serial.println("[BOOT] Phase            Start     End  Duration");
+    for (int i = 0; i < phaseCount; i++) {
+        Serial.printf("[BOOT] %-14s %6lu  %6lu  %6lums\n",
+                      phaseNames[i], phaseStart[i], phaseEnd[i], phaseEnd[i] - phaseStart[i]);
+    }
+    Serial.printf("[BOOT] Menu ready after %lums\n", getBootTime());
+}
+
+int BootProfiler::getPhaseCount() {
+    return phaseCount;
+}
+
+const char* BootProfiler::getPhaseName(int index) {
+    if (index < 0 || index >= phaseCount) return "";
+    return phaseNames[index];
+}
+
+unsigned long BootProfiler::getPhaseStart(int index) {
+    if (index < 0 || index >= phaseCount) return 0;
+    return phaseStart[index];
+}
+
+unsigned long BootProfiler::getPhaseEnd(int index) {
+    if (index < 0 || index >= phaseCount) return 0;
+    return phaseEnd[index];
+}
+
+unsigned long BootProfiler::getBootTime() {
+    return lastMark;
+}
@@ -0,0 +1,36 @@
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+
+#define MAX_BOOT_PHASES 12
+
+// Records timestamped boot phases (ms since reset) so slow startup steps
+// show up on the serial log, the About screen and the web status.
+class BootProfiler {
+public:
+    BootProfiler();
+    
+    // Sequential phase: runs from the previous mark until now
+    void mark(const char* phase);
+    // Phase that ran in parallel (e.g. in another task)
+    void record(const char* phase, unsigned long startMs, unsigned long endMs);
+    void printSummary();
+    
+    int getPhaseCount();
+    const char* getPhaseName(int index);
+    unsigned long getPhaseStart(int index);
+    unsigned long getPhaseEnd(int index);
+    unsigned long getBootTime();  // ms from reset to the last mark
+    
+private:
+    const char* phaseNames[MAX_BOOT_PHASES];
+    unsigned long phaseStart[MAX_BOOT_PHASES];
+    unsigned long phaseEnd[MAX_BOOT_PHASES];
+    int phaseCount;
+    unsigned long lastMark;
+};
+
+extern BootProfiler bootProfiler;
+
+#endif
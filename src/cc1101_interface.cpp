@@ -1,9 +1,32 @@
 #include "cc1101_interface.h"
 #include <SPI.h>
+#include "span_trace.h"
+#include "metrics.h"
+#include "replay_fidelity.h"
+#include "spi_profiler.h"
+
+#ifdef REPLAY_VERIFY
+// Loopback edge times during a verified replay
+static volatile uint32_t loopbackEdges[FIDELITY_MAX_PULSES + 1];
+static volatile int loopbackEdgeCount = 0;
+
+static void IRAM_ATTR onLoopbackEdge() {
+    if (loopbackEdgeCount < FIDELITY_MAX_PULSES + 1) {
+        loopbackEdges[loopbackEdgeCount++] = micros();
+    }
+}
+#endif
 
 CC1101Interface::CC1101Interface() {
     currentFrequency = FREQ_433_MHZ;
+    programmedFrequency = 0.0;
     initialized = false;
+    
+    // Driver defaults after Init()
+    config.frequency = FREQ_433_MHZ;
+    config.modulation = RADIO_MOD_2FSK;
+    config.dataRate = 99.97;
+    config.rxBandwidth = 812.5;
 }
 
 bool CC1101Interface::begin(ModuleType moduleType) {
@@ -14,7 +37,6 @@ bool CC1101Interface::begin(ModuleType moduleType) {
     // Initialize SPI with correct pins
     Serial.println("[CC1101] Setting up SPI...");
     SPI.begin(CC1101_SCK, CC1101_MISO, CC1101_MOSI, CC1101_CS);
-    delay(100);
     
     // Set BeginEndLogic for M5Stack 2-in-1 module (from Bruce firmware)
     if (moduleType == MODULE_2IN1) {
@@ -27,11 +49,9 @@ bool CC1101Interface::begin(ModuleType moduleType) {
     
     // Configure CC1101 library pins
     ELECHOUSE_cc1101.setSpiPin(CC1101_SCK, CC1101_MISO, CC1101_MOSI, CC1101_CS);
-    delay(100);
     
     // Set GDO0 pin
     ELECHOUSE_cc1101.setGDO0(CC1101_GDO0);
-    delay(100);
     
     // Initialize CC1101 (Bruce method with setBeginEndLogic)
     Serial.println("[CC1101] Calling Init() with Bruce initialization sequence...");
@@ -43,7 +63,8 @@ bool CC1101Interface::begin(ModuleType moduleType) {
         Serial.println("[CC1101] *** MODULE DETECTED AND WORKING! ***");
         initialized = true;
         
-        // Set default frequency
+        // Set default frequency; Init() reset the chip, so always program it
+        programmedFrequency = 0.0;
         setFrequency(433.92);
         
         return true;
@@ -55,7 +76,15 @@ bool CC1101Interface::begin(ModuleType moduleType) {
 }
 
 void CC1101Interface::setFrequency(float freq) {
+    // The mode loops set the frequency every sample; setMHZ() would
+    // rewrite the same carrier and recalibrate each time
+    if (freq == programmedFrequency) return;
+    TRACE_SPAN("radio", "setFrequency");
+    METRIC_TIME(METRIC_RADIO_SET_FREQUENCY);
+    SPI_PROFILE_CALL(SPI_CALL_SET_MHZ);
     currentFrequency = freq;
+    programmedFrequency = freq;
+    config.frequency = freq;
     ELECHOUSE_cc1101.setMHZ(freq);
 }
 
@@ -64,14 +93,20 @@ float CC1101Interface::getFrequency() {
 }
 
 void CC1101Interface::startScan() {
+    SPI_PROFILE_CALL(SPI_CALL_SET_RX);
     ELECHOUSE_cc1101.SetRx();
 }
 
 int CC1101Interface::getRSSI() {
+    TRACE_SPAN("radio", "getRSSI");
+    METRIC_TIME(METRIC_RADIO_GET_RSSI);
+    SPI_PROFILE_CALL(SPI_CALL_GET_RSSI);
     return ELECHOUSE_cc1101.getRssi();
 }
 
 void CC1101Interface::scanSpectrum(float startFreq, float endFreq, float step, int* rssiValues, int numPoints) {
+    TRACE_SPAN("radio", "scanSpectrum");
+    METRIC_TIME(METRIC_RADIO_SWEEP);
     float freq = startFreq;
     for (int i = 0; i < numPoints && freq <= endFreq; i++) {
         setFrequency(freq);
@@ -82,6 +117,7 @@ void CC1101Interface::scanSpectrum(float startFreq, float endFreq, float step, i
 }
 
 void CC1101Interface::setRxMode() {
+    SPI_PROFILE_CALL(SPI_CALL_SET_RX);
     ELECHOUSE_cc1101.SetRx();
 }
 
@@ -103,12 +139,14 @@ void CC1101Interface::setTxMode() {
 }
 
 void CC1101Interface::transmit(byte* data, int len) {
+    TRACE_SPAN("radio", "transmit");
     ELECHOUSE_cc1101.SendData(data, len);
     delay(100);
     ELECHOUSE_cc1101.SetRx(); // Return to RX mode
 }
 
 bool CC1101Interface::recordSignal(int* timings, int maxSamples) {
+    TRACE_SPAN("radio", "recordSignal");
     int sampleCount = 0;
     unsigned long lastTime = micros();
     unsigned long timeout = millis() + 5000; // 5 second timeout
@@ -133,13 +171,41 @@ bool CC1101Interface::recordSignal(int* timings, int maxSamples) {
         }
     }
     
+    // A full buffer cuts the signal short; count the edges lost over the
+    // next few ms so truncated captures show up in /metrics. The signal
+    // may go on for seconds, but waiting for it to end only delays the caller
+    if (sampleCount == maxSamples) {
+        uint32_t dropped = 0;
+        unsigned long drainStart = millis();
+        while (millis() - drainStart < RECORD_DRAIN_MS) {
+            int state = digitalRead(CC1101_GDO0);
+            if (state != lastState) {
+                dropped++;
+                lastState = state;
+            }
+        }
+        metrics.count(METRIC_DROPPED_EDGES, dropped);
+    }
+    
+    // Callers count samples up to the first zero
+    if (sampleCount < maxSamples) timings[sampleCount] = 0;
+    
     return sampleCount > 10; // Need at least some samples
 }
 
 void CC1101Interface::replaySignal(int* timings, int numSamples) {
+    TRACE_SPAN("radio", "replaySignal");
     pinMode(CC1101_GDO0, OUTPUT);
     setTxMode();
     
+#ifdef REPLAY_VERIFY
+    // The interrupt runs on this core, so its latency (a few us) lands in
+    // the pulses being measured; scores are an upper bound on the error
+    loopbackEdgeCount = 0;
+    pinMode(REPLAY_LOOPBACK_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(REPLAY_LOOPBACK_PIN), onLoopbackEdge, CHANGE);
+#endif
+    
     int state = LOW;
     for (int i = 0; i < numSamples; i++) {
         digitalWrite(CC1101_GDO0, state);
@@ -147,6 +213,17 @@ void CC1101Interface::replaySignal(int* timings, int numSamples) {
         state = !state;
     }
     
+#ifdef REPLAY_VERIFY
+    detachInterrupt(digitalPinToInterrupt(REPLAY_LOOPBACK_PIN));
+    // The first LOW goes onto an idle LOW line, so edges start at timings[1]
+    replayFidelity.analyze(REPLAY_BACKEND, timings, numSamples,
+                           (const uint32_t*)loopbackEdges, loopbackEdgeCount, 1);
+    char report[768];
+    replayFidelity.formatReport(report, sizeof(report));
+    Serial.print("[REPLAY] ");
+    Serial.print(report);
+#endif
+    
     pinMode(CC1101_GDO0, INPUT);
     setRxMode();
 }
@@ -157,5 +234,147 @@ void CC1101Interface::setIdleMode() {
 
 void CC1101Interface::setModulation(int mode) {
     // Set modulation: 0=2-FSK, 1=GFSK, 2=ASK/OOK, 3=4-FSK, 4=MSK
+    SPI_PROFILE_CALL(SPI_CALL_SET_MODULATION);
+    config.modulation = mode;
     ELECHOUSE_cc1101.setModulation(mode);
 }
+
+// FREQ2..0 = f * 2^16 / f_xosc
+uint32_t CC1101Interface::frequencyWord(float mhz) {
+    return (uint32_t)(mhz * 65536.0 / CC1101_XTAL_MHZ + 0.5);
+}
+
+// R = (256 + M) * 2^E * f_xosc / 2^28
+void CC1101Interface::dataRateRegisters(float kbaud, uint8_t* exponent, uint8_t* mantissa) {
+    double ratio = kbaud * 1000.0 * 268435456.0 / (CC1101_XTAL_MHZ * 1e6);  // (256 + M) * 2^E
+    int e = 0;
+    while (e < 15 && ratio >= 512.0 * (1 << e)) e++;
+    int m = (int)(ratio / (1 << e) - 256.0 + 0.5);
+    if (m > 255) {
+        m = 0;
+        e++;
+    }
+    if (m < 0) m = 0;
+    *exponent = e;
+    *mantissa = m;
+}
+
+// BW = f_xosc / (8 * (4 + M) * 2^E); picks the narrowest filter that is at
+// least as wide as requested so the signal is not clipped
+void CC1101Interface::bandwidthRegisters(float khz, uint8_t* exponent, uint8_t* mantissa) {
+    *exponent = 0;
+    *mantissa = 0;
+    for (int e = 3; e >= 0; e--) {
+        for (int m = 3; m >= 0; m--) {
+            float bw = CC1101_XTAL_MHZ * 1000.0 / (8 * (4 + m) * (1 << e));
+            if (bw >= khz - 0.5) {
+                *exponent = e;
+                *mantissa = m;
+                return;
+            }
+        }
+    }
+}
+
+bool CC1101Interface::isInBand(float mhz) {
+    return (mhz >= 300.0 && mhz <= 348.0) || (mhz >= 387.0 && mhz <= 464.0) || (mhz >= 779.0 && mhz <= 928.0);
+}
+
+RadioConfigError CC1101Interface::quantizeConfig(const RadioConfig& requested, RadioConfig* actual) {
+    float f = requested.frequency;
+    if (!isInBand(f)) return RADIO_CONFIG_BAD_FREQUENCY;
+    
+    // Data rate limits per modulation (kBaud), from the datasheet
+    float minRate = 0.6;
+    float maxRate;
+    switch (requested.modulation) {
+        case RADIO_MOD_2FSK: maxRate = 500.0; break;
+        case RADIO_MOD_GFSK: maxRate = 250.0; break;
+        case RADIO_MOD_ASK:  maxRate = 250.0; break;
+        case RADIO_MOD_4FSK: maxRate = 300.0; break;
+        case RADIO_MOD_MSK:  minRate = 26.0; maxRate = 500.0; break;
+        default: return RADIO_CONFIG_BAD_MODULATION;
+    }
+    if (!(requested.dataRate >= minRate && requested.dataRate <= maxRate)) return RADIO_CONFIG_BAD_DATA_RATE;
+    if (!(requested.rxBandwidth >= 58.0 && requested.rxBandwidth <= 812.5)) return RADIO_CONFIG_BAD_BANDWIDTH;
+    
+    uint8_t e, m;
+    actual->frequency = frequencyWord(f) * CC1101_XTAL_MHZ / 65536.0;
+    actual->modulation = requested.modulation;
+    dataRateRegisters(requested.dataRate, &e, &m);
+    actual->dataRate = (256.0 + m) * (1UL << e) * CC1101_XTAL_MHZ * 1e6 / 268435456.0 / 1000.0;
+    bandwidthRegisters(requested.rxBandwidth, &e, &m);
+    actual->rxBandwidth = CC1101_XTAL_MHZ * 1000.0 / (8 * (4 + m) * (1 << e));
+    return RADIO_CONFIG_OK;
+}
+
+const char* CC1101Interface::getConfigErrorText(RadioConfigError error) {
+    switch (error) {
+        case RADIO_CONFIG_OK: return "ok";
+        case RADIO_CONFIG_BAD_FREQUENCY: return "Frequency outside 300-348, 387-464, 779-928 MHz";
+        case RADIO_CONFIG_BAD_MODULATION: return "Unknown modulation";
+        case RADIO_CONFIG_BAD_DATA_RATE: return "Data rate not supported by this modulation";
+        case RADIO_CONFIG_BAD_BANDWIDTH: return "RX bandwidth outside 58-812 kHz";
+    }
+    return "Unknown error";
+}
+
+const char* CC1101Interface::getModulationName(int modulation) {
+    switch (modulation) {
+        case RADIO_MOD_2FSK: return "2-FSK";
+        case RADIO_MOD_GFSK: return "GFSK";
+        case RADIO_MOD_ASK: return "ASK/OOK";
+        case RADIO_MOD_4FSK: return "4-FSK";
+        case RADIO_MOD_MSK: return "MSK";
+    }
+    return "?";
+}
+
+RadioConfigError CC1101Interface::applyConfig(const RadioConfig& requested, RadioConfig* actual) {
+    TRACE_SPAN("radio", "applyConfig");
+    RadioConfigError error = quantizeConfig(requested, actual);
+    if (error != RADIO_CONFIG_OK) return error;
+    
+    // The driver keeps its own carrier, modulation and PA level and
+    // recalibrates from them on every setMHZ(), so they go through the
+    // driver first; otherwise the next setFrequency() would undo the burst.
+    // setPA() and setMHZ() also pick the PA table and VCO for the band
+    ELECHOUSE_cc1101.setSidle();
+    ELECHOUSE_cc1101.setModulation(requested.modulation);
+    ELECHOUSE_cc1101.setDRate(actual->dataRate);
+    ELECHOUSE_cc1101.setRxBW(actual->rxBandwidth);
+    ELECHOUSE_cc1101.setPA(RADIO_TX_POWER_DBM);
+    ELECHOUSE_cc1101.setMHZ(actual->frequency);
+    
+    // FSCTRL1..MDMCFG2 are contiguous, so carrier, data rate, filter and
+    // modulation end up exactly as quantized, in one burst
+    static const uint8_t modFormat[] = {0x00, 0x01, 0x03, 0x04, 0x07};
+    uint32_t freq = frequencyWord(requested.frequency);
+    uint8_t drateE, drateM, bwE, bwM;
+    dataRateRegisters(requested.dataRate, &drateE, &drateM);
+    bandwidthRegisters(requested.rxBandwidth, &bwE, &bwM);
+    
+    uint8_t regs[8];
+    regs[0] = ELECHOUSE_cc1101.SpiReadReg(CC1101_FSCTRL1);  // Keep IF frequency
+    regs[1] = ELECHOUSE_cc1101.SpiReadReg(CC1101_FSCTRL0);  // Offset setMHZ() calibrated
+    regs[2] = (freq >> 16) & 0x3F;                          // FREQ2
+    regs[3] = (freq >> 8) & 0xFF;                           // FREQ1
+    regs[4] = freq & 0xFF;                                  // FREQ0
+    regs[5] = (bwE << 6) | (bwM << 4) | drateE;             // MDMCFG4
+    regs[6] = drateM;                                       // MDMCFG3
+    regs[7] = (ELECHOUSE_cc1101.SpiReadReg(CC1101_MDMCFG2) & 0x8F) |
+              (modFormat[requested.modulation] << 4);       // MDMCFG2: keep sync/Manchester
+    
+    ELECHOUSE_cc1101.SpiWriteBurstReg(CC1101_FSCTRL1, regs, sizeof(regs));
+    ELECHOUSE_cc1101.SpiStrobe(CC1101_SCAL);
+    ELECHOUSE_cc1101.SpiStrobe(CC1101_SRX);
+    
+    currentFrequency = actual->frequency;
+    programmedFrequency = actual->frequency;
+    config = *actual;
+    return RADIO_CONFIG_OK;
+}
+
+const RadioConfig& CC1101Interface::getConfig() {
+    return config;
+}
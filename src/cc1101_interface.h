@@ -18,6 +18,12 @@ enum ModuleType {
 #define CC1101_SCK      0   // GPIO0
 #define CC1101_MISO     33  // GPIO33 (Grove SDA)
 
+// Build with -DREPLAY_VERIFY to time every replay through a loopback input
+// and score it against the source timings (replay_fidelity.h). G36 shares
+// the StickC Plus HAT pin with G25, so it sees GDO0 without a jumper
+#define REPLAY_LOOPBACK_PIN 36
+#define REPLAY_BACKEND      "gpio-bitbang"  // How replaySignal drives GDO0
+
 // Common SubGHz frequencies
 #define FREQ_315_MHZ    315.00
 #define FREQ_433_MHZ    433.92
@@ -27,6 +33,40 @@ enum ModuleType {
 // Signal buffer size
 #define MAX_SIGNAL_LENGTH 512
 
+// How long recordSignal keeps counting edges once the buffer is full
+#define RECORD_DRAIN_MS 5
+
+// Crystal frequency of the CC1101 modules in use
+#define CC1101_XTAL_MHZ 26.0
+
+// TX power applyConfig() programs, from the driver's per-band tables
+#define RADIO_TX_POWER_DBM 10
+
+// Modulations, numbered as ELECHOUSE setModulation() takes them
+enum RadioModulation {
+    RADIO_MOD_2FSK = 0,
+    RADIO_MOD_GFSK = 1,
+    RADIO_MOD_ASK  = 2,  // ASK/OOK
+    RADIO_MOD_4FSK = 3,
+    RADIO_MOD_MSK  = 4
+};
+
+// Complete receiver setup: carrier, modulation, data rate, RX filter
+struct RadioConfig {
+    float frequency;    // MHz
+    int modulation;     // RadioModulation
+    float dataRate;     // kBaud
+    float rxBandwidth;  // kHz
+};
+
+enum RadioConfigError {
+    RADIO_CONFIG_OK,
+    RADIO_CONFIG_BAD_FREQUENCY,   // Outside 300-348, 387-464, 779-928 MHz
+    RADIO_CONFIG_BAD_MODULATION,
+    RADIO_CONFIG_BAD_DATA_RATE,   // Outside what the modulation supports
+    RADIO_CONFIG_BAD_BANDWIDTH    // Outside 58-812 kHz
+};
+
 class CC1101Interface {
 public:
     CC1101Interface();
@@ -52,6 +92,17 @@ public:
     void setIdleMode();
     void setModulation(int mode);  // 0=2-FSK, 1=GFSK, 2=ASK/OOK, 3=4-FSK, 4=MSK
     
+    // Full reconfiguration. quantizeConfig() validates a request and
+    // rounds it to what the registers can represent; applyConfig() writes
+    // it in one burst while the radio is idle and reports what was set.
+    // The driver's own settings are updated too, so setFrequency() keeps it.
+    static RadioConfigError quantizeConfig(const RadioConfig& requested, RadioConfig* actual);
+    static bool isInBand(float mhz);
+    static const char* getConfigErrorText(RadioConfigError error);
+    static const char* getModulationName(int modulation);
+    RadioConfigError applyConfig(const RadioConfig& requested, RadioConfig* actual);
+    const RadioConfig& getConfig();
+    
     // Signal recording
     bool recordSignal(int* timings, int maxSamples);
     void replaySignal(int* timings, int numSamples);
@@ -61,7 +112,13 @@ public:
     
 private:
     float currentFrequency;
+    float programmedFrequency;  // Last carrier written to the chip; 0 if unknown
     bool initialized;
+    RadioConfig config;
+    
+    static uint32_t frequencyWord(float mhz);
+    static void dataRateRegisters(float kbaud, uint8_t* exponent, uint8_t* mantissa);
+    static void bandwidthRegisters(float khz, uint8_t* exponent, uint8_t* mantissa);
 };
 
 #endif
@@ -0,0 +1,186 @@
+#include "game_sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int clampInt(int value, int low, int high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+// ==================== DINO JUMP ====================
+#define DINO_JUMP_POWER -10
+#define DINO_GRAVITY    1
+
+void dinoReset(DinoState* state) {
+    memset(state, 0, sizeof(*state));
+    state->dinoY = DINO_GROUND_Y - DINO_SIZE;
+    state->cactusX = GAME_SCREEN_W;
+    state->cactusSpeed = 3;
+}
+
+void dinoStep(DinoState* state, const GameInput& input) {
+    if (state->gameOver) return;
+    state->ticks++;
+
+    if (input.fire && !state->jumping) {
+        state->jumping = true;
+        state->jumpVelocity = DINO_JUMP_POWER;
+    }
+
+    if (state->jumping) {
+        state->dinoY += state->jumpVelocity;
+        state->jumpVelocity += DINO_GRAVITY;
+        if (state->dinoY >= DINO_GROUND_Y - DINO_SIZE) {
+            state->dinoY = DINO_GROUND_Y - DINO_SIZE;
+            state->jumping = false;
+            state->jumpVelocity = 0;
+        }
+    }
+
+    state->cactusX -= state->cactusSpeed;
+    if (state->cactusX < -10) {
+        state->cactusX = GAME_SCREEN_W;
+        state->score++;
+        if (state->score % 5 == 0) state->cactusSpeed++;
+    }
+
+    // The dino has to be a full sprite height up to clear the cactus
+    if (state->cactusX < DINO_X + DINO_SIZE && state->cactusX + CACTUS_W > DINO_X &&
+        state->dinoY + DINO_SIZE > DINO_GROUND_Y - CACTUS_H) {
+        state->gameOver = true;
+    }
+}
+
+// ==================== ARKANOID ====================
+void arkanoidReset(ArkanoidState* state) {
+    memset(state, 0, sizeof(*state));
+    state->paddleX = 120;
+    state->ballX = 120;
+    state->ballY = 60;
+    state->ballVX = 1;
+    state->ballVY = 1;
+    for (int r = 0; r < ARKANOID_ROWS; r++) {
+        for (int c = 0; c < ARKANOID_COLS; c++) {
+            ArkanoidBrick& brick = state->bricks[r * ARKANOID_COLS + c];
+            brick.x = c * 30;
+            brick.y = 20 + r * 10;
+            brick.active = true;
+        }
+    }
+    state->activeBricks = ARKANOID_BRICKS;
+}
+
+void arkanoidStep(ArkanoidState* state, const GameInput& input) {
+    if (state->gameOver) return;
+    state->ticks++;
+
+    state->paddleX += (input.tiltMg * -25) / 1000;
+    state->paddleX = clampInt(state->paddleX, 0, GAME_SCREEN_W - ARKANOID_PADDLE_W);
+
+    state->ballX += state->ballVX;
+    state->ballY += state->ballVY;
+
+    // Walls
+    if (state->ballX <= 2 || state->ballX >= GAME_SCREEN_W - 2) state->ballVX = -state->ballVX;
+    if (state->ballY <= 2) state->ballVY = -state->ballVY;
+
+    // Paddle: always bounces up, with spin from where it hit
+    if (state->ballY >= ARKANOID_PADDLE_Y - 2 && state->ballY <= ARKANOID_PADDLE_Y + 2 &&
+        state->ballX >= state->paddleX && state->ballX <= state->paddleX + ARKANOID_PADDLE_W) {
+        state->ballVY = -abs(state->ballVY);
+        state->ballVX += (state->ballX - (state->paddleX + ARKANOID_PADDLE_W / 2)) / 5;
+    }
+
+    // Every brick under the ball breaks and flips it
+    for (int i = 0; i < ARKANOID_BRICKS; i++) {
+        ArkanoidBrick& brick = state->bricks[i];
+        if (!brick.active) continue;
+        if (state->ballX >= brick.x && state->ballX <= brick.x + ARKANOID_BRICK_W &&
+            state->ballY >= brick.y && state->ballY <= brick.y + ARKANOID_BRICK_H) {
+            brick.active = false;
+            state->activeBricks--;
+            state->ballVY = -state->ballVY;
+            state->score += 10;
+        }
+    }
+
+    if (state->ballY > GAME_SCREEN_H || state->activeBricks == 0) state->gameOver = true;
+}
+
+// ==================== SPACE INVADERS ====================
+void invadersReset(InvadersState* state) {
+    memset(state, 0, sizeof(*state));
+    state->playerX = 115;
+    for (int r = 0; r < INVADERS_ROWS; r++) {
+        for (int c = 0; c < INVADERS_COLS; c++) {
+            InvadersAlien& alien = state->aliens[r * INVADERS_COLS + c];
+            alien.x = c * 20 + 5;
+            alien.y = r * 12 + 20;
+            alien.alive = true;
+            alien.type = r;
+        }
+    }
+    state->aliveCount = INVADERS_ALIENS;
+    state->alienDirX = 1;
+    state->bulletX = -10;
+    state->bulletY = -10;
+}
+
+void invadersStep(InvadersState* state, const GameInput& input) {
+    if (state->gameOver) return;
+    state->ticks++;
+
+    // The shot leaves from where the ship was when A went down
+    if (input.fire && !state->bulletActive) {
+        state->bulletActive = true;
+        state->bulletX = state->playerX + 4;
+        state->bulletY = INVADERS_PLAYER_Y - 4;
+    }
+
+    state->playerX += (input.tiltMg * -20) / 1000;
+    state->playerX = clampInt(state->playerX, 0, 230);
+
+    if (state->bulletActive) {
+        state->bulletY -= 4;
+        if (state->bulletY < 0) {
+            state->bulletActive = false;
+        } else {
+            for (int i = 0; i < INVADERS_ALIENS; i++) {
+                InvadersAlien& alien = state->aliens[i];
+                if (!alien.alive) continue;
+                if (state->bulletX >= alien.x && state->bulletX <= alien.x + INVADERS_ALIEN_W &&
+                    state->bulletY >= alien.y && state->bulletY <= alien.y + INVADERS_ALIEN_H) {
+                    alien.alive = false;
+                    state->aliveCount--;
+                    state->bulletActive = false;
+                    state->score += (3 - alien.type) * 10;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (state->ticks % INVADERS_MOVE_TICKS == 0) {
+        state->alienMoves++;
+        bool hitEdge = false;
+        for (int i = 0; i < INVADERS_ALIENS; i++) {
+            InvadersAlien& alien = state->aliens[i];
+            if (!alien.alive) continue;
+            alien.x += state->alienDirX * 5;
+            if (alien.x <= 0 || alien.x >= 232) hitEdge = true;
+        }
+
+        // Turn around and drop a row; reaching the ship ends the game
+        if (hitEdge) {
+            state->alienDirX = -state->alienDirX;
+            for (int i = 0; i < INVADERS_ALIENS; i++) {
+                InvadersAlien& alien = state->aliens[i];
+                if (!alien.alive) continue;
+                alien.y += 8;
+                if (alien.y >= INVADERS_PLAYER_Y - 10) state->gameOver = true;
+            }
+        }
+    }
+
+    if (state->aliveCount == 0) state->gameOver = true;
+}
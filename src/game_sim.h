@@ -0,0 +1,106 @@
+#ifndef GAME_SIM_H
+#define GAME_SIM_H
+
+#include <stdint.h>
+
+// Game rules with no I/O: each game is a state struct, a reset and a step
+// that advances one tick from explicit inputs. Games drives them from the
+// buttons and IMU and draws the result; host tools step them headless to
+// benchmark or to replay an input log. Integer maths throughout, so a log
+// replays to the same state on any build. Plain C++ with no Arduino
+// dependencies.
+
+#define GAME_SCREEN_W 240
+#define GAME_SCREEN_H 135
+
+#define DINO_TICK_MS     30
+#define ARKANOID_TICK_MS 30
+#define INVADERS_TICK_MS 20
+
+// Inputs for one tick
+struct GameInput {
+    bool fire;       // A pressed since the last tick: jump or shoot
+    int16_t tiltMg;  // Accelerometer Y in milli-g; positive moves left
+};
+
+// ==================== DINO JUMP ====================
+#define DINO_X        30
+#define DINO_GROUND_Y 120
+#define DINO_SIZE     24   // Square sprite
+#define CACTUS_W      12
+#define CACTUS_H      24
+
+struct DinoState {
+    int dinoY;
+    int jumpVelocity;
+    bool jumping;
+    int cactusX;
+    int cactusSpeed;  // Pixels per tick, +1 every 5 points
+    int score;
+    bool gameOver;
+    uint32_t ticks;
+};
+
+void dinoReset(DinoState* state);
+void dinoStep(DinoState* state, const GameInput& input);
+
+// ==================== ARKANOID ====================
+#define ARKANOID_PADDLE_Y 125
+#define ARKANOID_PADDLE_W 30
+#define ARKANOID_COLS     8
+#define ARKANOID_ROWS     4
+#define ARKANOID_BRICKS   (ARKANOID_COLS * ARKANOID_ROWS)
+#define ARKANOID_BRICK_W  28
+#define ARKANOID_BRICK_H  8
+
+struct ArkanoidBrick {
+    int16_t x, y;
+    bool active;
+};
+
+struct ArkanoidState {
+    int paddleX;
+    int ballX, ballY;
+    int ballVX, ballVY;
+    ArkanoidBrick bricks[ARKANOID_BRICKS];  // Row-major, top row first
+    int activeBricks;
+    int score;
+    bool gameOver;   // Ball lost or every brick cleared
+    uint32_t ticks;
+};
+
+void arkanoidReset(ArkanoidState* state);
+void arkanoidStep(ArkanoidState* state, const GameInput& input);
+
+// ==================== SPACE INVADERS ====================
+#define INVADERS_COLS       11
+#define INVADERS_ROWS       3
+#define INVADERS_ALIENS     (INVADERS_COLS * INVADERS_ROWS)
+#define INVADERS_ALIEN_W    8
+#define INVADERS_ALIEN_H    6
+#define INVADERS_PLAYER_Y   120
+#define INVADERS_MOVE_TICKS 26   // Aliens step on the first tick past 500 ms
+
+struct InvadersAlien {
+    int16_t x, y;
+    bool alive;
+    uint8_t type;  // Row: 0 is worth 30, 2 is worth 10
+};
+
+struct InvadersState {
+    int playerX;
+    InvadersAlien aliens[INVADERS_ALIENS];
+    int aliveCount;
+    int alienDirX;
+    uint32_t alienMoves;  // Bumped whenever the formation moves
+    int bulletX, bulletY;
+    bool bulletActive;
+    int score;
+    bool gameOver;   // Aliens landed or all shot
+    uint32_t ticks;
+};
+
+void invadersReset(InvadersState* state);
+void invadersStep(InvadersState* state, const GameInput& input);
+
+#endif
@@ -1,5 +1,6 @@
 #include "games.h"
 #include "menu_system.h"
+#include "idle_scheduler.h"
 
 Games::Games() {
     menuSystem = nullptr;
@@ -9,6 +10,76 @@ void Games::setMenuSystem(MenuSystem* menu) {
     menuSystem = menu;
 }
 
+bool Games::waitTick(unsigned long* lastTick, unsigned long tickMs, bool useTilt, GameInput* input) {
+    // A counts if pressed at any point during the tick, as before the split
+    input->fire = false;
+    while (true) {
+        M5.update();
+        if (M5.BtnB.wasPressed()) return false;
+        if (M5.BtnA.wasPressed()) input->fire = true;
+        if (millis() - *lastTick >= tickMs) break;
+    }
+    *lastTick = millis();
+    
+    // Fresh IMU reading each tick, quantized so the log replays exactly
+    input->tiltMg = 0;
+    if (useTilt) {
+        float accX, accY, accZ;
+        M5.Imu.getAccelData(&accX, &accY, &accZ);
+        input->tiltMg = (int16_t)constrain((int)(accY * 1000), -4000, 4000);
+    }
+    
+#ifdef GAME_INPUT_LOG
+    Serial.printf("[GAME] %d %d\n", input->fire ? 1 : 0, input->tiltMg);
+#endif
+    return true;
+}
+
+void Games::logBegin(const char* game) {
+#ifdef GAME_INPUT_LOG
+    Serial.printf("[GAME] begin %s\n", game);
+#endif
+}
+
+void Games::logEnd(int score, uint32_t ticks) {
+#ifdef GAME_INPUT_LOG
+    Serial.printf("[GAME] end %d %u\n", score, (unsigned)ticks);
+#endif
+}
+
+void Games::exitToMenu() {
+    M5.Lcd.fillScreen(BLACK);
+    M5.Lcd.setTextSize(1);
+    menuSystem->draw();
+}
+
+void Games::drawTitle(const char* title) {
+    M5.Lcd.fillScreen(BLACK);
+    M5.Lcd.setTextSize(1);
+    M5.Lcd.setCursor(5, 5);
+    M5.Lcd.setTextColor(YELLOW, BLACK);
+    M5.Lcd.println(title);
+}
+
+void Games::drawScore(int score) {
+    M5.Lcd.fillRect(200, 5, 35, 10, BLACK);
+    M5.Lcd.setCursor(200, 5);
+    M5.Lcd.setTextColor(WHITE, BLACK);
+    M5.Lcd.printf("%d", score);
+}
+
+void Games::drawGameOver(int score) {
+    M5.Lcd.fillRect(50, 50, 140, 30, RED);
+    M5.Lcd.setCursor(60, 60);
+    M5.Lcd.setTextColor(WHITE, RED);
+    M5.Lcd.setTextSize(2);
+    M5.Lcd.printf("GAME OVER!");
+    M5.Lcd.setCursor(70, 90);
+    M5.Lcd.setTextSize(1);
+    M5.Lcd.setTextColor(YELLOW, BLACK);
+    M5.Lcd.printf("Score: %d", score);
+}
+
 // ==================== DINO JUMP ====================
 void Games::drawDino(int x, int y, bool jumping) {
     // Chrome T-Rex dino sprite (24x24)
@@ -54,104 +125,43 @@ void Games::drawGround(int y) {
     M5.Lcd.drawFastHLine(0, y, 240, WHITE);
 }
 
+void Games::drawDinoScreen(const DinoState& state) {
+    drawTitle("DINO JUMP - A:Jump B:Exit");
+    drawGround(DINO_GROUND_Y);
+}
+
+void Games::renderDino(const DinoState& prev, const DinoState& state) {
+    // The whole play area moves every tick, so it is simply redrawn
+    M5.Lcd.fillRect(0, 20, 240, 100, BLACK);
+    drawDino(DINO_X, state.dinoY, state.jumping);
+    drawCactus(state.cactusX, DINO_GROUND_Y - CACTUS_H);  // Sits on the ground line
+    drawGround(DINO_GROUND_Y);
+    drawScore(state.score);
+}
+
 void Games::runDinoJump() {
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(5, 5);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("DINO JUMP - A:Jump B:Exit");
-    
-    int dinoX = 30;
-    int groundY = 120;
-    int dinoY = groundY - 24;  // Updated for 24px tall dino (20x24 sprite)
-    int jumpVelocity = 0;
-    bool jumping = false;
-    const int jumpPower = -10;  // Stronger jump for bigger dino
-    const int gravity = 1;
-    
-    int cactusX = 240;
-    int cactusSpeed = 3;
-    int score = 0;
-    bool gameOver = false;
+    DinoState state;
+    dinoReset(&state);
+    drawDinoScreen(state);
+    logBegin("dino");
     
-    drawGround(groundY);
-    
-    unsigned long lastUpdate = millis();
-    
-    while (!gameOver) {
-        M5.update();
-        
-        // Check exit button
-        if (M5.BtnB.wasPressed()) {
-            M5.Lcd.fillScreen(BLACK);
-            M5.Lcd.setTextSize(1);
-            menuSystem->draw();
+    unsigned long lastTick = millis();
+    GameInput input;
+    while (!state.gameOver) {
+        if (!waitTick(&lastTick, DINO_TICK_MS, false, &input)) {
+            logEnd(state.score, state.ticks);
+            exitToMenu();
             return;
         }
-        
-        // Check jump button immediately
-        if (M5.BtnA.wasPressed() && !jumping) {
-            jumping = true;
-            jumpVelocity = jumpPower;
-        }
-        
-        if (millis() - lastUpdate < 30) continue;
-        lastUpdate = millis();
-        
-        // Physics
-        if (jumping) {
-            dinoY += jumpVelocity;
-            jumpVelocity += gravity;
-            
-            if (dinoY >= groundY - 24) {
-                dinoY = groundY - 24;
-                jumping = false;
-                jumpVelocity = 0;
-            }
-        }
-        
-        // Move cactus
-        cactusX -= cactusSpeed;
-        if (cactusX < -10) {
-            cactusX = 240;
-            score++;
-            if (score % 5 == 0) cactusSpeed++;
-        }
-        
-        // Collision detection (adjusted for larger sprites)
-        if (cactusX < dinoX + 24 && cactusX + 12 > dinoX &&
-            dinoY + 24 > groundY - 24) {
-            gameOver = true;
-        }
-        
-        // Draw
-        M5.Lcd.fillRect(0, 20, 240, 100, BLACK);
-        drawDino(dinoX, dinoY, jumping);
-        drawCactus(cactusX, groundY - 24);  // Cactus is 24px tall, sits on ground line
-        drawGround(groundY);
-        
-        // Score
-        M5.Lcd.fillRect(200, 5, 35, 10, BLACK);
-        M5.Lcd.setCursor(200, 5);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("%d", score);
+        DinoState prev = state;
+        dinoStep(&state, input);
+        renderDino(prev, state);
     }
+    logEnd(state.score, state.ticks);
     
-    // Game Over
-    M5.Lcd.fillRect(50, 50, 140, 30, RED);
-    M5.Lcd.setCursor(60, 60);
-    M5.Lcd.setTextColor(WHITE, RED);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.printf("GAME OVER!");
-    M5.Lcd.setCursor(70, 90);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.printf("Score: %d", score);
-    
-    delay(3000);
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    menuSystem->draw();
+    drawGameOver(state.score);
+    idleScheduler.hold(3000);
+    exitToMenu();
 }
 
 // ==================== ARKANOID ====================
@@ -168,124 +178,57 @@ void Games::drawBrick(int x, int y, uint16_t color) {
     M5.Lcd.drawRect(x, y, 28, 8, BLACK);
 }
 
-void Games::runArkanoid() {
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(5, 5);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("ARKANOID - Tilt:Move B:Exit");
-    
-    int paddleX = 120;
-    int paddleY = 125;
-    int paddleWidth = 30;
-    
-    int ballX = 120;
-    int ballY = 60;
-    int ballVX = 1;  // Reduced from 2 to 1
-    int ballVY = 1;  // Reduced from 2 to 1
-    
-    // Bricks (8 columns x 4 rows)
-    const int brickCols = 8;
-    const int brickRows = 4;
-    Brick bricks[brickRows * brickCols];
-    uint16_t colors[] = {RED, ORANGE, YELLOW, GREEN};
+static const uint16_t brickColors[ARKANOID_ROWS] = {RED, ORANGE, YELLOW, GREEN};
+
+void Games::drawArkanoidScreen(const ArkanoidState& state) {
+    drawTitle("ARKANOID - Tilt:Move B:Exit");
+    for (int i = 0; i < ARKANOID_BRICKS; i++) {
+        const ArkanoidBrick& brick = state.bricks[i];
+        if (brick.active) drawBrick(brick.x, brick.y, brickColors[i / ARKANOID_COLS]);
+    }
+}
+
+void Games::renderArkanoid(const ArkanoidState& prev, const ArkanoidState& state) {
+    // Clear old positions
+    M5.Lcd.fillCircle(prev.ballX, prev.ballY, 3, BLACK);
+    M5.Lcd.fillRect(0, ARKANOID_PADDLE_Y, 240, 6, BLACK);
     
-    for (int r = 0; r < brickRows; r++) {
-        for (int c = 0; c < brickCols; c++) {
-            int idx = r * brickCols + c;
-            bricks[idx].x = c * 30;
-            bricks[idx].y = 20 + r * 10;
-            bricks[idx].active = true;
-            bricks[idx].color = colors[r];
-            drawBrick(bricks[idx].x, bricks[idx].y, bricks[idx].color);
+    // Bricks broken this tick
+    for (int i = 0; i < ARKANOID_BRICKS; i++) {
+        const ArkanoidBrick& brick = state.bricks[i];
+        if (prev.bricks[i].active && !brick.active) {
+            M5.Lcd.fillRect(brick.x, brick.y, ARKANOID_BRICK_W, ARKANOID_BRICK_H, BLACK);
         }
     }
     
-    int score = 0;
-    int activeBricks = brickRows * brickCols;
-    bool gameOver = false;
-    unsigned long lastUpdate = millis();
+    drawBall(state.ballX, state.ballY);
+    drawPaddle(state.paddleX, ARKANOID_PADDLE_Y, ARKANOID_PADDLE_W);
+    drawScore(state.score);
+}
+
+void Games::runArkanoid() {
+    ArkanoidState state;
+    arkanoidReset(&state);
+    drawArkanoidScreen(state);
+    logBegin("arkanoid");
     
-    while (!gameOver && activeBricks > 0) {
-        M5.update();
-        
-        if (M5.BtnB.wasPressed()) {
-            M5.Lcd.fillScreen(BLACK);
-            M5.Lcd.setTextSize(1);
-            menuSystem->draw();
+    unsigned long lastTick = millis();
+    GameInput input;
+    while (!state.gameOver) {
+        if (!waitTick(&lastTick, ARKANOID_TICK_MS, true, &input)) {
+            logEnd(state.score, state.ticks);
+            exitToMenu();
             return;
         }
-        
-        if (millis() - lastUpdate < 30) continue;  // Increased from 20ms to 30ms
-        lastUpdate = millis();
-        
-        // Move paddle with accelerometer (get fresh data each frame)
-        float accX, accY, accZ;
-        M5.Imu.getAccelData(&accX, &accY, &accZ);
-        paddleX += (int)(accY * -25);  // Reduced sensitivity from -30 to -25
-        paddleX = constrain(paddleX, 0, 240 - paddleWidth);
-        
-        // Clear old positions
-        M5.Lcd.fillCircle(ballX, ballY, 3, BLACK);
-        M5.Lcd.fillRect(0, paddleY, 240, 6, BLACK);
-        
-        // Move ball
-        ballX += ballVX;
-        ballY += ballVY;
-        
-        // Wall collision
-        if (ballX <= 2 || ballX >= 238) ballVX = -ballVX;
-        if (ballY <= 2) ballVY = -ballVY;
-        
-        // Paddle collision
-        if (ballY >= paddleY - 2 && ballY <= paddleY + 2 &&
-            ballX >= paddleX && ballX <= paddleX + paddleWidth) {
-            ballVY = -abs(ballVY);
-            ballVX += (ballX - (paddleX + paddleWidth/2)) / 5;
-        }
-        
-        // Brick collision
-        for (int i = 0; i < brickRows * brickCols; i++) {
-            if (bricks[i].active) {
-                if (ballX >= bricks[i].x && ballX <= bricks[i].x + 28 &&
-                    ballY >= bricks[i].y && ballY <= bricks[i].y + 8) {
-                    bricks[i].active = false;
-                    M5.Lcd.fillRect(bricks[i].x, bricks[i].y, 28, 8, BLACK);
-                    ballVY = -ballVY;
-                    score += 10;
-                }
-            }
-        }
-        
-        // Bottom out
-        if (ballY > 135) gameOver = true;
-        
-        // Draw
-        drawBall(ballX, ballY);
-        drawPaddle(paddleX, paddleY, paddleWidth);
-        
-        // Score
-        M5.Lcd.fillRect(200, 5, 35, 10, BLACK);
-        M5.Lcd.setCursor(200, 5);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("%d", score);
+        ArkanoidState prev = state;
+        arkanoidStep(&state, input);
+        renderArkanoid(prev, state);
     }
+    logEnd(state.score, state.ticks);
     
-    // Game Over
-    M5.Lcd.fillRect(50, 50, 140, 30, RED);
-    M5.Lcd.setCursor(60, 60);
-    M5.Lcd.setTextColor(WHITE, RED);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.printf("GAME OVER!");
-    M5.Lcd.setCursor(70, 90);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.printf("Score: %d", score);
-    
-    delay(3000);
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    menuSystem->draw();
+    drawGameOver(state.score);
+    idleScheduler.hold(3000);
+    exitToMenu();
 }
 
 // ==================== SPACE INVADERS ====================
@@ -308,158 +251,75 @@ void Games::drawBullet(int x, int y, bool playerBullet) {
     M5.Lcd.fillRect(x, y, 2, 4, playerBullet ? CYAN : RED);
 }
 
-void Games::runSpaceInvaders() {
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(5, 5);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("SPACE INVADERS A:Shoot B:Exit");
-    
-    int playerX = 115;
-    int playerY = 120;
-    
-    // Aliens (11 columns x 3 rows)
-    const int alienCols = 11;
-    const int alienRows = 3;
-    Alien aliens[alienRows * alienCols];
-    
-    for (int r = 0; r < alienRows; r++) {
-        for (int c = 0; c < alienCols; c++) {
-            int idx = r * alienCols + c;
-            aliens[idx].x = c * 20 + 5;
-            aliens[idx].y = r * 12 + 20;
-            aliens[idx].alive = true;
-            aliens[idx].type = r;
-            drawAlien(aliens[idx].x, aliens[idx].y, aliens[idx].type);
-        }
+void Games::drawInvadersScreen(const InvadersState& state) {
+    drawTitle("SPACE INVADERS A:Shoot B:Exit");
+    for (int i = 0; i < INVADERS_ALIENS; i++) {
+        const InvadersAlien& alien = state.aliens[i];
+        if (alien.alive) drawAlien(alien.x, alien.y, alien.type);
     }
+}
+
+void Games::renderInvaders(const InvadersState& prev, const InvadersState& state) {
+    // Clear old player sprite completely (including the turret)
+    M5.Lcd.fillRect(prev.playerX, INVADERS_PLAYER_Y - 2, 10, 8, BLACK);
+    drawPlayer(state.playerX, INVADERS_PLAYER_Y);
     
-    int alienDirX = 1;
-    int alienStepDown = 0;
-    
-    int bulletX = -10;
-    int bulletY = -10;
-    bool bulletActive = false;
-    
-    int score = 0;
-    bool gameOver = false;
-    unsigned long lastUpdate = millis();
-    unsigned long lastAlienMove = millis();
+    if (prev.bulletActive) M5.Lcd.fillRect(prev.bulletX, prev.bulletY, 2, 4, BLACK);
+    if (state.bulletActive) drawBullet(state.bulletX, state.bulletY, true);
     
-    while (!gameOver) {
-        M5.update();
-        
-        if (M5.BtnB.wasPressed()) {
-            M5.Lcd.fillScreen(BLACK);
-            M5.Lcd.setTextSize(1);
-            menuSystem->draw();
-            return;
+    if (state.alienMoves != prev.alienMoves) {
+        // The formation stepped: redraw it where it is now
+        for (int i = 0; i < INVADERS_ALIENS; i++) {
+            const InvadersAlien& alien = prev.aliens[i];
+            if (alien.alive) M5.Lcd.fillRect(alien.x, alien.y, INVADERS_ALIEN_W, INVADERS_ALIEN_H, BLACK);
         }
-        
-        // Check shoot button immediately (before frame delay)
-        if (M5.BtnA.wasPressed() && !bulletActive) {
-            bulletActive = true;
-            bulletX = playerX + 4;
-            bulletY = playerY - 4;
+        for (int i = 0; i < INVADERS_ALIENS; i++) {
+            const InvadersAlien& alien = state.aliens[i];
+            if (alien.alive) drawAlien(alien.x, alien.y, alien.type);
         }
-        
-        if (millis() - lastUpdate < 20) continue;
-        lastUpdate = millis();
-        
-        // Move player with accelerometer
-        float accX, accY, accZ;
-        M5.Imu.getAccelData(&accX, &accY, &accZ);
-        // Clear old player sprite completely (including the turret)
-        M5.Lcd.fillRect(playerX, playerY - 2, 10, 8, BLACK);
-        playerX += (int)(accY * -20);  // Use accY for left/right tilt, increased sensitivity
-        playerX = constrain(playerX, 0, 230);
-        drawPlayer(playerX, playerY);
-        
-        // Move bullet
-        if (bulletActive) {
-            M5.Lcd.fillRect(bulletX, bulletY, 2, 4, BLACK);
-            bulletY -= 4;
-            if (bulletY < 0) {
-                bulletActive = false;
-            } else {
-                drawBullet(bulletX, bulletY, true);
-                
-                // Check alien collision
-                for (int i = 0; i < alienRows * alienCols; i++) {
-                    if (aliens[i].alive) {
-                        if (bulletX >= aliens[i].x && bulletX <= aliens[i].x + 8 &&
-                            bulletY >= aliens[i].y && bulletY <= aliens[i].y + 6) {
-                            aliens[i].alive = false;
-                            M5.Lcd.fillRect(aliens[i].x, aliens[i].y, 8, 6, BLACK);
-                            bulletActive = false;
-                            score += (3 - aliens[i].type) * 10;
-                            break;
-                        }
-                    }
-                }
+    } else {
+        // Only aliens shot this tick
+        for (int i = 0; i < INVADERS_ALIENS; i++) {
+            const InvadersAlien& alien = prev.aliens[i];
+            if (alien.alive && !state.aliens[i].alive) {
+                M5.Lcd.fillRect(alien.x, alien.y, INVADERS_ALIEN_W, INVADERS_ALIEN_H, BLACK);
             }
         }
-        
-        // Move aliens
-        if (millis() - lastAlienMove > 500) {
-            lastAlienMove = millis();
-            
-            bool hitEdge = false;
-            for (int i = 0; i < alienRows * alienCols; i++) {
-                if (aliens[i].alive) {
-                    M5.Lcd.fillRect(aliens[i].x, aliens[i].y, 8, 6, BLACK);
-                    aliens[i].x += alienDirX * 5;
-                    if (aliens[i].x <= 0 || aliens[i].x >= 232) hitEdge = true;
-                }
-            }
-            
-            if (hitEdge) {
-                alienDirX = -alienDirX;
-                for (int i = 0; i < alienRows * alienCols; i++) {
-                    if (aliens[i].alive) {
-                        aliens[i].y += 8;
-                        if (aliens[i].y >= playerY - 10) gameOver = true;
-                    }
-                }
-            }
-            
-            // Redraw aliens
-            for (int i = 0; i < alienRows * alienCols; i++) {
-                if (aliens[i].alive) {
-                    drawAlien(aliens[i].x, aliens[i].y, aliens[i].type);
-                }
-            }
-        }
-        
-        // Score
-        M5.Lcd.fillRect(200, 5, 35, 10, BLACK);
-        M5.Lcd.setCursor(200, 5);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("%d", score);
-        
-        // Check win
-        bool anyAlive = false;
-        for (int i = 0; i < alienRows * alienCols; i++) {
-            if (aliens[i].alive) {
-                anyAlive = true;
-                break;
-            }
+    }
+    
+    drawScore(state.score);
+}
+
+void Games::runSpaceInvaders() {
+    InvadersState state;
+    invadersReset(&state);
+    drawInvadersScreen(state);
+    logBegin("invaders");
+    
+    unsigned long lastTick = millis();
+    GameInput input;
+    while (!state.gameOver) {
+        if (!waitTick(&lastTick, INVADERS_TICK_MS, true, &input)) {
+            logEnd(state.score, state.ticks);
+            exitToMenu();
+            return;
         }
-        if (!anyAlive) gameOver = true;
+        InvadersState prev = state;
+        invadersStep(&state, input);
+        renderInvaders(prev, state);
     }
+    logEnd(state.score, state.ticks);
     
     // Game Over / Win
-    M5.Lcd.fillRect(30, 50, 180, 40, score > 200 ? GREEN : RED);
+    M5.Lcd.fillRect(30, 50, 180, 40, state.score > 200 ? GREEN : RED);
     M5.Lcd.setCursor(50, 55);
     M5.Lcd.setTextColor(WHITE);
     M5.Lcd.setTextSize(2);
-    M5.Lcd.printf(score > 200 ? "YOU WIN!" : "GAME OVER!");
+    M5.Lcd.printf(state.score > 200 ? "YOU WIN!" : "GAME OVER!");
     M5.Lcd.setCursor(70, 75);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.printf("Score: %d", score);
+    M5.Lcd.printf("Score: %d", state.score);
     
-    delay(3000);
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    menuSystem->draw();
+    idleScheduler.hold(3000);
+    exitToMenu();
 }
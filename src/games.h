@@ -3,43 +3,56 @@
 
 #include <Arduino.h>
 #include <M5StickCPlus.h>
+#include "game_sim.h"
 
 class MenuSystem;
 
+// The games' rules live in game_sim.h; this class feeds them buttons and
+// IMU tilt once per tick and draws the result. Build with -DGAME_INPUT_LOG
+// to print every tick's inputs over serial as [GAME] lines, which the host
+// tool subghz_games replays.
 class Games {
 public:
     Games();
     void setMenuSystem(MenuSystem* menu);
-    
+
     // Game launchers
     void runDinoJump();
     void runArkanoid();
     void runSpaceInvaders();
-    
+
+    // Renderers: the whole screen for a fresh game, then what changed from
+    // one tick's state to the next
+    void drawDinoScreen(const DinoState& state);
+    void renderDino(const DinoState& prev, const DinoState& state);
+    void drawArkanoidScreen(const ArkanoidState& state);
+    void renderArkanoid(const ArkanoidState& prev, const ArkanoidState& state);
+    void drawInvadersScreen(const InvadersState& state);
+    void renderInvaders(const InvadersState& prev, const InvadersState& state);
+
 private:
     MenuSystem* menuSystem;
-    
+
+    // Polls the buttons until the next tick is due; false if B was pressed
+    bool waitTick(unsigned long* lastTick, unsigned long tickMs, bool useTilt, GameInput* input);
+    void logBegin(const char* game);
+    void logEnd(int score, uint32_t ticks);
+    void exitToMenu();
+    void drawTitle(const char* title);
+    void drawScore(int score);
+    void drawGameOver(int score);
+
     // Dino Jump
     void drawDino(int x, int y, bool jumping);
     void drawCactus(int x, int y);
     void drawGround(int y);
-    
+
     // Arkanoid
-    struct Brick {
-        int x, y;
-        bool active;
-        uint16_t color;
-    };
     void drawPaddle(int x, int y, int width);
     void drawBall(int x, int y);
     void drawBrick(int x, int y, uint16_t color);
-    
+
     // Space Invaders
-    struct Alien {
-        int x, y;
-        bool alive;
-        int type;
-    };
     void drawAlien(int x, int y, int type);
     void drawPlayer(int x, int y);
     void drawBullet(int x, int y, bool playerBullet);
@@ -0,0 +1,99 @@
+#include "heap_monitor.h"
+
+// Global heap monitor instance
+HeapMonitor heapMonitor;
+
+HeapMonitor::HeapMonitor() {
+    sampleCount = 0;
+    lastSample = 0;
+    freeHeap = 0;
+    largestBlock = 0;
+    minFreeHeap = 0;
+    taskCount = 0;
+    warned = false;
+}
+
+void HeapMonitor::update() {
+    if (sampleCount > 0 && millis() - lastSample < HEAP_SAMPLE_INTERVAL_MS) return;
+    sample();
+}
+
+void HeapMonitor::sample() {
+    lastSample = millis();
+    freeHeap = ESP.getFreeHeap();
+    largestBlock = ESP.getMaxAllocHeap();
+    minFreeHeap = ESP.getMinFreeHeap();
+    sampleTasks();
+    sampleCount++;
+
+    // Log once per excursion, not every second
+    bool warning = isFragmented() || isStackLow();
+    if (warning && !warned) {
+        Serial.printf("[HEAP] Warning: %lu free, largest block %lu (%d%% fragmented), min free %lu, "
+                      "lowest stack %s %luB\n",
+                      (unsigned long)freeHeap, (unsigned long)largestBlock, getFragmentation(),
+                      (unsigned long)minFreeHeap, taskCount > 0 ? tasks[0].name : "-",
+                      taskCount > 0 ? (unsigned long)tasks[0].highWater : 0UL);
+    }
+    warned = warning;
+}
+
+void HeapMonitor::sampleTasks() {
+    static TaskStatus_t status[HEAP_MAX_TASKS];
+    // Lists nothing if there are more tasks than slots
+    UBaseType_t count = uxTaskGetSystemState(status, HEAP_MAX_TASKS, NULL);
+
+    // Insertion sort by headroom; the list is short
+    taskCount = 0;
+    for (UBaseType_t i = 0; i < count; i++) {
+        TaskStackInfo info;
+        strncpy(info.name, status[i].pcTaskName, HEAP_TASK_NAME_LEN - 1);
+        info.name[HEAP_TASK_NAME_LEN - 1] = '\0';
+        info.highWater = status[i].usStackHighWaterMark;
+        info.core = (status[i].xCoreID == tskNO_AFFINITY) ? -1 : status[i].xCoreID;
+
+        int j = taskCount++;
+        while (j > 0 && tasks[j - 1].highWater > info.highWater) {
+            tasks[j] = tasks[j - 1];
+            j--;
+        }
+        tasks[j] = info;
+    }
+}
+
+uint32_t HeapMonitor::getSampleCount() {
+    return sampleCount;
+}
+
+uint32_t HeapMonitor::getFreeHeap() {
+    return freeHeap;
+}
+
+uint32_t HeapMonitor::getLargestBlock() {
+    return largestBlock;
+}
+
+uint32_t HeapMonitor::getMinFreeHeap() {
+    return minFreeHeap;
+}
+
+int HeapMonitor::getFragmentation() {
+    if (freeHeap == 0) return 0;
+    return 100 - (int)((uint64_t)largestBlock * 100 / freeHeap);
+}
+
+int HeapMonitor::getTaskCount() {
+    return taskCount;
+}
+
+const TaskStackInfo& HeapMonitor::getTask(int index) {
+    return tasks[index];
+}
+
+bool HeapMonitor::isFragmented() {
+    return getFragmentation() >= HEAP_FRAG_WARN_PCT;
+}
+
+bool HeapMonitor::isStackLow() {
+    return taskCount > 0 && tasks[0].highWater < HEAP_STACK_WARN_BYTES;
+}
@@ -0,0 +1,56 @@
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <Arduino.h>
+
+#define HEAP_SAMPLE_INTERVAL_MS 1000
+#define HEAP_MAX_TASKS          20    // Tasks listed per sample
+#define HEAP_TASK_NAME_LEN      16
+#define HEAP_FRAG_WARN_PCT      70    // Largest block vs. free heap
+#define HEAP_STACK_WARN_BYTES   512   // Stack headroom left in any task
+
+struct TaskStackInfo {
+    char name[HEAP_TASK_NAME_LEN];
+    uint32_t highWater;  // Bytes of stack never used
+    int8_t core;         // -1 if not pinned
+};
+
+// Samples free heap, the largest allocatable block, the low-water mark of
+// free heap and every FreeRTOS task's stack high-water mark. Fragmentation
+// is how much of the free heap can't be had in one allocation; the ESP32
+// heap spans several regions, so a fresh boot already reads 40-50%.
+class HeapMonitor {
+public:
+    HeapMonitor();
+    void update();  // Samples every HEAP_SAMPLE_INTERVAL_MS
+    void sample();
+
+    uint32_t getSampleCount();
+    uint32_t getFreeHeap();
+    uint32_t getLargestBlock();
+    uint32_t getMinFreeHeap();
+    int getFragmentation();  // Percent
+
+    // Sorted by high-water mark, least headroom first
+    int getTaskCount();
+    const TaskStackInfo& getTask(int index);
+
+    bool isFragmented();
+    bool isStackLow();
+
+private:
+    uint32_t sampleCount;
+    unsigned long lastSample;
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+    uint32_t minFreeHeap;
+    TaskStackInfo tasks[HEAP_MAX_TASKS];
+    int taskCount;
+    bool warned;
+
+    void sampleTasks();
+};
+
+extern HeapMonitor heapMonitor;
+
+#endif
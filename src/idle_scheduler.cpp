@@ -0,0 +1,152 @@
+#include "idle_scheduler.h"
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+
+// M5StickC Plus buttons (active low)
+#define BUTTON_A_GPIO GPIO_NUM_37
+#define BUTTON_B_GPIO GPIO_NUM_39
+
+// Global idle scheduler instance
+IdleScheduler idleScheduler;
+
+static const char* idleModeNames[IDLE_MODE_COUNT] = {
+    "Idle", "Scanning", "Spectrum", "Listening", "Recording", "Replaying"
+};
+
+IdleScheduler::IdleScheduler() {
+    enabled = true;
+    sleepAllowed = true;
+    currentMode = MODE_IDLE;
+    modeSince = 0;
+    for (int i = 0; i < IDLE_MODE_COUNT; i++) {
+        totalUs[i] = 0;
+        sleepUs[i] = 0;
+        waitUs[i] = 0;
+    }
+    wakeCount = 0;
+    buttonWakeCount = 0;
+    lastReport = 0;
+}
+
+void IdleScheduler::begin() {
+    // Buttons wake the CPU from light sleep; the power button sits behind
+    // the AXP192 and is picked up on the next timer wake-up
+    gpio_wakeup_enable(BUTTON_A_GPIO, GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable(BUTTON_B_GPIO, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    
+    modeSince = esp_timer_get_time();
+    lastReport = millis();
+}
+
+void IdleScheduler::idle(unsigned long ms) {
+#if IDLE_REPORT_INTERVAL_MS > 0
+    if (millis() - lastReport >= IDLE_REPORT_INTERVAL_MS) {
+        lastReport = millis();
+        printReport();
+    }
+#endif
+    
+    if (ms == 0) return;  // Work is already due
+    
+    int64_t start = esp_timer_get_time();
+    
+    if (!enabled || !sleepAllowed || ms < IDLE_MIN_SLEEP_MS) {
+        delay(min(ms, (unsigned long)IDLE_MAX_WAIT_MS));
+        waitUs[currentMode] += esp_timer_get_time() - start;
+        return;
+    }
+    
+    Serial.flush();  // UART output is lost across light sleep
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+    esp_light_sleep_start();
+    
+    sleepUs[currentMode] += esp_timer_get_time() - start;
+    wakeCount++;
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO) {
+        buttonWakeCount++;
+    }
+}
+
+void IdleScheduler::hold(unsigned long ms) {
+    unsigned long start = millis();
+    while (millis() - start < ms) {
+        idle(ms - (millis() - start));
+    }
+}
+
+void IdleScheduler::setEnabled(bool enable) {
+    enabled = enable;
+}
+
+bool IdleScheduler::isEnabled() {
+    return enabled;
+}
+
+void IdleScheduler::setSleepAllowed(bool allowed) {
+    sleepAllowed = allowed;
+}
+
+void IdleScheduler::setMode(OperationMode mode) {
+    if ((int)mode == currentMode) return;
+    accountModeTime();
+    currentMode = constrain((int)mode, 0, IDLE_MODE_COUNT - 1);
+}
+
+unsigned long IdleScheduler::getTotalTime(int mode) {
+    if (mode < 0 || mode >= IDLE_MODE_COUNT) return 0;
+    accountModeTime();
+    return totalUs[mode] / 1000;
+}
+
+int IdleScheduler::getActivePermille(int mode) {
+    if (mode < 0 || mode >= IDLE_MODE_COUNT) return 0;
+    accountModeTime();
+    return permille(totalUs[mode] - sleepUs[mode] - waitUs[mode], totalUs[mode]);
+}
+
+int IdleScheduler::getSleepPermille(int mode) {
+    if (mode < 0 || mode >= IDLE_MODE_COUNT) return 0;
+    accountModeTime();
+    return permille(sleepUs[mode], totalUs[mode]);
+}
+
+unsigned long IdleScheduler::getWakeCount() {
+    return wakeCount;
+}
+
+unsigned long IdleScheduler::getButtonWakeCount() {
+    return buttonWakeCount;
+}
+
+const char* IdleScheduler::getModeName(int mode) {
+    if (mode < 0 || mode >= IDLE_MODE_COUNT) return "";
+    return idleModeNames[mode];
+}
+
+void IdleScheduler::printReport() {
+    accountModeTime();
+    Serial.printf("[IDLE] Light sleep %s, %lu wakeups (%lu by button)\n",
+                  (enabled && sleepAllowed) ? "on" : "off", wakeCount, buttonWakeCount);
+    for (int i = 0; i < IDLE_MODE_COUNT; i++) {
+        if (totalUs[i] == 0) continue;
+        int active = permille(totalUs[i] - sleepUs[i] - waitUs[i], totalUs[i]);
+        int wait = permille(waitUs[i], totalUs[i]);
+        int sleep = permille(sleepUs[i], totalUs[i]);
+        Serial.printf("[IDLE] %-10s active %3d.%d%%  wait %3d.%d%%  sleep %3d.%d%%  (%lus)\n",
+                      idleModeNames[i], active / 10, active % 10, wait / 10, wait % 10,
+                      sleep / 10, sleep % 10, (unsigned long)(totalUs[i] / 1000000));
+    }
+}
+
+void IdleScheduler::accountModeTime() {
+    int64_t now = esp_timer_get_time();
+    totalUs[currentMode] += now - modeSince;
+    modeSince = now;
+}
+
+int IdleScheduler::permille(uint64_t part, uint64_t total) {
+    if (total == 0) return 0;
+    return (int)((part * 1000) / total);
+}
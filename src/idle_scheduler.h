@@ -0,0 +1,65 @@
+#ifndef IDLE_SCHEDULER_H
+#define IDLE_SCHEDULER_H
+
+#include <Arduino.h>
+#include "menu_system.h"
+
+#define IDLE_MIN_SLEEP_MS  3   // Shorter gaps aren't worth the wake-up latency
+#define IDLE_MAX_WAIT_MS   5   // Longest plain delay when light sleep isn't allowed
+#define IDLE_MODE_COUNT    6   // MODE_IDLE .. MODE_REPLAYING
+
+// Build with -DIDLE_DUTY_TEST to print the per-mode duty cycle report
+// over serial every 10 seconds
+#ifdef IDLE_DUTY_TEST
+#define IDLE_REPORT_INTERVAL_MS 10000
+#else
+#define IDLE_REPORT_INTERVAL_MS 0
+#endif
+
+// Replaces busy delay() loops. Between radio samples and UI frames the
+// ESP32 is put into light sleep, woken by the timer or by button A/B.
+// Time spent active, waiting and sleeping is tracked per operating mode.
+class IdleScheduler {
+public:
+    IdleScheduler();
+    void begin();
+    
+    // Wait up to ms; returns early if a button wakes the CPU
+    void idle(unsigned long ms);
+    // Wait the full ms (display holds such as game over screens)
+    void hold(unsigned long ms);
+    
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    void setSleepAllowed(bool allowed);  // e.g. false while the WiFi AP is up
+    void setMode(OperationMode mode);
+    
+    // Duty cycle per operating mode, in permille of wall time
+    unsigned long getTotalTime(int mode);   // ms
+    int getActivePermille(int mode);
+    int getSleepPermille(int mode);
+    unsigned long getWakeCount();
+    unsigned long getButtonWakeCount();
+    const char* getModeName(int mode);
+    void printReport();
+    
+private:
+    bool enabled;
+    bool sleepAllowed;
+    int currentMode;
+    int64_t modeSince;
+    
+    uint64_t totalUs[IDLE_MODE_COUNT];
+    uint64_t sleepUs[IDLE_MODE_COUNT];
+    uint64_t waitUs[IDLE_MODE_COUNT];
+    unsigned long wakeCount;
+    unsigned long buttonWakeCount;
+    unsigned long lastReport;
+    
+    void accountModeTime();
+    int permille(uint64_t part, uint64_t total);
+};
+
+extern IdleScheduler idleScheduler;
+
+#endif
@@ -0,0 +1,53 @@
+#include "json_response.h"
+
+char JsonResponse::scratch[JSON_RESPONSE_MAX_LEN];
+
+JsonResponse::JsonResponse(int code) : writer(scratch, sizeof(scratch)) {
+    _code = code;
+    _contentType = "application/json";
+    body = nullptr;
+    offset = 0;
+}
+
+JsonResponse::~JsonResponse() {
+    delete[] body;
+}
+
+JsonWriter& JsonResponse::json() {
+    return writer;
+}
+
+void JsonResponse::setBody(const char* data, size_t length) {
+    delete[] body;
+    body = new char[length];
+    memcpy(body, data, length);
+    _contentLength = length;
+}
+
+void JsonResponse::_respond(AsyncWebServerRequest* request) {
+    if (body == nullptr) {
+        if (writer.overflowed()) {
+            _code = 500;
+            writer.reset();
+            writer.beginObject();
+            writer.field("error", "Response too large");
+            writer.endObject();
+        }
+        _contentLength = writer.length();
+        body = new char[_contentLength];
+        memcpy(body, scratch, _contentLength);
+    }
+    AsyncAbstractResponse::_respond(request);
+}
+
+bool JsonResponse::_sourceValid() const {
+    return true;
+}
+
+size_t JsonResponse::_fillBuffer(uint8_t* data, size_t maxLen) {
+    size_t remaining = _contentLength - offset;
+    size_t n = (remaining < maxLen) ? remaining : maxLen;
+    memcpy(data, body + offset, n);
+    offset += n;
+    return n;
+}
@@ -0,0 +1,34 @@
+#ifndef JSON_RESPONSE_H
+#define JSON_RESPONSE_H
+
+#include <ESPAsyncWebServer.h>
+#include "json_writer.h"
+
+#define JSON_RESPONSE_MAX_LEN 1536
+
+// Async response for JSON bodies. Handlers serialize with json() into one
+// shared scratch buffer, which is safe because they all run in the async
+// TCP task and send before returning. On send the body is copied into a
+// heap block of exactly its length, and the server streams it to the
+// socket from there. A short error reply therefore costs tens of bytes,
+// not JSON_RESPONSE_MAX_LEN, and no String is built per request.
+// Oversized bodies become a 500 error.
+class JsonResponse : public AsyncAbstractResponse {
+public:
+    JsonResponse(int code = 200);
+    ~JsonResponse();
+    JsonWriter& json();
+    void setBody(const char* data, size_t length);  // Pre-serialized JSON
+
+    void _respond(AsyncWebServerRequest* request) override;
+    bool _sourceValid() const override;
+    size_t _fillBuffer(uint8_t* data, size_t maxLen) override;
+
+private:
+    static char scratch[JSON_RESPONSE_MAX_LEN];
+    JsonWriter writer;
+    char* body;  // Set by setBody() or on send
+    size_t offset;
+};
+
+#endif
@@ -0,0 +1,180 @@
+#include "json_writer.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <math.h>
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity) {
+    buf = buffer;
+    this->capacity = capacity;
+    reset();
+}
+
+void JsonWriter::reset() {
+    len = 0;
+    overflow = false;
+    depth = 0;
+    hasItems = 0;
+    afterKey = false;
+    if (capacity > 0) buf[0] = '\0';
+}
+
+void JsonWriter::beginObject() {
+    open('{');
+}
+
+void JsonWriter::endObject() {
+    close('}');
+}
+
+void JsonWriter::beginArray() {
+    open('[');
+}
+
+void JsonWriter::endArray() {
+    close(']');
+}
+
+void JsonWriter::key(const char* name) {
+    separator();
+    putString(name);
+    put(':');
+    afterKey = true;
+}
+
+void JsonWriter::value(const char* text) {
+    separator();
+    putString(text);
+}
+
+void JsonWriter::putString(const char* text) {
+    put('"');
+    for (const char* p = text; *p; p++) {
+        unsigned char c = *p;
+        switch (c) {
+            case '"':  put("\\\""); break;
+            case '\\': put("\\\\"); break;
+            case '\n': put("\\n"); break;
+            case '\r': put("\\r"); break;
+            case '\t': put("\\t"); break;
+            default:
+                if (c < 0x20) {
+                    appendf("\\u%04x", c);
+                } else {
+                    put((char)c);
+                }
+        }
+    }
+    put('"');
+}
+
+void JsonWriter::value(bool flag) {
+    separator();
+    put(flag ? "true" : "false");
+}
+
+void JsonWriter::value(int number) {
+    separator();
+    appendf("%d", number);
+}
+
+void JsonWriter::value(long number) {
+    separator();
+    appendf("%ld", number);
+}
+
+void JsonWriter::value(unsigned int number) {
+    separator();
+    appendf("%u", number);
+}
+
+void JsonWriter::value(unsigned long number) {
+    separator();
+    appendf("%lu", number);
+}
+
+void JsonWriter::value(double number, int decimals) {
+    separator();
+    // JSON has no NaN/Infinity
+    if (isnan(number) || isinf(number)) {
+        put("null");
+        return;
+    }
+    appendf("%.*f", decimals, number);
+}
+
+void JsonWriter::valueNull() {
+    separator();
+    put("null");
+}
+
+const char* JsonWriter::c_str() const {
+    return buf;
+}
+
+size_t JsonWriter::length() const {
+    return len;
+}
+
+bool JsonWriter::overflowed() const {
+    return overflow;
+}
+
+// Emits the comma between items; a value right after its key needs none
+void JsonWriter::separator() {
+    if (afterKey) {
+        afterKey = false;
+        return;
+    }
+    if (depth == 0) return;
+    uint32_t bit = 1UL << (depth - 1);
+    if (hasItems & bit) put(',');
+    hasItems |= bit;
+}
+
+void JsonWriter::open(char c) {
+    separator();
+    put(c);
+    if (depth < JSON_WRITER_MAX_DEPTH) {
+        depth++;
+        hasItems &= ~(1UL << (depth - 1));
+    } else {
+        overflow = true;
+    }
+}
+
+void JsonWriter::close(char c) {
+    if (depth > 0) depth--;
+    put(c);
+}
+
+void JsonWriter::put(char c) {
+    if (len + 1 < capacity) {
+        buf[len++] = c;
+        buf[len] = '\0';
+    } else {
+        overflow = true;
+    }
+}
+
+void JsonWriter::put(const char* text) {
+    while (*text) put(*text++);
+}
+
+void JsonWriter::appendf(const char* format, ...) {
+    if (len >= capacity) {
+        overflow = true;
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf + len, capacity - len, format, args);
+    va_end(args);
+
+    if (n < 0 || (size_t)n >= capacity - len) {
+        // Drop the partial number rather than emit a truncated one
+        buf[len] = '\0';
+        overflow = true;
+        return;
+    }
+    len += n;
+}
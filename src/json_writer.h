@@ -0,0 +1,76 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JSON_WRITER_MAX_DEPTH 16
+
+// Streaming JSON serializer into a caller-owned fixed buffer. Never
+// allocates: output that does not fit is dropped and overflowed() is set,
+// and the buffer always stays NUL-terminated.
+//
+//   char buf[128];
+//   JsonWriter json(buf, sizeof(buf));
+//   json.beginObject();
+//   json.field("status", "listening");
+//   json.field("frequency", 433.92f);
+//   json.endObject();
+//
+// Plain C++ with no Arduino dependencies.
+class JsonWriter {
+public:
+    JsonWriter(char* buffer, size_t capacity);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    // Object member name; the next value or begin*() call is its value
+    void key(const char* name);
+
+    void value(const char* text);  // Escaped string
+    void value(bool flag);
+    void value(int number);
+    void value(long number);
+    void value(unsigned int number);
+    void value(unsigned long number);
+    void value(double number, int decimals = 2);
+    void valueNull();
+
+    // key() + value() in one call
+    template <typename T>
+    void field(const char* name, T v) {
+        key(name);
+        value(v);
+    }
+    void field(const char* name, double number, int decimals) {
+        key(name);
+        value(number, decimals);
+    }
+
+    const char* c_str() const;
+    size_t length() const;
+    bool overflowed() const;
+    void reset();
+
+private:
+    char* buf;
+    size_t capacity;
+    size_t len;
+    bool overflow;
+    int depth;
+    uint32_t hasItems;  // Bit per nesting level: a comma is due before the next item
+    bool afterKey;
+
+    void separator();
+    void open(char c);
+    void close(char c);
+    void put(char c);
+    void put(const char* text);
+    void putString(const char* text);  // Quoted and escaped
+    void appendf(const char* format, ...);
+};
+
+#endif
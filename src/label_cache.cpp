@@ -0,0 +1,147 @@
+#include "label_cache.h"
+
+// Global label cache instance
+LabelCache labelCache;
+
+// Built-in GLCD font cell size at text size 1
+#define LABEL_CHAR_WIDTH  6
+#define LABEL_CHAR_HEIGHT 8
+
+LabelCache::LabelCache() {
+    for (int i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        entries[i].sprite = nullptr;
+    }
+    bytesUsed = 0;
+    useCounter = 0;
+    hits = 0;
+    misses = 0;
+}
+
+int LabelCache::draw(int x, int y, const char* text, uint16_t fgColor, uint16_t bgColor, uint8_t size) {
+    Entry* entry = find(text, fgColor, bgColor, size);
+    
+    if (entry == nullptr) {
+        misses++;
+        
+        int width = strlen(text) * LABEL_CHAR_WIDTH * size;
+        int height = LABEL_CHAR_HEIGHT * size;
+        int bytes = width * height * 2;
+        
+        // Too long to key or too big to keep - render straight to the panel
+        if (strlen(text) >= LABEL_CACHE_MAX_TEXT || bytes > LABEL_CACHE_MAX_BYTES || width == 0) {
+            return drawDirect(x, y, text, fgColor, bgColor, size);
+        }
+        
+        entry = allocate(bytes);
+        entry->sprite = new TFT_eSprite(&M5.Lcd);
+        entry->sprite->setColorDepth(16);
+        if (entry->sprite->createSprite(width, height) == nullptr) {
+            delete entry->sprite;
+            entry->sprite = nullptr;
+            return drawDirect(x, y, text, fgColor, bgColor, size);
+        }
+        
+        entry->sprite->fillSprite(bgColor);
+        entry->sprite->setTextSize(size);
+        entry->sprite->setTextColor(fgColor, bgColor);
+        entry->sprite->setCursor(0, 0);
+        entry->sprite->print(text);
+        
+        strcpy(entry->text, text);
+        entry->size = size;
+        entry->fgColor = fgColor;
+        entry->bgColor = bgColor;
+        entry->width = width;
+        entry->height = height;
+        bytesUsed += bytes;
+    } else {
+        hits++;
+    }
+    
+    entry->lastUsed = ++useCounter;
+    entry->sprite->pushSprite(x, y);
+    return x + entry->width;
+}
+
+void LabelCache::clear() {
+    for (int i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].sprite != nullptr) {
+            evict(&entries[i]);
+        }
+    }
+}
+
+int LabelCache::getEntryCount() {
+    int count = 0;
+    for (int i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].sprite != nullptr) count++;
+    }
+    return count;
+}
+
+int LabelCache::getBytesUsed() {
+    return bytesUsed;
+}
+
+unsigned long LabelCache::getHits() {
+    return hits;
+}
+
+unsigned long LabelCache::getMisses() {
+    return misses;
+}
+
+LabelCache::Entry* LabelCache::find(const char* text, uint16_t fgColor, uint16_t bgColor, uint8_t size) {
+    for (int i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        Entry* entry = &entries[i];
+        if (entry->sprite != nullptr && entry->size == size &&
+            entry->fgColor == fgColor && entry->bgColor == bgColor &&
+            strcmp(entry->text, text) == 0) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+LabelCache::Entry* LabelCache::allocate(int bytes) {
+    while (true) {
+        Entry* freeSlot = nullptr;
+        Entry* oldest = nullptr;
+        
+        for (int i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+            Entry* entry = &entries[i];
+            if (entry->sprite == nullptr) {
+                if (freeSlot == nullptr) freeSlot = entry;
+            } else if (oldest == nullptr || entry->lastUsed < oldest->lastUsed) {
+                oldest = entry;
+            }
+        }
+        
+        if (freeSlot != nullptr && bytesUsed + bytes <= LABEL_CACHE_MAX_BYTES) {
+            return freeSlot;
+        }
+        
+        // Out of slots or over budget - drop the least recently used label
+        evict(oldest);
+    }
+}
+
+void LabelCache::evict(Entry* entry) {
+    bytesUsed -= entry->width * entry->height * 2;
+    entry->sprite->deleteSprite();
+    delete entry->sprite;
+    entry->sprite = nullptr;
+}
+
+int LabelCache::drawDirect(int x, int y, const char* text, uint16_t fgColor, uint16_t bgColor, uint8_t size) {
+    // Put the cursor back, as the sprite path never moves it
+    int16_t cursorX = M5.Lcd.getCursorX();
+    int16_t cursorY = M5.Lcd.getCursorY();
+    M5.Lcd.setTextSize(size);
+    M5.Lcd.setTextColor(fgColor, bgColor);
+    M5.Lcd.setCursor(x, y);
+    M5.Lcd.print(text);
+    int end = M5.Lcd.getCursorX();
+    M5.Lcd.setCursor(cursorX, cursorY);
+    return end;
+}
@@ -0,0 +1,56 @@
+#ifndef LABEL_CACHE_H
+#define LABEL_CACHE_H
+
+#include <Arduino.h>
+#include <M5StickCPlus.h>
+
+#define LABEL_CACHE_MAX_ENTRIES 48
+#define LABEL_CACHE_MAX_BYTES   24576  // RGB565 pixel budget across all labels
+#define LABEL_CACHE_MAX_TEXT    32
+
+// Pre-rendered text labels for static screen chrome. Each label is
+// rasterized once into an RGB565 sprite keyed by text, size and colors;
+// later draws are a single block push. Least recently used labels are
+// evicted to stay within LABEL_CACHE_MAX_BYTES.
+class LabelCache {
+public:
+    LabelCache();
+    
+    // Draw text at (x, y) and return the x position just past it. Unlike
+    // print() this never moves the LCD cursor, so a print that follows needs
+    // its own setCursor(); text size and colors may be left as given here.
+    int draw(int x, int y, const char* text, uint16_t fgColor, uint16_t bgColor, uint8_t size = 1);
+    void clear();
+    
+    int getEntryCount();
+    int getBytesUsed();
+    unsigned long getHits();
+    unsigned long getMisses();
+    
+private:
+    struct Entry {
+        char text[LABEL_CACHE_MAX_TEXT];
+        uint8_t size;
+        uint16_t fgColor;
+        uint16_t bgColor;
+        int width;
+        int height;
+        unsigned long lastUsed;
+        TFT_eSprite* sprite;
+    };
+    
+    Entry entries[LABEL_CACHE_MAX_ENTRIES];
+    int bytesUsed;
+    unsigned long useCounter;
+    unsigned long hits;
+    unsigned long misses;
+    
+    Entry* find(const char* text, uint16_t fgColor, uint16_t bgColor, uint8_t size);
+    Entry* allocate(int bytes);
+    void evict(Entry* entry);
+    int drawDirect(int x, int y, const char* text, uint16_t fgColor, uint16_t bgColor, uint8_t size);
+};
+
+extern LabelCache labelCache;
+
+#endif
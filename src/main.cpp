@@ -24,61 +24,131 @@
 #include "menu_system.h"
 #include "subghz_operations.h"
 #include "wifi_ap.h"
+#include "boot_profiler.h"
+#include "ui_scheduler.h"
+#include "idle_scheduler.h"
+#include "span_trace.h"
+#include "metrics.h"
+#include "heap_monitor.h"
 
 // Global objects
 CC1101Interface cc1101;
 MenuSystem menu;
 SubGhzOperations operations(&cc1101, &menu);
 WiFiAP wifiAP(&operations, &menu);
+UIScheduler uiScheduler(&menu, &operations);
 
 // Include orca image data
 #include "orca_m5.h"
 
 // Splash screen
+// The orca is stored as RLE-compressed RGB565 (see tools/splash_rle.py).
+// Decode it into a band of rows and push each band in one transfer.
+#define SPLASH_BAND_ROWS 27  // 5 bands, ~13KB buffer
+
 void showSplashScreen() {
-    // Draw orca image (240x135, 24-bit RGB)
-    // Convert 24-bit RGB to RGB565 on the fly
-    uint16_t* lineBuffer = (uint16_t*)malloc(240 * sizeof(uint16_t));
-    
-    for (int y = 0; y < 135; y++) {
-        for (int x = 0; x < 240; x++) {
-            int idx = (y * 240 + x) * 3;
-            uint8_t r = image_data_orca_m5[idx];
-            uint8_t g = image_data_orca_m5[idx + 1];
-            uint8_t b = image_data_orca_m5[idx + 2];
+    uint16_t* band = (uint16_t*)malloc(ORCA_M5_WIDTH * SPLASH_BAND_ROWS * sizeof(uint16_t));
+    if (band == nullptr) {
+        Serial.println("[MAIN] Splash: out of memory");
+        return;
+    }
+    
+    const uint16_t* src = image_data_orca_m5_rle;
+    const uint16_t* end = image_data_orca_m5_rle + image_data_orca_m5_rle_len;
+    uint16_t runLeft = 0;
+    bool repeat = false;
+    uint16_t color = 0;
+    
+    M5.Lcd.startWrite();
+    for (int y = 0; y < ORCA_M5_HEIGHT; y += SPLASH_BAND_ROWS) {
+        int rows = min(SPLASH_BAND_ROWS, ORCA_M5_HEIGHT - y);
+        int needed = rows * ORCA_M5_WIDTH;
+        int filled = 0;
+        
+        while (filled < needed) {
+            if (runLeft == 0) {
+                if (src >= end) {
+                    // Truncated stream - pad with black
+                    memset(band + filled, 0, (needed - filled) * sizeof(uint16_t));
+                    break;
+                }
+                uint16_t token = *src++;
+                repeat = (token & ORCA_M5_RLE_REPEAT) != 0;
+                runLeft = token & ORCA_M5_RLE_COUNT;
+                if (repeat) color = *src++;
+            }
             
-            // Convert to RGB565
-            lineBuffer[x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+            int n = min((int)runLeft, needed - filled);
+            if (repeat) {
+                for (int i = 0; i < n; i++) band[filled + i] = color;
+            } else {
+                memcpy(band + filled, src, n * sizeof(uint16_t));
+                src += n;
+            }
+            filled += n;
+            runLeft -= n;
         }
-        M5.Lcd.pushImage(0, y, 240, 1, lineBuffer);
+        
+        M5.Lcd.pushImage(0, y, ORCA_M5_WIDTH, rows, band);
     }
+    M5.Lcd.endWrite();
     
-    free(lineBuffer);
-    delay(2000);
+    free(band);
+}
+
+// Boot timing
+#define SPLASH_MIN_MS          800   // Splash stays up at least this long
+#define RADIO_INIT_TIMEOUT_MS  5000  // Give up waiting on a hung CC1101 Init()
+
+// CC1101 bring-up runs in its own task while the splash is on screen.
+// The task finishing and setup() timing out race to claim radioInitState;
+// if setup() wins it deletes the task, so a hung Init() that comes back
+// late cannot drive the CC1101 while loop() is using it
+#define RADIO_INIT_RUNNING   0
+#define RADIO_INIT_DONE      1
+#define RADIO_INIT_ABANDONED 2
+volatile int radioInitState = RADIO_INIT_RUNNING;
+volatile bool radioInitOk = false;
+volatile unsigned long radioInitStart = 0;
+volatile unsigned long radioInitEnd = 0;
+TaskHandle_t radioInitHandle = NULL;
+
+void radioInitTask(void* param) {
+    radioInitStart = millis();
+    bool ok = cc1101.begin(menu.getModuleType());
+    if (ok) {
+        cc1101.setFrequency(menu.getSelectedFrequency());
+    }
+    radioInitOk = ok;
+    radioInitEnd = millis();
+    if (!__sync_bool_compare_and_swap(&radioInitState, RADIO_INIT_RUNNING, RADIO_INIT_DONE)) {
+        // setup() gave up on us and is deleting this task
+        for (;;) vTaskDelay(portMAX_DELAY);
+    }
+    vTaskDelete(NULL);
 }
 
 void setup() {
     // Initialize M5StickC Plus
     M5.begin();
     M5.Lcd.setRotation(3);
+    bootProfiler.mark("m5 init");
     
     // Initialize IMU (accelerometer/gyroscope)
     M5.Imu.Init();
+    bootProfiler.mark("imu init");
     
     // Initialize Serial for debugging
     Serial.begin(115200);
-    delay(500);
     Serial.println("\n\n=== SubGHz Tool Starting ===");
+    bootProfiler.mark("serial");
     
     // Show splash screen
     showSplashScreen();
+    unsigned long splashStart = millis();
+    bootProfiler.mark("splash");
     
-    // Initialize menu system
-    menu.begin();
-    
-    Serial.println("\n[MAIN] Menu initialized");
-    
-    // Initialize CC1101
+    // Initialize CC1101 in the background while the splash is shown
     M5.Lcd.fillRect(30, 100, 180, 30, BLACK);
     M5.Lcd.setCursor(30, 100);
     M5.Lcd.setTextColor(YELLOW, BLACK);
@@ -86,7 +156,21 @@ void setup() {
     M5.Lcd.println("Init CC1101...");
     
     Serial.println("[MAIN] Initializing CC1101...");
-    bool cc1101_ok = cc1101.begin(menu.getModuleType());
+    xTaskCreatePinnedToCore(radioInitTask, "cc1101_init", 4096, NULL, 1, &radioInitHandle, 0);
+    
+    while (radioInitState == RADIO_INIT_RUNNING && millis() - splashStart < RADIO_INIT_TIMEOUT_MS) {
+        delay(5);
+    }
+    bool timedOut = __sync_bool_compare_and_swap(&radioInitState, RADIO_INIT_RUNNING, RADIO_INIT_ABANDONED);
+    bool cc1101_ok = !timedOut && radioInitOk;
+    if (!timedOut) {
+        bootProfiler.record("cc1101 init", radioInitStart, radioInitEnd);
+    } else {
+        vTaskDelete(radioInitHandle);
+        // The task may not have been scheduled at all
+        bootProfiler.record("cc1101 init", radioInitStart != 0 ? radioInitStart : splashStart, millis());
+        Serial.println("[MAIN] CC1101 init timed out");
+    }
     
     if (cc1101_ok) {
         M5.Lcd.fillRect(30, 100, 180, 20, BLACK);
@@ -94,8 +178,6 @@ void setup() {
         M5.Lcd.setTextColor(GREEN, BLACK);
         M5.Lcd.println("CC1101 Ready!");
         Serial.println("[MAIN] CC1101 initialized successfully!");
-        cc1101.setFrequency(menu.getSelectedFrequency());
-        delay(1500);
     } else {
         M5.Lcd.fillRect(30, 100, 180, 30, BLACK);
         M5.Lcd.setCursor(30, 100);
@@ -107,6 +189,17 @@ void setup() {
         delay(3000);
     }
     
+    // Splash time is a minimum, not an added cost
+    while (millis() - splashStart < SPLASH_MIN_MS) {
+        delay(5);
+    }
+    bootProfiler.mark("radio wait");
+    
+    // Initialize menu system
+    menu.begin();
+    
+    Serial.println("\n[MAIN] Menu initialized");
+    
     // Initialize operations
     operations.begin();
     
@@ -116,41 +209,61 @@ void setup() {
     // Connect WiFi AP to menu
     menu.setWiFiAP(&wifiAP);
     
+    // Let the web status report UI frame metrics
+    wifiAP.setUIScheduler(&uiScheduler);
+    
     // Seed random for dummy data
     randomSeed(analogRead(0));
     
+    // Light sleep between radio samples and UI frames
+    idleScheduler.begin();
+    
+    // Span tracing ('t' on serial or GET /trace dumps it)
+    spanTrace.begin();
+    
+    // Heap and stack telemetry, resampled once a second from loop()
+    heapMonitor.sample();
+    Serial.printf("[HEAP] %lu free, largest block %lu\n",
+                  (unsigned long)heapMonitor.getFreeHeap(), (unsigned long)heapMonitor.getLargestBlock());
+    
     Serial.println("[MAIN] Setup complete!");
     
     // Clear screen for menu
     M5.Lcd.fillScreen(BLACK);
+    bootProfiler.mark("menu");
+    bootProfiler.printSummary();
 }
 
 void loop() {
-    // Update menu system (handles button inputs)
-    menu.update();
+    metrics.markLoop();
     
-    // Draw menu/screen only when needed
-    static MenuState lastState = MENU_MAIN;
-    MenuState currentState = menu.getState();
-    
-    bool shouldDraw = false;
-    
-    // Only redraw if state changed or menu explicitly flagged redraw needed
-    if (currentState != lastState || menu.needsRedraw()) {
-        shouldDraw = true;
-        lastState = currentState;
+    {
+        TRACE_SPAN("loop", "loop");
+        
+        // Heap and stack telemetry (About screen, /status)
+        heapMonitor.update();
+        
+        // Update menu system (handles button inputs)
+        menu.update();
+        
+        // Radio work for the current mode (publishes new state, no drawing)
+        operations.update();
+        
+        // Render at a fixed rate from the latest state, skipping idle frames
+        uiScheduler.update();
+        
+        // Update WiFi AP (handles web server)
+        wifiAP.update();
     }
     
-    if (shouldDraw) {
-        menu.draw();
-        menu.clearRedrawFlag();
+    // Serial 't' dumps the span trace as Chrome trace JSON
+    if (Serial.available() > 0 && Serial.read() == 't') {
+        spanTrace.dumpToSerial();
     }
     
-    // Update operations based on current mode (AFTER menu draw so operations draw on top)
-    operations.update();
-    
-    // Update WiFi AP (handles web server)
-    wifiAP.update();
-    
-    delay(20);
+    // Sleep until the next radio sample or UI frame is due. Light sleep
+    // would drop the AP, so only plain waits while it is up
+    idleScheduler.setMode(menu.getMode());
+    idleScheduler.setSleepAllowed(!wifiAP.isActive());
+    idleScheduler.idle(min(operations.getTimeUntilNextUpdate(), uiScheduler.getTimeUntilNextFrame()));
 }
@@ -2,6 +2,11 @@
 #include "subghz_operations.h"
 #include "games.h"
 #include "wifi_ap.h"
+#include "boot_profiler.h"
+#include "label_cache.h"
+#include "span_trace.h"
+#include "heap_monitor.h"
+#include "spi_profiler.h"
 
 // Global games instance
 Games games;
@@ -18,11 +23,17 @@ MenuSystem::MenuSystem() {
     operations = nullptr;
     wifiAP = nullptr;
     freqIndex = 1; // Default to 433MHz
+    freqChanges = 0;
+    aboutDrawn = false;
+    aboutHeapSample = 0;
+    spiViewMode = MODE_IDLE;
+    spiDrawnMs = 0;
     
     frequencies[0] = 315.00;
     frequencies[1] = 433.92;
     frequencies[2] = 868.00;
     frequencies[3] = 915.00;
+    frequencies[FREQ_CUSTOM_INDEX] = 433.92;  // Set remotely via setFrequency()
     
     lastUpdate = 0;
     buttonAPressed = false;
@@ -32,7 +43,7 @@ MenuSystem::MenuSystem() {
 }
 
 void MenuSystem::begin() {
-    M5.begin();
+    // M5.begin() already ran in setup()
     M5.Lcd.setRotation(3);
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(2);
@@ -40,8 +51,19 @@ void MenuSystem::begin() {
 }
 
 void MenuSystem::update() {
-    M5.update();
+    {
+        TRACE_SPAN("input", "M5.update");
+        M5.update();
+    }
     handleButtons();
+    
+    // The About screen shows live heap figures
+    if (currentState == MENU_ABOUT && heapMonitor.getSampleCount() != aboutHeapSample) {
+        redrawNeeded = true;
+    }
+    if (currentState == MENU_SPI_BUS && millis() - spiDrawnMs >= SPI_SCREEN_REFRESH_MS) {
+        redrawNeeded = true;
+    }
 }
 
 void MenuSystem::draw() {
@@ -79,6 +101,9 @@ void MenuSystem::draw() {
         case MENU_ABOUT:
             drawAboutScreen();
             break;
+        case MENU_SPI_BUS:
+            drawSpiBusScreen();
+            break;
     }
 }
 
@@ -102,6 +127,22 @@ float MenuSystem::getSelectedFrequency() {
     return frequencies[freqIndex];
 }
 
+void MenuSystem::setFrequency(float mhz) {
+    // Select the matching preset, otherwise use the custom slot
+    int index = FREQ_CUSTOM_INDEX;
+    for (int i = 0; i < FREQ_PRESET_COUNT; i++) {
+        if (fabsf(frequencies[i] - mhz) < 0.001) {
+            index = i;
+            break;
+        }
+    }
+    if (index == FREQ_CUSTOM_INDEX) {
+        frequencies[FREQ_CUSTOM_INDEX] = mhz;
+    }
+    freqIndex = index;
+    freqChanges++;
+}
+
 ModuleType MenuSystem::getModuleType() {
     return moduleType;
 }
@@ -226,6 +267,11 @@ void MenuSystem::buttonA() {
         } else if (settingsSelection == 1) {
             // Enter About screen
             currentState = MENU_ABOUT;
+            aboutDrawn = false;
+        } else if (settingsSelection == 2) {
+            // Enter SPI bus screen on the mode with the most traffic
+            currentState = MENU_SPI_BUS;
+            spiViewMode = spiProfiler.getBusiestMode();
         }
     }
 }
@@ -233,7 +279,7 @@ void MenuSystem::buttonA() {
 void MenuSystem::buttonB() {
     // Back/Cancel button
     redrawNeeded = true;  // Button pressed, need redraw
-    if (currentState == MENU_ABOUT) {
+    if (currentState == MENU_ABOUT || currentState == MENU_SPI_BUS) {
         currentState = MENU_SETTINGS;
     } else if (currentState == MENU_HACKS) {
         // Go back to main menu
@@ -275,48 +321,48 @@ void MenuSystem::buttonPower() {
         gamesSelection = (gamesSelection - 1 + 3) % 3;  // Navigate games menu (3 items)
     } else if (currentState == MENU_SETTINGS) {
         redrawNeeded = true;  // Settings navigation needs redraw
-        // Toggle between Module Type and About
-        settingsSelection = (settingsSelection + 1) % 2;
+        // Cycle Module Type, About, SPI Bus
+        settingsSelection = (settingsSelection + 1) % 3;
+    } else if (currentState == MENU_SPI_BUS) {
+        redrawNeeded = true;
+        spiViewMode = (spiViewMode + 1) % SPI_PROFILE_MODES;
     } else if (currentState != MENU_ABOUT) {
         // In operational screens, just cycle frequency (no full redraw needed)
         // Operations handle their own display updates
-        freqIndex = (freqIndex + 1) % 4;
+        // A custom frequency falls back into the preset cycle
+        freqIndex = (freqIndex + 1) % FREQ_PRESET_COUNT;
+        freqChanges++;
     }
 }
 
 void MenuSystem::drawMainMenu() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("Seraph's SubGHz Tool");
+    labelCache.draw(10, 5, "Seraph's SubGHz Tool", ORANGE, BLACK);
     
     int y = 20;
     const char* menuItems[] = {"Scan", "Spectrum", "Listen", "Record", "Replay", "Hacks", "Games", "WiFi AP", "Settings"};
     
+    char label[LABEL_CACHE_MAX_TEXT];
     for (int i = 0; i < maxMenuItems; i++) {
-        M5.Lcd.setCursor(10, y);
+        snprintf(label, sizeof(label), "%c%s", (i == menuSelection) ? '>' : ' ', menuItems[i]);
         if (i == menuSelection) {
-            M5.Lcd.setTextColor(BLACK, GREEN);
-            M5.Lcd.print(">");
+            labelCache.draw(10, y, label, BLACK, GREEN);
         } else {
-            M5.Lcd.setTextColor(WHITE, BLACK);
-            M5.Lcd.print(" ");
+            labelCache.draw(10, y, label, WHITE, BLACK);
         }
-        M5.Lcd.print(menuItems[i]);
         y += 13;
     }
     
     // Show current frequency (lower right)
-    M5.Lcd.setCursor(135, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.printf("%.2fMHz", frequencies[freqIndex]);
+    snprintf(label, sizeof(label), "%.2fMHz", frequencies[freqIndex]);
+    labelCache.draw(135, 120, label, YELLOW, BLACK);
 }
 
 void MenuSystem::drawScanScreen() {
     // Only draw static elements - waveform is drawn by drawRSSIWaveform()
     static MenuState lastDrawnState = MENU_ABOUT;
-    static int lastFreqIndex = -1;
+    static int lastFreqChanges = -1;
     static bool screenValid = false;
     
     // Only execute if we're actually in this mode
@@ -326,23 +372,19 @@ void MenuSystem::drawScanScreen() {
     }
     
     // Redraw if we just entered this screen or frequency changed
-    if (!screenValid || currentState != lastDrawnState || freqIndex != lastFreqIndex) {
+    if (!screenValid || currentState != lastDrawnState || freqChanges != lastFreqChanges) {
         M5.Lcd.fillScreen(BLACK);
         M5.Lcd.setTextSize(1);
-        M5.Lcd.setCursor(10, 5);
-        M5.Lcd.setTextColor(ORANGE, BLACK);
-        M5.Lcd.println("SCANNING");
+        labelCache.draw(10, 5, "SCANNING", ORANGE, BLACK);
         
-        M5.Lcd.setCursor(10, 20);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("Freq: %.2fMHz", frequencies[freqIndex]);
+        char freqLabel[LABEL_CACHE_MAX_TEXT];
+        snprintf(freqLabel, sizeof(freqLabel), "Freq: %.2fMHz", frequencies[freqIndex]);
+        labelCache.draw(10, 20, freqLabel, WHITE, BLACK);
         
-        M5.Lcd.setCursor(10, 110);
-        M5.Lcd.setTextColor(YELLOW, BLACK);
-        M5.Lcd.println("B: Back  PWR: Freq");
+        labelCache.draw(10, 110, "B: Back  PWR: Freq", YELLOW, BLACK);
         
         lastDrawnState = currentState;
-        lastFreqIndex = freqIndex;
+        lastFreqChanges = freqChanges;
         screenValid = true;
     }
 }
@@ -350,7 +392,7 @@ void MenuSystem::drawScanScreen() {
 void MenuSystem::drawSpectrumScreen() {
     // Only draw static elements - spectrum bars are drawn by updateSpectrum()
     static MenuState lastDrawnState = MENU_ABOUT;
-    static int lastFreqIndex = -1;
+    static int lastFreqChanges = -1;
     static bool screenValid = false;
     
     // Only execute if we're actually in this mode
@@ -360,17 +402,15 @@ void MenuSystem::drawSpectrumScreen() {
     }
     
     // Redraw if we just entered this screen or frequency changed
-    if (!screenValid || currentState != lastDrawnState || freqIndex != lastFreqIndex) {
+    if (!screenValid || currentState != lastDrawnState || freqChanges != lastFreqChanges) {
         M5.Lcd.fillScreen(BLACK);
         M5.Lcd.setTextSize(1);
-        M5.Lcd.setCursor(10, 5);
-        M5.Lcd.setTextColor(ORANGE, BLACK);
-        M5.Lcd.println("SPECTRUM");
+        labelCache.draw(10, 5, "SPECTRUM", ORANGE, BLACK);
         
         M5.Lcd.setTextSize(1);
-        M5.Lcd.setCursor(10, 35);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("Center: %.2fMHz", frequencies[freqIndex]);
+        char freqLabel[LABEL_CACHE_MAX_TEXT];
+        snprintf(freqLabel, sizeof(freqLabel), "Center: %.2fMHz", frequencies[freqIndex]);
+        labelCache.draw(10, 35, freqLabel, WHITE, BLACK);
         
         float startFreq = frequencies[freqIndex] - 5.0;
         float endFreq = frequencies[freqIndex] + 5.0;
@@ -378,12 +418,10 @@ void MenuSystem::drawSpectrumScreen() {
         M5.Lcd.setTextColor(DARKGREY, BLACK);
         M5.Lcd.printf("%.2f - %.2fMHz", startFreq, endFreq);
         
-        M5.Lcd.setCursor(10, 120);
-        M5.Lcd.setTextColor(YELLOW, BLACK);
-        M5.Lcd.println("B: Back  PWR: Freq");
+        labelCache.draw(10, 120, "B: Back  PWR: Freq", YELLOW, BLACK);
         
         lastDrawnState = currentState;
-        lastFreqIndex = freqIndex;
+        lastFreqChanges = freqChanges;
         screenValid = true;
     }
 }
@@ -391,7 +429,7 @@ void MenuSystem::drawSpectrumScreen() {
 void MenuSystem::drawListenScreen() {
     // Only draw static elements - RSSI/signals updated by updateListen()
     static MenuState lastDrawnState = MENU_ABOUT;
-    static int lastFreqIndex = -1;
+    static int lastFreqChanges = -1;
     static bool screenValid = false;
     
     // Only execute if we're actually in this mode
@@ -404,13 +442,11 @@ void MenuSystem::drawListenScreen() {
     if (!screenValid || currentState != lastDrawnState) {
         M5.Lcd.fillScreen(BLACK);
         M5.Lcd.setTextSize(1);
-        M5.Lcd.setCursor(10, 5);
-        M5.Lcd.setTextColor(ORANGE, BLACK);
-        M5.Lcd.println("LISTENING");
+        labelCache.draw(10, 5, "LISTENING", ORANGE, BLACK);
         
-        M5.Lcd.setCursor(10, 20);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("Freq: %.2fMHz", frequencies[freqIndex]);
+        char freqLabel[LABEL_CACHE_MAX_TEXT];
+        snprintf(freqLabel, sizeof(freqLabel), "Freq: %.2fMHz", frequencies[freqIndex]);
+        labelCache.draw(10, 20, freqLabel, WHITE, BLACK);
         
         // Draw placeholder signal bars (will be updated by updateListen)
         int barX = 10;
@@ -421,28 +457,26 @@ void MenuSystem::drawListenScreen() {
             M5.Lcd.fillRect(barX + (i * (barWidth + barSpacing)), barY, barWidth, 15, DARKGREY);
         }
         
-        M5.Lcd.setCursor(10, 110);
-        M5.Lcd.setTextColor(YELLOW, BLACK);
-        M5.Lcd.println("B: Back  PWR: Freq");
+        labelCache.draw(10, 110, "B: Back  PWR: Freq", YELLOW, BLACK);
         
         lastDrawnState = currentState;
-        lastFreqIndex = freqIndex;
+        lastFreqChanges = freqChanges;
         screenValid = true;
     } 
     // Update frequency display without clearing screen
-    else if (freqIndex != lastFreqIndex) {
+    else if (freqChanges != lastFreqChanges) {
         M5.Lcd.fillRect(10, 20, 220, 10, BLACK);
         M5.Lcd.setCursor(10, 20);
         M5.Lcd.setTextSize(1);
         M5.Lcd.setTextColor(WHITE, BLACK);
         M5.Lcd.printf("Freq: %.2fMHz", frequencies[freqIndex]);
-        lastFreqIndex = freqIndex;
+        lastFreqChanges = freqChanges;
     }
 }
 
 void MenuSystem::drawRecordScreen() {
     static MenuState lastDrawnState = MENU_ABOUT;
-    static int lastFreqIndex = -1;
+    static int lastFreqChanges = -1;
     static bool screenValid = false;
     
     // Only execute if we're actually in this mode
@@ -452,33 +486,28 @@ void MenuSystem::drawRecordScreen() {
     }
     
     // Full redraw only when entering this screen or frequency changed
-    if (!screenValid || currentState != lastDrawnState || freqIndex != lastFreqIndex) {
+    if (!screenValid || currentState != lastDrawnState || freqChanges != lastFreqChanges) {
         M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("RECORDING");
+    labelCache.draw(10, 5, "RECORDING", ORANGE, BLACK);
     
-    M5.Lcd.setCursor(10, 20);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.printf("Freq: %.2fMHz", frequencies[freqIndex]);
+    char freqLabel[LABEL_CACHE_MAX_TEXT];
+    snprintf(freqLabel, sizeof(freqLabel), "Freq: %.2fMHz", frequencies[freqIndex]);
+    labelCache.draw(10, 20, freqLabel, WHITE, BLACK);
     
-    M5.Lcd.setCursor(10, 35);
-    M5.Lcd.println("Waiting for signal...");
+    labelCache.draw(10, 35, "Waiting for signal...", WHITE, BLACK);
     
-        M5.Lcd.setCursor(10, 110);
-        M5.Lcd.setTextColor(YELLOW, BLACK);
-        M5.Lcd.println("B: Cancel");
+        labelCache.draw(10, 110, "B: Cancel", YELLOW, BLACK);
         
         lastDrawnState = currentState;
-        lastFreqIndex = freqIndex;
+        lastFreqChanges = freqChanges;
         screenValid = true;
     }
 }
 
 void MenuSystem::drawReplayScreen() {
     static MenuState lastDrawnState = MENU_ABOUT;
-    static int lastFreqIndex = -1;
+    static int lastFreqChanges = -1;
     static bool screenValid = false;
     
     // Only execute if we're actually in this mode
@@ -488,23 +517,19 @@ void MenuSystem::drawReplayScreen() {
     }
     
     // Full redraw only when entering this screen or frequency changed
-    if (!screenValid || currentState != lastDrawnState || freqIndex != lastFreqIndex) {
+    if (!screenValid || currentState != lastDrawnState || freqChanges != lastFreqChanges) {
         M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("REPLAY");
+    labelCache.draw(10, 5, "REPLAY", ORANGE, BLACK);
     
-    M5.Lcd.setCursor(10, 20);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.printf("Freq: %.2fMHz", frequencies[freqIndex]);
+    char freqLabel[LABEL_CACHE_MAX_TEXT];
+    snprintf(freqLabel, sizeof(freqLabel), "Freq: %.2fMHz", frequencies[freqIndex]);
+    labelCache.draw(10, 20, freqLabel, WHITE, BLACK);
     
-        M5.Lcd.setCursor(10, 110);
-        M5.Lcd.setTextColor(YELLOW, BLACK);
-        M5.Lcd.println("A: TX  B: Back");
+        labelCache.draw(10, 110, "A: TX  B: Back", YELLOW, BLACK);
         
         lastDrawnState = currentState;
-        lastFreqIndex = freqIndex;
+        lastFreqChanges = freqChanges;
         screenValid = true;
     }
 }
@@ -512,134 +537,107 @@ void MenuSystem::drawReplayScreen() {
 void MenuSystem::drawHacksScreen() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("HACKS - Use responsibly!");
+    labelCache.draw(10, 5, "HACKS - Use responsibly!", RED, BLACK);
     
-    M5.Lcd.setCursor(10, 20);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Select hack:");
+    labelCache.draw(10, 20, "Select hack:", WHITE, BLACK);
     
     // Hack menu items
     int y = 35;
     const char* hackItems[] = {"Tesla Charge Port", "Garage Door BF", "Hampton Bay Fan", "TV-B-Gone"};
     
+    char label[LABEL_CACHE_MAX_TEXT];
     for (int i = 0; i < 4; i++) {
-        M5.Lcd.setCursor(10, y);
+        snprintf(label, sizeof(label), "%c%s", (i == hacksSelection) ? '>' : ' ', hackItems[i]);
         if (i == hacksSelection) {
-            M5.Lcd.setTextColor(BLACK, GREEN);
-            M5.Lcd.print(">");
+            labelCache.draw(10, y, label, BLACK, GREEN);
         } else {
-            M5.Lcd.setTextColor(WHITE, BLACK);
-            M5.Lcd.print(" ");
+            labelCache.draw(10, y, label, WHITE, BLACK);
         }
-        M5.Lcd.print(hackItems[i]);
         y += 12;
     }
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("A: Run  B: Back");
+    labelCache.draw(10, 120, "A: Run  B: Back", YELLOW, BLACK);
 }
 
 void MenuSystem::drawGamesScreen() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(CYAN, BLACK);
-    M5.Lcd.println("GAMES - Classic Retro");
+    labelCache.draw(10, 5, "GAMES - Classic Retro", CYAN, BLACK);
     
-    M5.Lcd.setCursor(10, 20);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Select game:");
+    labelCache.draw(10, 20, "Select game:", WHITE, BLACK);
     
     // Game menu items
     int y = 35;
     const char* gameItems[] = {"Dino Jump", "Arkanoid", "Space Invaders"};
     
+    char label[LABEL_CACHE_MAX_TEXT];
     for (int i = 0; i < 3; i++) {
-        M5.Lcd.setCursor(10, y);
+        snprintf(label, sizeof(label), "%c%s", (i == gamesSelection) ? '>' : ' ', gameItems[i]);
         if (i == gamesSelection) {
-            M5.Lcd.setTextColor(BLACK, GREEN);
-            M5.Lcd.print(">");
+            labelCache.draw(10, y, label, BLACK, GREEN);
         } else {
-            M5.Lcd.setTextColor(WHITE, BLACK);
-            M5.Lcd.print(" ");
+            labelCache.draw(10, y, label, WHITE, BLACK);
         }
-        M5.Lcd.print(gameItems[i]);
         y += 12;
     }
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("A: Play  PWR: Nav  B: Back");
+    labelCache.draw(10, 120, "A: Play  PWR: Nav  B: Back", YELLOW, BLACK);
 }
 
 void MenuSystem::drawSettingsScreen() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("SETTINGS");
+    labelCache.draw(10, 5, "SETTINGS", ORANGE, BLACK);
     
     M5.Lcd.setTextSize(1);
     int y = 35;
     
     // Module Type option
-    M5.Lcd.setCursor(10, y);
     if (settingsSelection == 0) {
-        M5.Lcd.setTextColor(BLACK, GREEN);
-        M5.Lcd.print(">Module Type");
+        labelCache.draw(10, y, ">Module Type", BLACK, GREEN);
     } else {
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.print(" Module Type");
+        labelCache.draw(10, y, " Module Type", WHITE, BLACK);
     }
     
     // Show current module type
-    M5.Lcd.setCursor(20, y + 12);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
     if (moduleType == MODULE_2IN1) {
-        M5.Lcd.println("M5Stack 2-in-1");
+        labelCache.draw(20, y + 12, "M5Stack 2-in-1", YELLOW, BLACK);
     } else {
-        M5.Lcd.println("Standard CC1101");
+        labelCache.draw(20, y + 12, "Standard CC1101", YELLOW, BLACK);
     }
     
     y += 27;
     
     // About option
-    M5.Lcd.setCursor(10, y);
     if (settingsSelection == 1) {
-        M5.Lcd.setTextColor(BLACK, GREEN);
-        M5.Lcd.println(">About");
+        labelCache.draw(10, y, ">About", BLACK, GREEN);
     } else {
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.println(" About");
+        labelCache.draw(10, y, " About", WHITE, BLACK);
     }
     
-    M5.Lcd.setCursor(10, 105);
-    M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("*Reboot to apply");
+    y += 15;
+    
+    // SPI bus diagnostics option
+    if (settingsSelection == 2) {
+        labelCache.draw(10, y, ">SPI Bus", BLACK, GREEN);
+    } else {
+        labelCache.draw(10, y, " SPI Bus", WHITE, BLACK);
+    }
+    
+    labelCache.draw(10, 105, "*Reboot to apply", ORANGE, BLACK);
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("A: Select  B: Back");
+    labelCache.draw(10, 120, "A: Select  B: Back", YELLOW, BLACK);
 }
 
 void MenuSystem::drawWiFiAPScreen() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 5);
-    M5.Lcd.setTextColor(CYAN, BLACK);
-    M5.Lcd.println("WiFi ACCESS POINT");
+    labelCache.draw(10, 5, "WiFi ACCESS POINT", CYAN, BLACK);
     
     if (wifiAP != nullptr && wifiAP->isActive()) {
-        M5.Lcd.setCursor(10, 25);
-        M5.Lcd.setTextColor(GREEN, BLACK);
-        M5.Lcd.println("Status: ACTIVE");
+        labelCache.draw(10, 25, "Status: ACTIVE", GREEN, BLACK);
         
-        M5.Lcd.setCursor(10, 40);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.println("SSID: roku-hd");
+        labelCache.draw(10, 40, "SSID: roku-hd", WHITE, BLACK);
         
         M5.Lcd.setCursor(10, 55);
         M5.Lcd.setTextColor(WHITE, BLACK);
@@ -651,46 +649,107 @@ void MenuSystem::drawWiFiAPScreen() {
         M5.Lcd.print("Clients: ");
         M5.Lcd.println(wifiAP->getClientCount());
         
-        M5.Lcd.setCursor(10, 90);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.println("Connect to 'roku-hd'");
-        M5.Lcd.setCursor(10, 102);
-        M5.Lcd.println("Browse: 192.168.4.1");
+        labelCache.draw(10, 90, "Connect to 'roku-hd'", WHITE, BLACK);
+        labelCache.draw(10, 102, "Browse: 192.168.4.1", WHITE, BLACK);
     } else {
-        M5.Lcd.setCursor(10, 25);
-        M5.Lcd.setTextColor(RED, BLACK);
-        M5.Lcd.println("Status: INACTIVE");
+        labelCache.draw(10, 25, "Status: INACTIVE", RED, BLACK);
         
-        M5.Lcd.setCursor(10, 45);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.println("WiFi AP not started");
+        labelCache.draw(10, 45, "WiFi AP not started", WHITE, BLACK);
     }
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("B: Back");
+    labelCache.draw(10, 120, "B: Back", YELLOW, BLACK);
 }
 
 void MenuSystem::drawAboutScreen() {
+    // Static text once on entry
+    if (!aboutDrawn) {
+        M5.Lcd.fillScreen(BLACK);
+        M5.Lcd.setTextSize(1);
+        labelCache.draw(10, 5, "ABOUT", ORANGE, BLACK);
+        
+        labelCache.draw(10, 25, "Seraph's SubGHz Tool", GREEN, BLACK);
+        
+        labelCache.draw(10, 40, "Version 0.4.0", YELLOW, BLACK);
+        
+        labelCache.draw(10, 55, "Created for Dad", WHITE, BLACK);
+        
+        M5.Lcd.setCursor(10, 70);
+        M5.Lcd.setTextColor(DARKGREY, BLACK);
+        M5.Lcd.printf("Boot: %lums", bootProfiler.getBootTime());
+        
+        labelCache.draw(10, 120, "B: Back", YELLOW, BLACK);
+        aboutDrawn = true;
+    }
+    
+    // Heap lines refresh with each sample
+    M5.Lcd.fillRect(10, 82, 220, 32, BLACK);
+    M5.Lcd.setTextSize(1);
+    M5.Lcd.setTextColor(heapMonitor.isFragmented() ? RED : DARKGREY, BLACK);
+    M5.Lcd.setCursor(10, 82);
+    M5.Lcd.printf("Heap: %luK free, %luK block",
+                  (unsigned long)heapMonitor.getFreeHeap() / 1024,
+                  (unsigned long)heapMonitor.getLargestBlock() / 1024);
+    M5.Lcd.setCursor(10, 92);
+    M5.Lcd.printf("Min: %luK  Frag: %d%%",
+                  (unsigned long)heapMonitor.getMinFreeHeap() / 1024, heapMonitor.getFragmentation());
+    if (heapMonitor.getTaskCount() > 0) {
+        const TaskStackInfo& task = heapMonitor.getTask(0);
+        M5.Lcd.setTextColor(heapMonitor.isStackLow() ? RED : DARKGREY, BLACK);
+        M5.Lcd.setCursor(10, 102);
+        M5.Lcd.printf("Stack: %s %luB left", task.name, (unsigned long)task.highWater);
+    }
+    aboutHeapSample = heapMonitor.getSampleCount();
+}
+
+void MenuSystem::drawSpiBusScreen() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
     M5.Lcd.setCursor(10, 5);
     M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("ABOUT");
+    M5.Lcd.printf("SPI BUS: %s", SpiProfiler::getModeName(spiViewMode));
+    spiDrawnMs = millis();
     
-    M5.Lcd.setCursor(10, 25);
-    M5.Lcd.setTextColor(GREEN, BLACK);
-    M5.Lcd.println("Seraph's SubGHz Tool");
+    if (!spiProfiler.isEnabled()) {
+        labelCache.draw(10, 40, "Build with -DSPI_PROFILE", DARKGREY, BLACK);
+        labelCache.draw(10, 52, "and the --wrap link flags", DARKGREY, BLACK);
+        labelCache.draw(10, 120, "B: Back", YELLOW, BLACK);
+        return;
+    }
     
-    M5.Lcd.setCursor(10, 40);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("Version 0.4.0");
+    // Per-call averages for the scoped calls
+    M5.Lcd.setTextColor(DARKGREY, BLACK);
+    M5.Lcd.setCursor(10, 20);
+    M5.Lcd.printf("%-13s%6s%6s%5s%7s", "call", "n", "txn/c", "B/c", "us/c");
+    M5.Lcd.setTextColor(WHITE, BLACK);
+    for (int call = 0; call < SPI_CALL_OTHER; call++) {
+        const SpiCallStats& stats = spiProfiler.getStats(spiViewMode, call);
+        M5.Lcd.setCursor(10, 32 + call * 10);
+        if (stats.calls == 0) {
+            M5.Lcd.printf("%-13s%6d%6s%5s%7s", SpiProfiler::getCallName(call), 0, "-", "-", "-");
+            continue;
+        }
+        M5.Lcd.printf("%-13s%6lu%6.1f%5lu%7lu", SpiProfiler::getCallName(call),
+                      (unsigned long)stats.calls, (float)stats.transactions / stats.calls,
+                      (unsigned long)(stats.bytes / stats.calls),
+                      (unsigned long)spiProfiler.cyclesToUs(stats.busCycles / stats.calls));
+    }
     
-    M5.Lcd.setCursor(10, 55);
+    // Unscoped traffic as totals
+    const SpiCallStats& other = spiProfiler.getStats(spiViewMode, SPI_CALL_OTHER);
+    M5.Lcd.setTextColor(DARKGREY, BLACK);
+    M5.Lcd.setCursor(10, 76);
+    M5.Lcd.printf("other: %lu txn, %lu B, %lu us", (unsigned long)other.transactions,
+                  (unsigned long)other.bytes, (unsigned long)spiProfiler.cyclesToUs(other.busCycles));
+    
+    // Share of the time in this mode spent with CS low
+    SpiCallStats total = spiProfiler.getModeTotal(spiViewMode);
+    uint32_t busUs = spiProfiler.cyclesToUs(total.busCycles);
+    uint64_t modeUs = spiProfiler.getModeUs(spiViewMode);
+    float share = modeUs > 0 ? 100.0 * busUs / modeUs : 0.0;
     M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Created for Dad");
+    M5.Lcd.setCursor(10, 92);
+    M5.Lcd.printf("Bus %lu.%03lums, %.1f%% of %lus", (unsigned long)(busUs / 1000),
+                  (unsigned long)(busUs % 1000), share, (unsigned long)(modeUs / 1000000));
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("B: Back");
+    labelCache.draw(10, 120, "PWR: Mode  B: Back", YELLOW, BLACK);
 }
@@ -5,6 +5,10 @@
 #include <M5StickCPlus.h>
 #include "cc1101_interface.h"
 
+#define FREQ_PRESET_COUNT 4
+#define FREQ_CUSTOM_INDEX FREQ_PRESET_COUNT  // Slot for a remotely tuned frequency
+#define SPI_SCREEN_REFRESH_MS 1000
+
 // Forward declarations
 class SubGhzOperations;
 class WiFiAP;
@@ -20,7 +24,8 @@ enum MenuState {
     MENU_GAMES,
     MENU_WIFI_AP,
     MENU_SETTINGS,
-    MENU_ABOUT
+    MENU_ABOUT,
+    MENU_SPI_BUS
 };
 
 enum OperationMode {
@@ -47,6 +52,7 @@ public:
     
     int getSelectedFreqIndex();
     float getSelectedFrequency();
+    void setFrequency(float mhz);  // Preset if one matches, else custom
     ModuleType getModuleType();
     bool needsRedraw();
     void clearRedrawFlag();
@@ -65,7 +71,16 @@ private:
     
     // Frequency selection
     int freqIndex;
-    float frequencies[4];
+    float frequencies[FREQ_PRESET_COUNT + 1];
+    int freqChanges;  // Bumped on every change so screens redraw the label
+    
+    // About screen: static text drawn once, heap lines per sample
+    bool aboutDrawn;
+    uint32_t aboutHeapSample;
+    
+    // SPI bus screen: one mode's table at a time, refreshed each second
+    int spiViewMode;
+    unsigned long spiDrawnMs;
     
     // Button handling
     void handleButtons();
@@ -85,6 +100,7 @@ private:
     void drawWiFiAPScreen();
     void drawSettingsScreen();
     void drawAboutScreen();
+    void drawSpiBusScreen();
     
     // State tracking
     unsigned long lastUpdate;
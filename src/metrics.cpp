@@ -0,0 +1,285 @@
+#include "metrics.h"
+
+struct HistogramInfo {
+    const char* family;
+    const char* help;
+    const char* op;  // Label value, or nullptr for an unlabelled family
+};
+
+// Histograms of one family are consecutive so HELP/TYPE is written once
+static const HistogramInfo histogramInfo[METRIC_HISTOGRAM_COUNT] = {
+    { "subghz_loop_period_seconds", "Time between main loop passes, including idle waits", nullptr },
+    { "subghz_radio_op_seconds", "CC1101 operation latency", "setFrequency" },
+    { "subghz_radio_op_seconds", "CC1101 operation latency", "getRSSI" },
+    { "subghz_radio_op_seconds", "CC1101 operation latency", "sweep" },
+    { "subghz_lcd_frame_seconds", "Time to draw and flush one LCD frame", nullptr },
+    { "subghz_http_handler_seconds", "Time spent in web request handlers", nullptr },
+};
+
+struct CounterInfo {
+    const char* name;
+    const char* help;
+};
+
+static const CounterInfo counterInfo[METRIC_COUNTER_COUNT] = {
+    { "subghz_dropped_edges_total", "GDO0 edges lost in the few ms after the record buffer filled" },
+    { "subghz_false_triggers_total", "Signal detections that produced no packet or usable capture" },
+};
+
+// Per mode and call from the SPI profiler; the last family is per mode
+enum SpiFamily {
+    SPI_FAMILY_CALLS,
+    SPI_FAMILY_TRANSACTIONS,
+    SPI_FAMILY_BYTES,
+    SPI_FAMILY_BUS_SECONDS,
+    SPI_FAMILY_MODE_SECONDS,
+    SPI_FAMILY_COUNT
+};
+
+static const CounterInfo spiFamilyInfo[SPI_FAMILY_COUNT] = {
+    { "subghz_spi_calls_total", "CC1101Interface calls, by operation mode" },
+    { "subghz_spi_transactions_total", "CC1101 SPI transactions (chip select cycles)" },
+    { "subghz_spi_bytes_total", "Bytes exchanged with the CC1101 over SPI" },
+    { "subghz_spi_bus_seconds_total", "Time the CC1101 chip select was held low" },
+    { "subghz_mode_seconds_total", "Time spent in each operation mode" },
+};
+
+// Global metrics instance
+Metrics metrics;
+
+Metrics::Metrics() {
+    memset(histograms, 0, sizeof(histograms));
+    for (int i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        counters[i] = 0;
+    }
+    lastLoopUs = 0;
+    scraping = false;
+    scrapeId = 0;
+    scrapeLastReadMs = 0;
+    scrapeItem = 0;
+    scrapeRow = 0;
+    scrapeLineLen = 0;
+    scrapeLinePos = 0;
+}
+
+void Metrics::observe(MetricHistogram histogram, uint32_t us) {
+    // Smallest k with us <= 2^k
+    int bucket = (us <= 1) ? 0 : 32 - __builtin_clz(us - 1);
+    if (bucket > METRIC_BUCKETS) bucket = METRIC_BUCKETS;
+    LatencyHistogram& h = histograms[histogram];
+    h.buckets[bucket]++;
+    h.sumUs += us;
+}
+
+void Metrics::count(MetricCounter counter, uint32_t n) {
+    counters[counter] += n;
+}
+
+void Metrics::markLoop() {
+    uint32_t now = micros();
+    if (lastLoopUs != 0) observe(METRIC_LOOP_PERIOD, now - lastLoopUs);
+    lastLoopUs = now;
+}
+
+uint32_t Metrics::getCount(MetricHistogram histogram) {
+    uint32_t total = 0;
+    for (int i = 0; i <= METRIC_BUCKETS; i++) {
+        total += histograms[histogram].buckets[i];
+    }
+    return total;
+}
+
+uint32_t Metrics::getCounter(MetricCounter counter) {
+    return counters[counter];
+}
+
+uint32_t Metrics::beginScrape() {
+    if (scraping && millis() - scrapeLastReadMs < METRIC_SCRAPE_TIMEOUT_MS) return 0;
+    if (++scrapeId == 0) scrapeId = 1;
+    scraping = true;
+    scrapeLastReadMs = millis();
+
+    // Writers don't stop for this, so _sum can be one sample off from the
+    // buckets; _count is derived from the buckets and always matches +Inf
+    memcpy(snapshot, histograms, sizeof(snapshot));
+    for (int i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        snapshotCounters[i] = counters[i];
+    }
+    spiProfiler.copyStats(snapshotSpi, snapshotModeUs);
+    scrapeItem = 0;
+    scrapeRow = 0;
+    scrapeLineLen = 0;
+    scrapeLinePos = 0;
+    return scrapeId;
+}
+
+// Row 0 is the family header, then buckets (cumulative), _sum and _count.
+// Returns the line length, 0 for an empty row, -1 past the last row
+int Metrics::formatHistogramRow(int index, int row) {
+    const HistogramInfo& info = histogramInfo[index];
+    const LatencyHistogram& h = snapshot[index];
+    char label[40];
+    if (info.op != nullptr) {
+        snprintf(label, sizeof(label), "op=\"%s\"", info.op);
+    } else {
+        label[0] = '\0';
+    }
+    const char* sep = label[0] ? "," : "";
+
+    if (row == 0) {
+        if (index > 0 && strcmp(histogramInfo[index - 1].family, info.family) == 0) return 0;
+        return snprintf(scrapeLine, sizeof(scrapeLine), "# HELP %s %s\n# TYPE %s histogram\n",
+                        info.family, info.help, info.family);
+    }
+
+    uint32_t total = 0;
+    for (int i = 0; i <= METRIC_BUCKETS; i++) {
+        total += h.buckets[i];
+    }
+
+    int bucket = row - 1;
+    if (bucket < METRIC_BUCKETS) {
+        uint32_t cumulative = 0;
+        for (int i = 0; i <= bucket; i++) {
+            cumulative += h.buckets[i];
+        }
+        unsigned long le = 1UL << bucket;
+        return snprintf(scrapeLine, sizeof(scrapeLine), "%s_bucket{%s%sle=\"%lu.%06lu\"} %lu\n",
+                        info.family, label, sep, le / 1000000, le % 1000000, (unsigned long)cumulative);
+    }
+    if (bucket == METRIC_BUCKETS) {
+        return snprintf(scrapeLine, sizeof(scrapeLine), "%s_bucket{%s%sle=\"+Inf\"} %lu\n",
+                        info.family, label, sep, (unsigned long)total);
+    }
+
+    char series[44];
+    if (label[0]) {
+        snprintf(series, sizeof(series), "{%s}", label);
+    } else {
+        series[0] = '\0';
+    }
+    if (bucket == METRIC_BUCKETS + 1) {
+        return snprintf(scrapeLine, sizeof(scrapeLine), "%s_sum%s %llu.%06llu\n",
+                        info.family, series,
+                        (unsigned long long)(h.sumUs / 1000000), (unsigned long long)(h.sumUs % 1000000));
+    }
+    if (bucket == METRIC_BUCKETS + 2) {
+        return snprintf(scrapeLine, sizeof(scrapeLine), "%s_count%s %lu\n",
+                        info.family, series, (unsigned long)total);
+    }
+    return -1;
+}
+
+// Row 0 is the family header, then one row per mode and call (per mode
+// for mode seconds). Cells with no traffic are left out
+int Metrics::formatSpiRow(int family, int row) {
+    const CounterInfo& info = spiFamilyInfo[family];
+    if (row == 0) {
+        return snprintf(scrapeLine, sizeof(scrapeLine), "# HELP %s %s\n# TYPE %s counter\n",
+                        info.name, info.help, info.name);
+    }
+
+    int cell = row - 1;
+    if (family == SPI_FAMILY_MODE_SECONDS) {
+        if (cell >= SPI_PROFILE_MODES) return -1;
+        uint64_t us = snapshotModeUs[cell];
+        return snprintf(scrapeLine, sizeof(scrapeLine), "%s{mode=\"%s\"} %llu.%06llu\n",
+                        info.name, SpiProfiler::getModeName(cell),
+                        (unsigned long long)(us / 1000000), (unsigned long long)(us % 1000000));
+    }
+
+    if (cell >= SPI_PROFILE_MODES * SPI_CALL_COUNT) return -1;
+    int mode = cell / SPI_CALL_COUNT;
+    int call = cell % SPI_CALL_COUNT;
+    const SpiCallStats& stats = snapshotSpi[mode][call];
+    if (stats.calls == 0 && stats.transactions == 0) return 0;
+
+    char series[64];
+    snprintf(series, sizeof(series), "{mode=\"%s\",call=\"%s\"}",
+             SpiProfiler::getModeName(mode), SpiProfiler::getCallName(call));
+    switch (family) {
+        case SPI_FAMILY_CALLS:
+            // Unscoped traffic has no calls to count
+            if (call == SPI_CALL_OTHER) return 0;
+            return snprintf(scrapeLine, sizeof(scrapeLine), "%s%s %lu\n",
+                            info.name, series, (unsigned long)stats.calls);
+        case SPI_FAMILY_TRANSACTIONS:
+            return snprintf(scrapeLine, sizeof(scrapeLine), "%s%s %lu\n",
+                            info.name, series, (unsigned long)stats.transactions);
+        case SPI_FAMILY_BYTES:
+            return snprintf(scrapeLine, sizeof(scrapeLine), "%s%s %lu\n",
+                            info.name, series, (unsigned long)stats.bytes);
+        default: {
+            uint64_t us = stats.busCycles / ESP.getCpuFreqMHz();
+            return snprintf(scrapeLine, sizeof(scrapeLine), "%s%s %llu.%06llu\n",
+                            info.name, series,
+                            (unsigned long long)(us / 1000000), (unsigned long long)(us % 1000000));
+        }
+    }
+}
+
+// Formats the next non-empty row into scrapeLine
+bool Metrics::nextScrapeLine() {
+    scrapeLinePos = 0;
+    scrapeLineLen = 0;
+
+    while (true) {
+        int n;
+        if (scrapeItem < METRIC_HISTOGRAM_COUNT) {
+            n = formatHistogramRow(scrapeItem, scrapeRow++);
+            if (n < 0) {
+                scrapeItem++;
+                scrapeRow = 0;
+                continue;
+            }
+        } else if (scrapeItem < METRIC_HISTOGRAM_COUNT + METRIC_COUNTER_COUNT) {
+            int counter = scrapeItem - METRIC_HISTOGRAM_COUNT;
+            const CounterInfo& info = counterInfo[counter];
+            n = snprintf(scrapeLine, sizeof(scrapeLine), "# HELP %s %s\n# TYPE %s counter\n%s %lu\n",
+                         info.name, info.help, info.name, info.name,
+                         (unsigned long)snapshotCounters[counter]);
+            scrapeItem++;
+        } else if (spiProfiler.isEnabled() &&
+                   scrapeItem < METRIC_HISTOGRAM_COUNT + METRIC_COUNTER_COUNT + SPI_FAMILY_COUNT) {
+            n = formatSpiRow(scrapeItem - METRIC_HISTOGRAM_COUNT - METRIC_COUNTER_COUNT, scrapeRow++);
+            if (n < 0) {
+                scrapeItem++;
+                scrapeRow = 0;
+                continue;
+            }
+        } else {
+            return false;
+        }
+
+        if (n > 0) {
+            scrapeLineLen = min((size_t)n, sizeof(scrapeLine) - 1);
+            return true;
+        }
+    }
+}
+
+size_t Metrics::readScrape(uint32_t id, uint8_t* buffer, size_t maxLen) {
+    if (!scraping || id != scrapeId) return 0;
+    scrapeLastReadMs = millis();
+
+    size_t written = 0;
+    while (written < maxLen) {
+        if (scrapeLinePos == scrapeLineLen && !nextScrapeLine()) {
+            scraping = false;
+            break;
+        }
+        size_t n = min(maxLen - written, scrapeLineLen - scrapeLinePos);
+        memcpy(buffer + written, scrapeLine + scrapeLinePos, n);
+        scrapeLinePos += n;
+        written += n;
+    }
+    return written;
+}
+
+bool Metrics::ownsScrape(uint32_t id) {
+    return id == scrapeId;
+}
+
+void Metrics::endScrape(uint32_t id) {
+    if (id == scrapeId) scraping = false;
+}
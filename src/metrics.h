@@ -0,0 +1,106 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "spi_profiler.h"
+
+// Latency histograms and event counters for long unattended runs, served
+// at GET /metrics in Prometheus text format. Histogram buckets are powers
+// of two in microseconds (le = 1us, 2us, 4us ... ~4.2s, then +Inf), so an
+// observation is one count-leading-zeros and two adds. Everything lives in
+// fixed arrays; a scrape snapshots them and formats one line at a time.
+// SPI profiler counts (spi_profiler.h) follow when built with SPI_PROFILE.
+
+#define METRIC_BUCKETS 23              // Finite buckets: 2^0 .. 2^22 us
+#define METRIC_SCRAPE_TIMEOUT_MS 5000  // Abandoned scrape frees the exporter
+
+enum MetricHistogram {
+    METRIC_LOOP_PERIOD,
+    METRIC_RADIO_SET_FREQUENCY,
+    METRIC_RADIO_GET_RSSI,
+    METRIC_RADIO_SWEEP,
+    METRIC_LCD_FRAME,
+    METRIC_HTTP_HANDLER,
+    METRIC_HISTOGRAM_COUNT
+};
+
+enum MetricCounter {
+    METRIC_DROPPED_EDGES,     // Edges past the end of the record buffer
+    METRIC_FALSE_TRIGGERS,    // Detections that yielded no packet or capture
+    METRIC_COUNTER_COUNT
+};
+
+// Each histogram is written by one task only (HTTP from the async task,
+// the rest from the main loop), so observations need no locking
+struct LatencyHistogram {
+    uint32_t buckets[METRIC_BUCKETS + 1];  // Last one is +Inf
+    uint64_t sumUs;
+};
+
+class Metrics {
+public:
+    Metrics();
+
+    void observe(MetricHistogram histogram, uint32_t us);
+    void count(MetricCounter counter, uint32_t n = 1);
+    void markLoop();  // Call once per main loop pass
+
+    uint32_t getCount(MetricHistogram histogram);
+    uint32_t getCounter(MetricCounter counter);
+
+    // Prometheus text, produced in pieces. beginScrape() returns the
+    // scrape's id (0 if another scrape is in progress); readScrape()
+    // returns 0 once the text is complete, or if a later scrape took the
+    // exporter over after this one stalled. endScrape() frees it early
+    uint32_t beginScrape();
+    size_t readScrape(uint32_t id, uint8_t* buffer, size_t maxLen);
+    bool ownsScrape(uint32_t id);
+    void endScrape(uint32_t id);
+
+private:
+    LatencyHistogram histograms[METRIC_HISTOGRAM_COUNT];
+    volatile uint32_t counters[METRIC_COUNTER_COUNT];
+    uint32_t lastLoopUs;
+
+    // Scrape cursor over a snapshot of the arrays above
+    LatencyHistogram snapshot[METRIC_HISTOGRAM_COUNT];
+    uint32_t snapshotCounters[METRIC_COUNTER_COUNT];
+    SpiCallStats snapshotSpi[SPI_PROFILE_MODES][SPI_CALL_COUNT];
+    uint64_t snapshotModeUs[SPI_PROFILE_MODES];
+    volatile bool scraping;
+    uint32_t scrapeId;  // Owner of the cursor
+    unsigned long scrapeLastReadMs;
+    int scrapeItem;   // Histograms, then counters, then SPI families
+    int scrapeRow;    // Within a histogram: header, buckets, sum, count
+    char scrapeLine[256];
+    size_t scrapeLineLen;
+    size_t scrapeLinePos;
+
+    bool nextScrapeLine();
+    int formatHistogramRow(int index, int row);
+    int formatSpiRow(int family, int row);
+};
+
+extern Metrics metrics;
+
+// Observes the enclosing scope's duration
+class MetricTimer {
+public:
+    MetricTimer(MetricHistogram histogram) {
+        this->histogram = histogram;
+        startUs = micros();
+    }
+    ~MetricTimer() {
+        metrics.observe(histogram, micros() - startUs);
+    }
+
+private:
+    MetricHistogram histogram;
+    uint32_t startUs;
+};
+
+#define METRIC_CONCAT2(a, b) a##b
+#define METRIC_CONCAT(a, b) METRIC_CONCAT2(a, b)
+#define METRIC_TIME(histogram) MetricTimer METRIC_CONCAT(metricTimer, __LINE__)(histogram)
+
+#endif
@@ -0,0 +1,1988 @@
+// Generated by tools/splash_rle.py from assets/orca_m5.c - do not edit
+// 240x135 RGB565, RLE compressed (47478 bytes)
+
+#include "orca_m5.h"
+
+const uint16_t image_data_orca_m5_rle[23739] = {
+    0x8043, 0x0000, 0x0016, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000B,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x8008,
+    0xFFFF, 0x000F, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8012, 0xFFFF, 0x0011, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x801C, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x003B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0018, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x8006, 0xFFFF, 0x001A, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x800D,
+    0xFFFF, 0x0041, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8012, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8010, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0011, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF,
+    0x0004, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x8004, 0xFFFF, 0x000B, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x8005, 0xFFFF, 0x0005, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x0000, 0x8009, 0xFFFF, 0x0017, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8015, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x002D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x8006, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003,
+    0xFFFF, 0x0006, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0029, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0017, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0025, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x8006, 0xFFFF, 0x0005,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x8004, 0x0000, 0x001A, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF,
+    0x0001, 0x0000, 0x8004, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8019, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x800D, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x001D, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x8009, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x8004, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8009, 0xFFFF, 0x0033, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x8003, 0xFFFF, 0x001B, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x8003, 0xFFFF, 0x000D, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0009, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8009, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x000C, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8013, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0013, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x001E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8008, 0xFFFF, 0x8004, 0x0000, 0x0008,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0008, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8013, 0xFFFF, 0x0003, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0039, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0011, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0010, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x8005, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x8004,
+    0xFFFF, 0x000B, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x800C, 0xFFFF, 0x0001, 0x0000, 0x8006,
+    0xFFFF, 0x000A, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8012, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000C,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x8003, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8004,
+    0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x000D, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x800C, 0xFFFF, 0x0004, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x8008, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x0005, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0021, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x800A, 0xFFFF, 0x000A,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF,
+    0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8006, 0xFFFF, 0x0001, 0x0000, 0x8006, 0xFFFF, 0x0001,
+    0x0000, 0x8010, 0xFFFF, 0x0009, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0014, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0003, 0x0000,
+    0xFFFF, 0x0000, 0x8007, 0xFFFF, 0x0005, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF,
+    0x000E, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x800A,
+    0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0016, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0017, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0018, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x8007, 0xFFFF, 0x0014, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8014, 0xFFFF, 0x0001, 0x0000, 0x8009, 0xFFFF, 0x001C,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0014, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x800D, 0xFFFF, 0x000D, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x8004, 0xFFFF, 0x0001, 0x0000, 0x8007, 0xFFFF, 0x0001, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000,
+    0x8004, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x800B, 0xFFFF, 0x000D, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8003, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0005, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x800D, 0xFFFF, 0x0001, 0x0000, 0x8007, 0xFFFF, 0x0001, 0x0000, 0x8007,
+    0xFFFF, 0x0001, 0x0000, 0x8011, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0016,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0010, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0009, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0038, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8009, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x000B, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x8006, 0xFFFF, 0x0001, 0x0000, 0x8009, 0xFFFF, 0x0001, 0x0000, 0x8006,
+    0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x0001, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x8006,
+    0xFFFF, 0x0008, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x001C,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x001A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001B,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x8005, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8025, 0xFFFF, 0x0001, 0x0000,
+    0x8005, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x000B, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0011, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x000B, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x8004, 0xFFFF, 0x0009, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0008, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003,
+    0xFFFF, 0x0001, 0x0000, 0x8006, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8003, 0xFFFF, 0x0001, 0x0000, 0x8012, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003,
+    0xFFFF, 0x0001, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x8006, 0xFFFF, 0x000A, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x001A, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8005, 0xFFFF,
+    0x0001, 0x0000, 0x8003, 0xFFFF, 0x000C, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000E, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF,
+    0x0001, 0x0000, 0x800F, 0xFFFF, 0x0001, 0x0000, 0x8008, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF,
+    0x0001, 0x0000, 0x800B, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0010,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0012, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0013, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0030, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF,
+    0x0001, 0x0000, 0x8003, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0002,
+    0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8007, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF,
+    0x0009, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8009, 0xFFFF,
+    0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8008, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x8009, 0xFFFF, 0x0005, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0016, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0013, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0009, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0002, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0010,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0005, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8003, 0xFFFF, 0x0014, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x8004,
+    0xFFFF, 0x0001, 0x0000, 0x800D, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8008,
+    0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x800A, 0xFFFF, 0x0015, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0031, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x000C, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x001E, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0012, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8005, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x8023, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF,
+    0x0001, 0x0000, 0x8007, 0xFFFF, 0x0013, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x002F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0013, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8007, 0xFFFF, 0x000C, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0008, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x8003, 0xFFFF, 0x0008, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x800B, 0xFFFF, 0x0001, 0x0000, 0x8009, 0xFFFF, 0x0001,
+    0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x800A, 0xFFFF, 0x0009,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0001,
+    0x0000, 0x8003, 0xFFFF, 0x0059, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0012,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0015, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF,
+    0x0006, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0008, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8006, 0xFFFF, 0x0005, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8005, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x800B, 0xFFFF, 0x0001, 0x0000, 0x800D, 0xFFFF,
+    0x0007, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8008, 0xFFFF, 0x000E, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0026, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0016, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0003, 0x0000,
+    0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0009, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8009, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x800C, 0xFFFF, 0x0001, 0x0000, 0x800B,
+    0xFFFF, 0x0001, 0x0000, 0x800D, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF,
+    0x001A, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x002F, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0007, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8008, 0xFFFF, 0x0001, 0x0000, 0x8006, 0xFFFF,
+    0x0005, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x8003, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0005, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8006, 0xFFFF, 0x0001,
+    0x0000, 0x8003, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8006,
+    0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8008, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x8007, 0xFFFF, 0x0007, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0054, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0015, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x000F, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0010, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x800C,
+    0xFFFF, 0x0001, 0x0000, 0x8007, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8008, 0xFFFF, 0x000A, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0015, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0020, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0026, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0001,
+    0x0000, 0x8005, 0xFFFF, 0x0009, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x800A, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8006, 0xFFFF, 0x001A, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x001B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0054,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8005, 0xFFFF, 0x0012, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0003,
+    0x0000, 0xFFFF, 0x0000, 0x800A, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x8004, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x000E, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0031, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x001B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0x8003, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0013, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0012, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0008, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0001, 0x0000, 0x8005, 0xFFFF, 0x0007, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF,
+    0x0001, 0x0000, 0x8005, 0xFFFF, 0x000C, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0012, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x002B, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x001A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001A, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x8003, 0xFFFF, 0x0014, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0006, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8005, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF,
+    0x0001, 0x0000, 0x8003, 0xFFFF, 0x0019, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0016, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0013, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x8004, 0xFFFF, 0x0010, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0014, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF,
+    0x0001, 0x0000, 0x8006, 0xFFFF, 0x0010, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0016, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0010, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0016, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0027, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x000A, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0x0000, 0x8003,
+    0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x0003, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0013,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0026, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001E, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x001C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8010, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x000D, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004,
+    0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0004, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0013, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x002F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0018, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x000D, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x8003, 0x0000,
+    0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0006, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x000F, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001C,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001E, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x001F,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x001A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0001, 0x0000, 0x8003, 0xFFFF, 0x0019,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0014, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0029, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0023, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x8003, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0013, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003,
+    0xFFFF, 0x0004, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0020, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000A,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0017, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x0008, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x8005, 0xFFFF, 0x0003, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0023, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x001F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0017, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0024, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0035, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0032, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0023, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x002C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0011, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0002, 0xFFFF, 0xFFFF, 0x8003,
+    0x0000, 0x001A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0023, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000C,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x001E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000E,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x003B, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0010, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0025, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x001C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001E, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0022, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x001A,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0016, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0011, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001D, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0033,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0013, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001B,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x001E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x001D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0029, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0017, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x003C,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0019, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0030, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0015, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x000E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0011, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0012, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0017, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0008,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0015, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x000C, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0012, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0026, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0011, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0029, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0015, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8009,
+    0x0000, 0x0013, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0024, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x800B, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0014, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000E,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8006, 0x0000, 0x0019, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x8003, 0xFFFF, 0x0015, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0002, 0xFFFF,
+    0x0000, 0x8005, 0xFFFF, 0x0003, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0023, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000D,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x001F, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x800D, 0x0000, 0x0015, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x001B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0002, 0xFFFF, 0xFFFF, 0x8003, 0x0000, 0x0018, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0007, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0003, 0x0000, 0xFFFF, 0xFFFF, 0x8004, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0002, 0xFFFF,
+    0x0000, 0x8003, 0xFFFF, 0x0005, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0011,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0017, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000C, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x001A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0017, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0026,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0018,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x800C, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8007, 0xFFFF,
+    0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x001E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x8013, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x8003, 0xFFFF, 0x0014, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0002, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0017, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8008, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x001A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x000E, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8016, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000,
+    0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0010, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001,
+    0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0011, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x801F, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0009,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8012, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x801E, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0017, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x800B, 0x0000, 0x0012, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF,
+    0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8011, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800E,
+    0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8010, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x801C, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x800A, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0008,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8010, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8024,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x000E, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8014, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x8003, 0xFFFF, 0x0003,
+    0x0000, 0xFFFF, 0xFFFF, 0x8010, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x800F,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800A, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0008, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000B, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x8004, 0xFFFF, 0x0001, 0x0000,
+    0x8003, 0xFFFF, 0x0001, 0x0000, 0x8004, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000,
+    0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000D, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0009, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x000C, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF,
+    0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8010, 0x0000, 0x0001, 0xFFFF,
+    0x800B, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x800E,
+    0x0000, 0x0017, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8022, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8009, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000C, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8022, 0x0000, 0x001A, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8012, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0012, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8010,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0019, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8019, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0016, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x801E, 0x0000, 0x001B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800D, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x800B, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0018, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8014, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x000C,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001,
+    0xFFFF, 0x800A, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8015, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0012, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8010, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x800C, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0010,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8025, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000,
+    0x0001, 0xFFFF, 0x800D, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800D,
+    0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x801D,
+    0x0000, 0x0001, 0xFFFF, 0x8013, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0013, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x800D, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x800C, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF,
+    0x800D, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x800B, 0x0000, 0x000D, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8015, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x800A, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8009,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8010, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0013, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x800A, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x000B, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x000F,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x000D,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000B, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8009, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8012,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0013, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8010, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8009, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8015, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0008, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0013, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x000F, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8016, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0018, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8009,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0008, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x800F, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000,
+    0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800C,
+    0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0008, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x800C, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0005,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x800C, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0009,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0009, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000,
+    0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8009, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF,
+    0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8008, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0005, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8007, 0x0000, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x800B, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800B,
+    0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0009,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0006,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x800C, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0007, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8007, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8011, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0008, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8009, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x801C, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0006, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0010, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8011, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000B, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8015, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x801D, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800F, 0x0000,
+    0x0001, 0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0011, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0016, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0003,
+    0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x0006, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0008,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8018,
+    0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800A, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0016, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF,
+    0x8007, 0x0000, 0x000B, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8008, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001,
+    0xFFFF, 0x800E, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x800D, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x800E, 0x0000, 0x0005, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8019, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800E, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x000C, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0009, 0xFFFF, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x000B,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8008,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0010, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x000A,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8010, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800D, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8012,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x000D, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0008, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800D,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x000D, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B,
+    0x0000, 0x0011, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8013, 0x0000, 0x0001, 0xFFFF, 0x800B,
+    0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800A,
+    0x0000, 0x000A, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8016, 0x0000, 0x0006, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8012, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8014, 0x0000, 0x0010, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x800D, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0012, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0008,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x000E, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8016, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0013, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x000A,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x801B, 0x0000,
+    0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8013, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x801C, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001,
+    0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x800E, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8010,
+    0x0000, 0x0016, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8010, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8013,
+    0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8016, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x001A, 0xFFFF,
+    0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x000A, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8019, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x000A, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8011, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8011,
+    0x0000, 0x0001, 0xFFFF, 0x8028, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0013,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8018, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0013, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800A, 0x0000,
+    0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8015, 0x0000, 0x0016, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8014, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8013, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0010, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x801B, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8016, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0010, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8006, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x800A, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800D,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8013, 0x0000, 0x0013, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0007, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8023, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8014, 0x0000,
+    0x0001, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0006, 0xFFFF, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8015, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x000D, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8012, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8009, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8007, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8016, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x800C, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800B,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8017, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8011, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800B, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF,
+    0x8018, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8016, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800D,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x000A, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8009, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000,
+    0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8015, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x800D, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8012, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800D,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000,
+    0x0001, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0009, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x800F, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8012, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001,
+    0xFFFF, 0x8008, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8015, 0x0000, 0x0001,
+    0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x800C, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x800D, 0x0000, 0x0001, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF,
+    0x8008, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x800C, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8007, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8008,
+    0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x800E, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8013, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8007, 0x0000, 0x0001, 0xFFFF, 0x8019, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8005, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0003, 0xFFFF, 0x0000, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x800B, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800A, 0x0000,
+    0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x800F, 0x0000, 0x0007, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8003, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF,
+    0x8004, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8010, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x800C, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x800A, 0x0000, 0x0001, 0xFFFF, 0x800C, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000,
+    0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF,
+    0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF,
+    0x800A, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8012, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x800B,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x800F, 0x0000, 0x0001, 0xFFFF, 0x800A,
+    0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x800F, 0x0000, 0x0004, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000,
+    0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001,
+    0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001,
+    0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0001,
+    0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001,
+    0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004,
+    0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000, 0x0004, 0xFFFF,
+    0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8005,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8003,
+    0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000,
+    0x0001, 0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0001, 0xFFFF, 0x8004, 0x0000,
+    0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001, 0xFFFF, 0x8011, 0x0000, 0x0001, 0xFFFF, 0x8006, 0x0000,
+    0x0001, 0xFFFF, 0x8003, 0x0000, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x0001, 0xFFFF, 0x8007, 0x0000,
+    0x0001, 0xFFFF, 0x8005, 0x0000, 0x0004, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x8003, 0x0000, 0x0001,
+    0xFFFF, 0x800B, 0x0000, 0x0001, 0xFFFF, 0x8005, 0x0000, 0x0001, 0xFFFF, 0x8008, 0x0000, 0x0001,
+    0xFFFF, 0x8008, 0x0000,
+};
+
+const uint32_t image_data_orca_m5_rle_len = 23739;
@@ -0,0 +1,180 @@
+#include "recording_format.h"
+#include <string.h>
+
+static size_t sampleBytes(RecordingFormat format) {
+    return (format == RECORDING_FORMAT_TEXT) ? RECORDING_TEXT_SAMPLE_BYTES : RECORDING_RAW_SAMPLE_BYTES;
+}
+
+static void encodeSample(RecordingFormat format, const int* timings, int index, uint8_t* out) {
+    int us = timings[index];
+    if (us < 0) us = 0;
+
+    if (format == RECORDING_FORMAT_RAW) {
+        uint32_t v = us;
+        out[0] = v & 0xFF;
+        out[1] = (v >> 8) & 0xFF;
+        out[2] = (v >> 16) & 0xFF;
+        out[3] = v >> 24;
+        return;
+    }
+
+    if (us > RECORDING_TEXT_MAX_US) us = RECORDING_TEXT_MAX_US;
+    out[0] = (index % 2 == 0) ? '-' : '+';
+    for (int i = 6; i >= 1; i--) {
+        out[i] = '0' + us % 10;
+        us /= 10;
+    }
+    out[7] = '\n';
+}
+
+size_t recordingEncodedSize(RecordingFormat format, int samples) {
+    if (samples <= 0) return 0;
+    return (size_t)samples * sampleBytes(format);
+}
+
+size_t encodeRecordingRange(RecordingFormat format, const int* timings, int samples,
+                            size_t offset, uint8_t* out, size_t maxLen) {
+    size_t total = recordingEncodedSize(format, samples);
+    if (offset >= total) return 0;
+    if (maxLen > total - offset) maxLen = total - offset;
+
+    size_t width = sampleBytes(format);
+    uint8_t sample[RECORDING_TEXT_SAMPLE_BYTES];
+    size_t written = 0;
+
+    while (written < maxLen) {
+        size_t pos = offset + written;
+        int index = pos / width;
+        size_t skip = pos % width;
+        size_t n = width - skip;
+        if (n > maxLen - written) n = maxLen - written;
+
+        encodeSample(format, timings, index, sample);
+        memcpy(out + written, sample + skip, n);
+        written += n;
+    }
+    return written;
+}
+
+RecordingParser::RecordingParser() {
+    begin(RECORDING_FORMAT_TEXT, nullptr, 0);
+}
+
+void RecordingParser::begin(RecordingFormat format, int* out, int capacity) {
+    this->format = format;
+    this->out = out;
+    this->capacity = capacity;
+    count = 0;
+    bytes = 0;
+    error = RECORDING_PARSE_OK;
+    errorOffset = 0;
+    value = 0;
+    digits = 0;
+    inComment = false;
+    signSeen = false;
+}
+
+bool RecordingParser::fail(RecordingParseError reason) {
+    error = reason;
+    errorOffset = bytes;
+    return false;
+}
+
+bool RecordingParser::push(uint32_t us) {
+    if (us == 0 || us > RECORDING_MAX_US) return fail(RECORDING_PARSE_RANGE);
+    if (count >= capacity) return fail(RECORDING_PARSE_TOO_MANY);
+    out[count++] = us;
+    return true;
+}
+
+bool RecordingParser::feed(const uint8_t* data, size_t length) {
+    if (error != RECORDING_PARSE_OK) return false;
+    
+    for (size_t i = 0; i < length; i++, bytes++) {
+        uint8_t c = data[i];
+        
+        if (format == RECORDING_FORMAT_RAW) {
+            value |= (uint32_t)c << (8 * digits);
+            if (++digits == RECORDING_RAW_SAMPLE_BYTES) {
+                if (!push(value)) return false;
+                value = 0;
+                digits = 0;
+            }
+            continue;
+        }
+        
+        if (inComment) {
+            if (c == '\n') inComment = false;
+            continue;
+        }
+        if (c >= '0' && c <= '9') {
+            // Saturate so oversized numbers fail the range check, not wrap
+            if (value <= RECORDING_MAX_US) value = value * 10 + (c - '0');
+            digits++;
+            continue;
+        }
+        if ((c == '-' || c == '+') && digits == 0 && !signSeen) {
+            signSeen = true;
+            continue;
+        }
+        
+        bool separator = (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' || c == ';');
+        if (!separator && c != '#') return fail(RECORDING_PARSE_BAD_CHAR);
+        if (digits > 0) {
+            if (!push(value)) return false;
+        } else if (signSeen) {
+            return fail(RECORDING_PARSE_BAD_CHAR);  // Sign without digits
+        }
+        value = 0;
+        digits = 0;
+        signSeen = false;
+        inComment = (c == '#');
+    }
+    return true;
+}
+
+bool RecordingParser::finish() {
+    if (error != RECORDING_PARSE_OK) return false;
+    
+    if (format == RECORDING_FORMAT_RAW) {
+        if (digits != 0) return fail(RECORDING_PARSE_TRUNCATED);
+    } else if (digits > 0) {
+        if (!push(value)) return false;
+    } else if (signSeen) {
+        return fail(RECORDING_PARSE_BAD_CHAR);
+    }
+    value = 0;
+    digits = 0;
+    signSeen = false;
+    
+    if (count == 0) return fail(RECORDING_PARSE_EMPTY);
+    return true;
+}
+
+int RecordingParser::getSampleCount() const {
+    return count;
+}
+
+size_t RecordingParser::getBytesParsed() const {
+    return bytes;
+}
+
+RecordingParseError RecordingParser::getError() const {
+    return error;
+}
+
+const char* RecordingParser::getErrorText() const {
+    switch (error) {
+        case RECORDING_PARSE_OK: return "ok";
+        case RECORDING_PARSE_BAD_CHAR: return "Unexpected character";
+        case RECORDING_PARSE_RANGE: return "Duration out of range";
+        case RECORDING_PARSE_TOO_MANY: return "Too many samples";
+        case RECORDING_PARSE_TRUNCATED: return "Truncated raw sample";
+        case RECORDING_PARSE_EMPTY: return "No samples";
+    }
+    return "Unknown error";
+}
+
+size_t RecordingParser::getErrorOffset() const {
+    return errorOffset;
+}
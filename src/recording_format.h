@@ -0,0 +1,80 @@
+#ifndef RECORDING_FORMAT_H
+#define RECORDING_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Serialized forms of a capture (edge-to-edge durations in microseconds,
+// alternating levels, first duration LOW as replaySignal sends it).
+//
+// RAW:  one little-endian uint32 per duration
+// TEXT: one fixed-width line per duration, signed by level:
+//       "-000350\n" = 350 us LOW, "+000700\n" = 700 us HIGH
+//
+// Both are fixed-size per sample, so any byte range can be produced
+// directly from the capture buffer without serializing what precedes it.
+// Plain C++ with no Arduino dependencies.
+
+#define RECORDING_RAW_SAMPLE_BYTES  4
+#define RECORDING_TEXT_SAMPLE_BYTES 8
+#define RECORDING_TEXT_MAX_US       999999
+#define RECORDING_MAX_US            1000000  // Longest duration accepted from uploads
+
+enum RecordingFormat {
+    RECORDING_FORMAT_RAW,
+    RECORDING_FORMAT_TEXT
+};
+
+size_t recordingEncodedSize(RecordingFormat format, int samples);
+
+// Writes bytes [offset, offset + maxLen) of the serialized capture into
+// out, clipped to its end; returns the number of bytes written
+size_t encodeRecordingRange(RecordingFormat format, const int* timings, int samples,
+                            size_t offset, uint8_t* out, size_t maxLen);
+
+enum RecordingParseError {
+    RECORDING_PARSE_OK,
+    RECORDING_PARSE_BAD_CHAR,   // Not a number, separator or comment
+    RECORDING_PARSE_RANGE,      // Duration of 0 or above RECORDING_MAX_US
+    RECORDING_PARSE_TOO_MANY,   // More durations than the output holds
+    RECORDING_PARSE_TRUNCATED,  // Raw body not a multiple of 4 bytes
+    RECORDING_PARSE_EMPTY       // No durations at all
+};
+
+// Incremental parser for uploaded captures: bytes may arrive in chunks of
+// any size, split anywhere, and are never buffered beyond one number.
+// TEXT input is more lenient than what the encoder writes: any signed or
+// unsigned integers separated by whitespace, ',' or ';', with '#' comments
+// to end of line. The sign is ignored since levels simply alternate.
+class RecordingParser {
+public:
+    RecordingParser();
+    void begin(RecordingFormat format, int* out, int capacity);
+    bool feed(const uint8_t* data, size_t length);  // False once an error occurred
+    bool finish();                                  // Completes a trailing number
+    
+    int getSampleCount() const;
+    size_t getBytesParsed() const;
+    RecordingParseError getError() const;
+    const char* getErrorText() const;
+    size_t getErrorOffset() const;  // Byte position of the error in the input
+    
+private:
+    RecordingFormat format;
+    int* out;
+    int capacity;
+    int count;
+    size_t bytes;
+    RecordingParseError error;
+    size_t errorOffset;
+    
+    uint32_t value;      // Number being accumulated
+    int digits;          // Raw: bytes of value seen; text: digits seen
+    bool inComment;
+    bool signSeen;
+    
+    bool push(uint32_t us);
+    bool fail(RecordingParseError reason);
+};
+
+#endif
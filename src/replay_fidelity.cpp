@@ -0,0 +1,153 @@
+#include "replay_fidelity.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FIDELITY_FIRST_LIMIT_US 200
+
+// Global analyzer instance, holding the last transmission's result
+ReplayFidelity replayFidelity;
+
+// Errors of the pulses being analyzed, and a copy to sort per class
+static int16_t pulseErrors[FIDELITY_MAX_PULSES];
+static uint8_t pulseClasses[FIDELITY_MAX_PULSES];
+static int16_t sortScratch[FIDELITY_MAX_PULSES];
+
+static int classOf(int widthUs) {
+    int limit = FIDELITY_FIRST_LIMIT_US;
+    for (int c = 0; c < FIDELITY_CLASSES - 1; c++) {
+        if (widthUs <= limit) return c;
+        limit *= 2;
+    }
+    return FIDELITY_CLASSES - 1;
+}
+
+static int compareInt16(const void* a, const void* b) {
+    return *(const int16_t*)a - *(const int16_t*)b;
+}
+
+ReplayFidelity::ReplayFidelity() {
+    clear();
+}
+
+void ReplayFidelity::clear() {
+    backend = "";
+    valid = false;
+    missingEdges = 0;
+    memset(&overall, 0, sizeof(overall));
+    memset(classes, 0, sizeof(classes));
+}
+
+bool ReplayFidelity::analyze(const char* backend, const int* timings, int count,
+                             const uint32_t* starts, int startCount, int firstIndex) {
+    clear();
+    this->backend = backend;
+    int expected = count - firstIndex;
+    missingEdges = (expected > startCount) ? expected - startCount : 0;
+
+    int n = 0;
+    for (int k = 0; k + 1 < startCount && firstIndex + k < count && n < FIDELITY_MAX_PULSES; k++) {
+        int source = timings[firstIndex + k];
+        long error = (long)(starts[k + 1] - starts[k]) - source;
+        // Symmetric clamp so abs() of any stored error still fits int16_t
+        if (error > INT16_MAX) error = INT16_MAX;
+        if (error < -INT16_MAX) error = -INT16_MAX;
+        pulseErrors[n] = (int16_t)error;
+        pulseClasses[n] = classOf(source);
+        n++;
+    }
+    if (n == 0) return false;
+
+    memcpy(sortScratch, pulseErrors, n * sizeof(int16_t));
+    computeStats(&overall, sortScratch, n);
+    for (int c = 0; c < FIDELITY_CLASSES; c++) {
+        int m = 0;
+        for (int i = 0; i < n; i++) {
+            if (pulseClasses[i] == c) sortScratch[m++] = pulseErrors[i];
+        }
+        computeStats(&classes[c], sortScratch, m);
+    }
+    valid = true;
+    return true;
+}
+
+// Sorts errors in place (as absolute values) for the percentiles
+void ReplayFidelity::computeStats(FidelityStats* stats, int16_t* errors, int n) {
+    memset(stats, 0, sizeof(*stats));
+    stats->count = n;
+    if (n == 0) return;
+
+    double sum = 0;
+    double sumSquares = 0;
+    for (int i = 0; i < n; i++) {
+        sum += errors[i];
+        sumSquares += (double)errors[i] * errors[i];
+    }
+    double mean = sum / n;
+    double variance = sumSquares / n - mean * mean;
+    stats->meanErrUs = mean;
+    stats->jitterUs = (variance > 0) ? sqrt(variance) : 0;
+
+    for (int i = 0; i < n; i++) {
+        errors[i] = (int16_t)abs(errors[i]);
+    }
+    qsort(errors, n, sizeof(int16_t), compareInt16);
+    stats->maxAbsErrUs = errors[n - 1];
+    // Nearest rank
+    stats->p50Us = errors[(n * 50 + 99) / 100 - 1];
+    stats->p90Us = errors[(n * 90 + 99) / 100 - 1];
+    stats->p99Us = errors[(n * 99 + 99) / 100 - 1];
+}
+
+bool ReplayFidelity::hasResult() {
+    return valid;
+}
+
+const char* ReplayFidelity::getBackend() {
+    return backend;
+}
+
+int ReplayFidelity::getMissingEdges() {
+    return missingEdges;
+}
+
+const FidelityStats& ReplayFidelity::getOverall() {
+    return overall;
+}
+
+const FidelityStats& ReplayFidelity::getClass(int index) {
+    return classes[index];
+}
+
+int ReplayFidelity::getClassLimit(int index) {
+    if (index >= FIDELITY_CLASSES - 1) return 0;
+    return FIDELITY_FIRST_LIMIT_US << index;
+}
+
+size_t ReplayFidelity::formatReport(char* out, size_t len) {
+    if (len == 0) return 0;
+    out[0] = '\0';
+    if (!valid) return 0;
+
+    size_t used = 0;
+    int n = snprintf(out, len, "%s: %d pulses, %d missing, mean %+.1fus jitter %.1fus max %dus p50/p90/p99 %d/%d/%dus\n",
+                     backend, overall.count, missingEdges, overall.meanErrUs, overall.jitterUs,
+                     overall.maxAbsErrUs, overall.p50Us, overall.p90Us, overall.p99Us);
+    if (n > 0) used += n;
+
+    for (int c = 0; c < FIDELITY_CLASSES && used < len; c++) {
+        const FidelityStats& s = classes[c];
+        if (s.count == 0) continue;
+        char width[16];
+        if (getClassLimit(c) > 0) {
+            snprintf(width, sizeof(width), "<=%dus", getClassLimit(c));
+        } else {
+            snprintf(width, sizeof(width), ">%dus", getClassLimit(c - 1));
+        }
+        n = snprintf(out + used, len - used, "  %-8s %4d pulses, mean %+.1fus jitter %.1fus max %dus p50/p90/p99 %d/%d/%dus\n",
+                     width, s.count, s.meanErrUs, s.jitterUs, s.maxAbsErrUs, s.p50Us, s.p90Us, s.p99Us);
+        if (n > 0) used += n;
+    }
+    return (used < len) ? used : len - 1;
+}
@@ -0,0 +1,65 @@
+#ifndef REPLAY_FIDELITY_H
+#define REPLAY_FIDELITY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Scores how closely a transmission reproduced its source timings. The
+// input is the time each pulse actually started, as seen by a receiver of
+// the TX pin (device loopback) or the simulator's TX log (host); each
+// emitted width is compared with the duration it was meant to have.
+//
+// Errors are emitted minus source, in microseconds. Pulses are grouped by
+// source width, since a fixed per-edge overhead matters more to short
+// pulses. Percentiles are of the absolute error. Plain C++ with no Arduino
+// dependencies.
+
+#define FIDELITY_MAX_PULSES 512
+#define FIDELITY_CLASSES    7    // <=200us, <=400us ... <=6400us, longer
+
+struct FidelityStats {
+    int count;
+    float meanErrUs;    // Signed: positive means pulses came out long
+    float jitterUs;     // Standard deviation of the error
+    int maxAbsErrUs;
+    int p50Us;
+    int p90Us;
+    int p99Us;
+};
+
+class ReplayFidelity {
+public:
+    ReplayFidelity();
+
+    // starts[k] is when timings[firstIndex + k] began. A loopback receiver
+    // misses the first level (LOW onto an idle LOW line), so it passes 1;
+    // a TX log that sees every write passes 0. Returns false if fewer than
+    // two starts line up with the timings.
+    bool analyze(const char* backend, const int* timings, int count,
+                 const uint32_t* starts, int startCount, int firstIndex);
+    void clear();
+
+    bool hasResult();
+    const char* getBackend();
+    int getMissingEdges();    // Starts expected but not observed
+    const FidelityStats& getOverall();
+    const FidelityStats& getClass(int index);
+    int getClassLimit(int index);  // Upper source width in us, 0 = unbounded
+
+    // One summary line plus a line per non-empty class, newline-terminated;
+    // returns the length written (clipped to len - 1)
+    size_t formatReport(char* out, size_t len);
+
+private:
+    const char* backend;
+    bool valid;
+    int missingEdges;
+    FidelityStats overall;
+    FidelityStats classes[FIDELITY_CLASSES];
+
+    void computeStats(FidelityStats* stats, int16_t* errors, int n);
+};
+
+extern ReplayFidelity replayFidelity;
+
+#endif
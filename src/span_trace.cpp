@@ -0,0 +1,200 @@
+#include "span_trace.h"
+
+#define TRACE_CALIBRATION_SPANS 32
+
+// Global span trace instance
+SpanTrace spanTrace;
+
+SpanTrace::SpanTrace() {
+    head = 0;
+    enabled = true;
+    dumping = false;
+    cyclesPerSpan = 0;
+    cpuMHz = 0;
+    enabledAtMs = 0;
+    dumpId = 0;
+    dumpFirst = 0;
+    dumpCount = 0;
+    dumpIndex = 0;
+    dumpBaseUs = 0;
+    dumpLastReadMs = 0;
+    dumpLineLen = 0;
+    dumpLinePos = 0;
+}
+
+void SpanTrace::begin() {
+    cpuMHz = ESP.getCpuFreqMHz();
+#if SPAN_TRACE
+    uint32_t start = ESP.getCycleCount();
+    for (int i = 0; i < TRACE_CALIBRATION_SPANS; i++) {
+        TRACE_SPAN("trace", "calibrate");
+    }
+    cyclesPerSpan = (ESP.getCycleCount() - start) / TRACE_CALIBRATION_SPANS;
+#endif
+    clear();
+    Serial.printf("[TRACE] %d-span ring, ~%lu cycles per span\n", TRACE_RING_SIZE, (unsigned long)cyclesPerSpan);
+}
+
+void SpanTrace::setEnabled(bool enabled) {
+    if (enabled && !this->enabled) clear();
+    this->enabled = enabled;
+}
+
+bool SpanTrace::isEnabled() {
+    return enabled;
+}
+
+void SpanTrace::clear() {
+    head = 0;
+    enabledAtMs = millis();
+}
+
+void SpanTrace::record(const char* category, const char* name, uint32_t startUs,
+                       uint32_t startCycles, uint8_t core) {
+    uint32_t endCycles = ESP.getCycleCount();
+    uint32_t endUs = micros();
+    if (!enabled) return;
+    if (dumping) {
+        // Recording stays paused while a dump reads the ring, unless the
+        // reader went away
+        if (millis() - dumpLastReadMs < TRACE_DUMP_TIMEOUT_MS) return;
+        dumping = false;
+    }
+
+    uint32_t slot = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) & (TRACE_RING_SIZE - 1);
+    TraceSpan& span = ring[slot];
+    span.category = category;
+    span.name = name;
+    span.startUs = startUs;
+    span.core = core;
+    // Cycle counters are per core, stop in light sleep and wrap after
+    // 2^32 cycles (~18 s at 240 MHz), so unless they agree with micros()
+    // the span is timed in us
+    uint32_t cycles = endCycles - startCycles;
+    uint32_t elapsedUs = endUs - startUs;
+    uint32_t cycleUs = (cpuMHz > 0) ? cycles / cpuMHz : 0;
+    uint32_t apart = (cycleUs > elapsedUs) ? cycleUs - elapsedUs : elapsedUs - cycleUs;
+    if (xPortGetCoreID() == core && cpuMHz > 0 && apart <= TRACE_CYCLE_SLACK_US) {
+        span.duration = cycles;
+        span.durationUs = 0;
+    } else {
+        span.duration = elapsedUs;
+        span.durationUs = 1;
+    }
+}
+
+uint32_t SpanTrace::getSpanCount() {
+    return head;
+}
+
+uint32_t SpanTrace::getCyclesPerSpan() {
+    return cyclesPerSpan;
+}
+
+float SpanTrace::getOverheadPercent() {
+    unsigned long elapsedMs = millis() - enabledAtMs;
+    if (elapsedMs == 0) return 0.0;
+    double tracingUs = (double)head * cyclesPerSpan / ESP.getCpuFreqMHz();
+    return tracingUs / (elapsedMs * 10.0);
+}
+
+uint32_t SpanTrace::beginDump() {
+    if (dumping && millis() - dumpLastReadMs < TRACE_DUMP_TIMEOUT_MS) return 0;
+    if (++dumpId == 0) dumpId = 1;
+    dumping = true;
+    dumpLastReadMs = millis();
+
+    uint32_t total = head;
+    dumpCount = min(total, (uint32_t)TRACE_RING_SIZE);
+    dumpFirst = total - dumpCount;
+    dumpIndex = 0;
+    dumpLineLen = 0;
+    dumpLinePos = 0;
+
+    // Nested spans are recorded when they end, after their children, so
+    // the earliest start is not necessarily the oldest entry
+    dumpBaseUs = 0;
+    for (uint32_t i = 0; i < dumpCount; i++) {
+        uint32_t startUs = ring[(dumpFirst + i) & (TRACE_RING_SIZE - 1)].startUs;
+        if (i == 0 || (int32_t)(startUs - dumpBaseUs) < 0) dumpBaseUs = startUs;
+    }
+
+    int n = snprintf(dumpLine, sizeof(dumpLine),
+                     "{\"traceEvents\":[\n"
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"core 0\"}},\n"
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"core 1\"}}");
+    dumpLineLen = min((size_t)n, sizeof(dumpLine) - 1);
+    return dumpId;
+}
+
+// Formats the next span (or the trailer) into dumpLine
+bool SpanTrace::nextDumpLine() {
+    dumpLinePos = 0;
+    dumpLineLen = 0;
+    int n = 0;
+
+    if (dumpIndex < dumpCount) {
+        const TraceSpan& span = ring[(dumpFirst + dumpIndex) & (TRACE_RING_SIZE - 1)];
+        uint64_t durationNs = span.durationUs ? (uint64_t)span.duration * 1000
+                                              : (uint64_t)span.duration * 1000 / cpuMHz;
+        n = snprintf(dumpLine, sizeof(dumpLine),
+                     ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                     "\"ts\":%lu,\"dur\":%lu.%03lu}",
+                     span.name, span.category, span.core,
+                     (unsigned long)(span.startUs - dumpBaseUs),
+                     (unsigned long)(durationNs / 1000), (unsigned long)(durationNs % 1000));
+    } else if (dumpIndex == dumpCount) {
+        n = snprintf(dumpLine, sizeof(dumpLine),
+                     "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"spans\":%lu,\"dropped\":%lu,"
+                     "\"cycles_per_span\":%lu,\"cpu_mhz\":%lu,\"overhead_pct\":%.3f}}\n",
+                     (unsigned long)(dumpFirst + dumpCount), (unsigned long)dumpFirst,
+                     (unsigned long)cyclesPerSpan, (unsigned long)ESP.getCpuFreqMHz(),
+                     getOverheadPercent());
+    } else {
+        return false;
+    }
+
+    dumpIndex++;
+    dumpLineLen = min((size_t)max(n, 0), sizeof(dumpLine) - 1);
+    return true;
+}
+
+size_t SpanTrace::readDump(uint32_t id, uint8_t* buffer, size_t maxLen) {
+    if (!dumping || id != dumpId) return 0;
+    dumpLastReadMs = millis();
+
+    size_t written = 0;
+    while (written < maxLen) {
+        if (dumpLinePos == dumpLineLen && !nextDumpLine()) {
+            dumping = false;
+            break;
+        }
+        size_t n = min(maxLen - written, dumpLineLen - dumpLinePos);
+        memcpy(buffer + written, dumpLine + dumpLinePos, n);
+        dumpLinePos += n;
+        written += n;
+    }
+    return written;
+}
+
+bool SpanTrace::ownsDump(uint32_t id) {
+    return id == dumpId;
+}
+
+void SpanTrace::endDump(uint32_t id) {
+    if (id == dumpId) dumping = false;
+}
+
+void SpanTrace::dumpToSerial() {
+    uint32_t id = beginDump();
+    if (id == 0) {
+        Serial.println("[TRACE] Dump already in progress");
+        return;
+    }
+    uint8_t chunk[256];
+    size_t n;
+    while ((n = readDump(id, chunk, sizeof(chunk))) > 0) {
+        Serial.write(chunk, n);
+    }
+    Serial.flush();
+}
@@ -0,0 +1,115 @@
+#ifndef SPAN_TRACE_H
+#define SPAN_TRACE_H
+
+#include <Arduino.h>
+
+// Span tracing: TRACE_SPAN(category, name) at the top of a scope records
+// its start time and its length in CPU cycles into a fixed ring. The ring
+// is dumped as Chrome trace-event JSON (chrome://tracing, Perfetto) over
+// serial or GET /trace. Names and categories must be string literals.
+//
+// A span costs two cycle-counter reads, two micros() reads and a ring
+// write; the calibrated per-span cost is reported with each dump so the
+// overhead can be checked. Build with -DSPAN_TRACE=0 to compile the macros
+// out.
+
+#ifndef SPAN_TRACE
+#define SPAN_TRACE 1
+#endif
+
+#define TRACE_RING_SIZE 512         // Spans kept (oldest overwritten), power of two
+#define TRACE_DUMP_TIMEOUT_MS 5000  // Abandoned dump resumes recording after this
+#define TRACE_CYCLE_SLACK_US 4      // Cycle and micros() timings further apart use micros()
+
+struct TraceSpan {
+    const char* category;
+    const char* name;
+    uint32_t startUs;    // micros() at entry
+    uint32_t duration;   // CPU cycles, or us if the cycle count is not usable
+    uint8_t core;
+    uint8_t durationUs;
+};
+
+class SpanTrace {
+public:
+    SpanTrace();
+    void begin();  // Calibrates the per-span cost
+
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    void clear();
+
+    void record(const char* category, const char* name, uint32_t startUs,
+                uint32_t startCycles, uint8_t core);
+
+    uint32_t getSpanCount();       // Recorded since the last clear
+    uint32_t getCyclesPerSpan();   // Calibrated tracing cost
+    float getOverheadPercent();    // Tracing cost as a share of elapsed time
+
+    // Chrome trace JSON, produced in pieces. Recording pauses while a dump
+    // is in progress. beginDump() returns the dump's id (0 if another dump
+    // holds the ring); readDump() returns 0 once it is complete, or if a
+    // later dump took the ring over after this one stalled. endDump()
+    // releases the ring early, e.g. when the reader disconnects
+    uint32_t beginDump();
+    size_t readDump(uint32_t id, uint8_t* buffer, size_t maxLen);
+    bool ownsDump(uint32_t id);
+    void endDump(uint32_t id);
+    void dumpToSerial();
+
+private:
+    TraceSpan ring[TRACE_RING_SIZE];
+    volatile uint32_t head;  // Total spans written; slot is head % size
+    volatile bool enabled;
+    volatile bool dumping;
+    uint32_t cyclesPerSpan;
+    uint32_t cpuMHz;  // Cycles per us, from begin(); 0 times every span in us
+    unsigned long enabledAtMs;
+
+    // Dump cursor, owned by the dump with id dumpId
+    uint32_t dumpId;
+    uint32_t dumpFirst;
+    uint32_t dumpCount;
+    uint32_t dumpIndex;  // Next span; dumpCount + 1 = trailer, + 2 = done
+    uint32_t dumpBaseUs;
+    unsigned long dumpLastReadMs;
+    char dumpLine[192];
+    size_t dumpLineLen;
+    size_t dumpLinePos;
+
+    bool nextDumpLine();
+};
+
+extern SpanTrace spanTrace;
+
+#if SPAN_TRACE
+// Records the enclosing scope as one span
+class SpanScope {
+public:
+    SpanScope(const char* category, const char* name) {
+        this->category = category;
+        this->name = name;
+        core = xPortGetCoreID();
+        startUs = micros();
+        startCycles = ESP.getCycleCount();
+    }
+    ~SpanScope() {
+        spanTrace.record(category, name, startUs, startCycles, core);
+    }
+
+private:
+    const char* category;
+    const char* name;
+    uint32_t startUs;
+    uint32_t startCycles;
+    uint8_t core;
+};
+
+#define TRACE_CONCAT2(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT2(a, b)
+#define TRACE_SPAN(category, name) SpanScope TRACE_CONCAT(traceSpan, __LINE__)(category, name)
+#else
+#define TRACE_SPAN(category, name) do {} while (0)
+#endif
+
+#endif
@@ -0,0 +1,63 @@
+#include "spectrum_frame.h"
+
+static void putU16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+static uint16_t getU16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+size_t encodeSpectrumFrame(uint8_t* out, size_t capacity, SpectrumFrameType type,
+                           float startMHz, float stepMHz, uint32_t timestamp,
+                           const int* dbm, uint16_t count) {
+    size_t length = SPECTRUM_FRAME_SIZE(count);
+    if (length > capacity) return 0;
+
+    out[0] = SPECTRUM_FRAME_MAGIC0;
+    out[1] = SPECTRUM_FRAME_MAGIC1;
+    out[2] = SPECTRUM_FRAME_VERSION;
+    out[3] = type;
+    putU16(out + 4, count);
+    putU32(out + 6, (uint32_t)(startMHz * 1000.0f + 0.5f));
+    putU32(out + 10, (uint32_t)(stepMHz * 1000000.0f + 0.5f));
+    putU32(out + 14, timestamp);
+
+    uint8_t* bins = out + SPECTRUM_FRAME_HEADER_SIZE;
+    for (uint16_t i = 0; i < count; i++) {
+        int v = dbm[i];
+        if (v < -128) v = -128;
+        if (v > 127) v = 127;
+        bins[i] = (uint8_t)(int8_t)v;
+    }
+    return length;
+}
+
+bool decodeSpectrumFrame(const uint8_t* data, size_t length, SpectrumFrame* frame) {
+    if (length < SPECTRUM_FRAME_HEADER_SIZE) return false;
+    if (data[0] != SPECTRUM_FRAME_MAGIC0 || data[1] != SPECTRUM_FRAME_MAGIC1) return false;
+    if (data[2] != SPECTRUM_FRAME_VERSION) return false;
+
+    frame->version = data[2];
+    frame->type = data[3];
+    frame->count = getU16(data + 4);
+    frame->startKHz = getU32(data + 6);
+    frame->stepHz = getU32(data + 10);
+    frame->timestamp = getU32(data + 14);
+    if (length < SPECTRUM_FRAME_SIZE(frame->count)) return false;
+
+    frame->bins = (const int8_t*)(data + SPECTRUM_FRAME_HEADER_SIZE);
+    return true;
+}
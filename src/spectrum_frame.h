@@ -0,0 +1,53 @@
+#ifndef SPECTRUM_FRAME_H
+#define SPECTRUM_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Compact binary frame for spectrum sweeps and RSSI samples sent to remote
+// clients. All fields are little-endian; the bins follow the header as one
+// signed byte (dBm, clamped to -128..127) each.
+//
+//  offset  size  field
+//  0       2     magic 'S','F'
+//  2       1     version (SPECTRUM_FRAME_VERSION)
+//  3       1     type (SpectrumFrameType)
+//  4       2     bin count
+//  6       4     start frequency (kHz)
+//  10      4     step between bins (Hz; 0 for RSSI samples on one frequency)
+//  14      4     timestamp (ms since boot, of the newest bin)
+//  18      n     bins (int8 dBm)
+//
+// Plain C++ with no Arduino dependencies, so host tools can decode frames.
+
+#define SPECTRUM_FRAME_MAGIC0      'S'
+#define SPECTRUM_FRAME_MAGIC1      'F'
+#define SPECTRUM_FRAME_VERSION     1
+#define SPECTRUM_FRAME_HEADER_SIZE 18
+#define SPECTRUM_FRAME_SIZE(bins)  ((size_t)SPECTRUM_FRAME_HEADER_SIZE + (bins))
+
+enum SpectrumFrameType {
+    SPECTRUM_FRAME_SWEEP = 0,  // One bin per frequency step
+    SPECTRUM_FRAME_RSSI  = 1   // Successive samples on one frequency, oldest first
+};
+
+struct SpectrumFrame {
+    uint8_t version;
+    uint8_t type;
+    uint16_t count;
+    uint32_t startKHz;
+    uint32_t stepHz;
+    uint32_t timestamp;
+    const int8_t* bins;  // Points into the decoded buffer
+};
+
+// Writes a frame into out; returns its length, or 0 if it does not fit
+size_t encodeSpectrumFrame(uint8_t* out, size_t capacity, SpectrumFrameType type,
+                           float startMHz, float stepMHz, uint32_t timestamp,
+                           const int* dbm, uint16_t count);
+
+// Parses a frame in place; returns false on bad magic, unknown version or
+// a truncated buffer
+bool decodeSpectrumFrame(const uint8_t* data, size_t length, SpectrumFrame* frame);
+
+#endif
@@ -0,0 +1,153 @@
+#include "spi_profiler.h"
+#include <SPI.h>
+#include "cc1101_interface.h"
+
+static const char* const modeNames[SPI_PROFILE_MODES] = {
+    "idle", "scan", "spectrum", "listen", "record", "replay"
+};
+
+static const char* const callNames[SPI_CALL_COUNT] = {
+    "setMHZ", "SetRx", "getRssi", "setModulation", "other"
+};
+
+// Global SPI profiler instance
+SpiProfiler spiProfiler;
+
+SpiProfiler::SpiProfiler() {
+    memset(stats, 0, sizeof(stats));
+    memset(modeTimeUs, 0, sizeof(modeTimeUs));
+    mode = 0;
+    modeSinceUs = 0;
+    currentCall = SPI_CALL_OTHER;
+    selected = false;
+    selectCycles = 0;
+    currentBytes = 0;
+}
+
+bool SpiProfiler::isEnabled() {
+#ifdef SPI_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SpiProfiler::setMode(int mode) {
+    if (mode < 0 || mode >= SPI_PROFILE_MODES) mode = 0;
+    uint32_t now = micros();
+    modeTimeUs[this->mode] += now - modeSinceUs;
+    modeSinceUs = now;
+    this->mode = mode;
+}
+
+void SpiProfiler::clear() {
+    memset(stats, 0, sizeof(stats));
+    memset(modeTimeUs, 0, sizeof(modeTimeUs));
+    modeSinceUs = micros();
+}
+
+SpiCall SpiProfiler::beginCall(SpiCall call) {
+    SpiCall previous = currentCall;
+    currentCall = call;
+    stats[mode][call].calls++;
+    return previous;
+}
+
+void SpiProfiler::endCall(SpiCall previous) {
+    currentCall = previous;
+}
+
+void SpiProfiler::select() {
+    currentBytes = 0;
+    selectCycles = ESP.getCycleCount();
+    selected = true;
+}
+
+void SpiProfiler::deselect() {
+    if (!selected) return;
+    uint32_t cycles = ESP.getCycleCount() - selectCycles;
+    selected = false;
+    SpiCallStats& s = stats[mode][currentCall];
+    s.transactions++;
+    s.bytes += currentBytes;
+    s.busCycles += cycles;
+}
+
+const char* SpiProfiler::getModeName(int mode) {
+    return (mode >= 0 && mode < SPI_PROFILE_MODES) ? modeNames[mode] : "?";
+}
+
+const char* SpiProfiler::getCallName(int call) {
+    return (call >= 0 && call < SPI_CALL_COUNT) ? callNames[call] : "?";
+}
+
+const SpiCallStats& SpiProfiler::getStats(int mode, int call) {
+    return stats[mode][call];
+}
+
+SpiCallStats SpiProfiler::getModeTotal(int mode) {
+    SpiCallStats total = {};
+    for (int i = 0; i < SPI_CALL_COUNT; i++) {
+        total.calls += stats[mode][i].calls;
+        total.transactions += stats[mode][i].transactions;
+        total.bytes += stats[mode][i].bytes;
+        total.busCycles += stats[mode][i].busCycles;
+    }
+    return total;
+}
+
+uint64_t SpiProfiler::getModeUs(int mode) {
+    uint64_t us = modeTimeUs[mode];
+    if (mode == this->mode) us += micros() - modeSinceUs;
+    return us;
+}
+
+uint32_t SpiProfiler::cyclesToUs(uint64_t cycles) {
+    return (uint32_t)(cycles / ESP.getCpuFreqMHz());
+}
+
+int SpiProfiler::getBusiestMode() {
+    int busiest = 0;
+    SpiCallStats most = getModeTotal(0);
+    for (int m = 1; m < SPI_PROFILE_MODES; m++) {
+        SpiCallStats total = getModeTotal(m);
+        if (total.busCycles > most.busCycles ||
+            (total.busCycles == most.busCycles && total.transactions > most.transactions)) {
+            most = total;
+            busiest = m;
+        }
+    }
+    return busiest;
+}
+
+void SpiProfiler::copyStats(SpiCallStats out[SPI_PROFILE_MODES][SPI_CALL_COUNT],
+                            uint64_t modeUs[SPI_PROFILE_MODES]) {
+    memcpy(out, stats, sizeof(stats));
+    for (int m = 0; m < SPI_PROFILE_MODES; m++) {
+        modeUs[m] = getModeUs(m);
+    }
+}
+
+#ifdef SPI_PROFILE
+// Link-time shim (see spi_profiler.h). The driver raises CS after its
+// last byte, so the bus time stops before the pin write and starts after
+extern "C" void __real_digitalWrite(uint8_t pin, uint8_t value);
+extern "C" uint8_t __real__ZN8SPIClass8transferEh(SPIClass* spi, uint8_t data);
+
+extern "C" void __wrap_digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin != CC1101_CS) {
+        __real_digitalWrite(pin, value);
+    } else if (value == LOW) {
+        __real_digitalWrite(pin, value);
+        spiProfiler.select();
+    } else {
+        spiProfiler.deselect();
+        __real_digitalWrite(pin, value);
+    }
+}
+
+extern "C" uint8_t __wrap__ZN8SPIClass8transferEh(SPIClass* spi, uint8_t data) {
+    spiProfiler.countByte();
+    return __real__ZN8SPIClass8transferEh(spi, data);
+}
+#endif
@@ -0,0 +1,105 @@
+#ifndef SPI_PROFILER_H
+#define SPI_PROFILER_H
+
+#include <Arduino.h>
+
+// Counts the SPI traffic behind each CC1101Interface call: transactions,
+// bytes and bus time, per operation mode. The SmartRC driver is a prebuilt
+// library, so the shim sits at link time: with -DSPI_PROFILE the firmware
+// must also be linked with
+//
+//   -Wl,--wrap=digitalWrite -Wl,--wrap=_ZN8SPIClass8transferEh
+//
+// A transaction is the chip select low; its bus time runs from CS low to
+// CS high in CPU cycles and its bytes are SPIClass::transfer(uint8_t)
+// calls in between, the only SPI call the driver makes. Without
+// SPI_PROFILE the macros compile out and every count stays zero.
+
+#define SPI_PROFILE_MODES 6  // OperationMode values, MODE_IDLE first
+
+enum SpiCall {
+    SPI_CALL_SET_MHZ,
+    SPI_CALL_SET_RX,
+    SPI_CALL_GET_RSSI,
+    SPI_CALL_SET_MODULATION,
+    SPI_CALL_OTHER,  // Init, applyConfig, TX and anything else unscoped
+    SPI_CALL_COUNT
+};
+
+struct SpiCallStats {
+    uint32_t calls;
+    uint32_t transactions;
+    uint32_t bytes;
+    uint64_t busCycles;
+};
+
+// Written from whichever task drives the radio (the init task at boot,
+// then the main loop); readers copy without locking and may see a count
+// one transaction ahead of its bus time
+class SpiProfiler {
+public:
+    SpiProfiler();
+
+    bool isEnabled();  // Built with SPI_PROFILE
+    void setMode(int mode);
+    void clear();
+
+    // Called by SpiCallScope; returns the call being replaced
+    SpiCall beginCall(SpiCall call);
+    void endCall(SpiCall previous);
+
+    // Called by the link-time shim
+    void select();
+    void deselect();
+    void countByte() {
+        if (selected) currentBytes++;
+    }
+
+    static const char* getModeName(int mode);
+    static const char* getCallName(int call);
+
+    const SpiCallStats& getStats(int mode, int call);
+    SpiCallStats getModeTotal(int mode);
+    uint64_t getModeUs(int mode);  // Time spent in the mode so far
+    uint32_t cyclesToUs(uint64_t cycles);
+    int getBusiestMode();  // Most bus time, or MODE_IDLE if none yet
+
+    // Snapshot for the metrics exporter
+    void copyStats(SpiCallStats out[SPI_PROFILE_MODES][SPI_CALL_COUNT], uint64_t modeUs[SPI_PROFILE_MODES]);
+
+private:
+    SpiCallStats stats[SPI_PROFILE_MODES][SPI_CALL_COUNT];
+    uint64_t modeTimeUs[SPI_PROFILE_MODES];
+    int mode;
+    uint32_t modeSinceUs;
+    SpiCall currentCall;
+    volatile bool selected;
+    uint32_t selectCycles;
+    uint32_t currentBytes;
+};
+
+extern SpiProfiler spiProfiler;
+
+// Attributes the SPI traffic of the enclosing scope to a call
+class SpiCallScope {
+public:
+    SpiCallScope(SpiCall call) {
+        previous = spiProfiler.beginCall(call);
+    }
+    ~SpiCallScope() {
+        spiProfiler.endCall(previous);
+    }
+
+private:
+    SpiCall previous;
+};
+
+#ifdef SPI_PROFILE
+#define SPI_PROFILE_CONCAT2(a, b) a##b
+#define SPI_PROFILE_CONCAT(a, b) SPI_PROFILE_CONCAT2(a, b)
+#define SPI_PROFILE_CALL(call) SpiCallScope SPI_PROFILE_CONCAT(spiCallScope, __LINE__)(call)
+#else
+#define SPI_PROFILE_CALL(call)
+#endif
+
+#endif
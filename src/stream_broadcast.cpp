@@ -0,0 +1,326 @@
+#include "stream_broadcast.h"
+
+#define STREAM_FRAME_TRAILER "\r\n\r\n"
+
+// Sends the SSE headers, then hands the connection to the broadcaster once
+// they are acknowledged (same hand-over as AsyncEventSource)
+class StreamResponse : public AsyncWebServerResponse {
+public:
+    StreamResponse(StreamBroadcaster* broadcaster) {
+        this->broadcaster = broadcaster;
+        _code = 200;
+        _contentType = "text/event-stream";
+        _sendContentLength = false;
+        addHeader("Cache-Control", "no-cache");
+        addHeader("Connection", "keep-alive");
+    }
+
+    void _respond(AsyncWebServerRequest* request) override {
+        String head = _assembleHead(request->version());
+        request->client()->write(head.c_str(), _headLength);
+        _state = RESPONSE_WAIT_ACK;
+    }
+
+    size_t _ack(AsyncWebServerRequest* request, size_t len, uint32_t time) override {
+        if (len) broadcaster->attach(request);  // Deletes the request
+        return 0;
+    }
+
+    bool _sourceValid() const override {
+        return true;
+    }
+
+private:
+    StreamBroadcaster* broadcaster;
+};
+
+StreamBroadcaster::StreamBroadcaster() {
+    lock = nullptr;
+    clientCount = 0;
+    connectCount = 0;
+    for (int i = 0; i < STREAM_FRAME_POOL; i++) {
+        pool[i].refs = 0;
+        pool[i].length = 0;
+    }
+    for (int i = 0; i < STREAM_MAX_CHANNELS; i++) {
+        latest[i] = nullptr;
+        published[i] = 0;
+    }
+    for (int i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        clients[i].tcp = nullptr;
+        clients[i].current = nullptr;
+    }
+}
+
+void StreamBroadcaster::begin() {
+    if (lock == nullptr) {
+        lock = xSemaphoreCreateMutex();
+    }
+}
+
+AsyncWebServerResponse* StreamBroadcaster::createResponse() {
+    return new StreamResponse(this);
+}
+
+void StreamBroadcaster::attach(AsyncWebServerRequest* request) {
+    AsyncClient* tcp = request->client();
+    tcp->setRxTimeout(0);
+    tcp->onError(nullptr, nullptr);
+    tcp->onData(nullptr, nullptr);
+    tcp->onAck([](void* arg, AsyncClient* c, size_t len, uint32_t time) {
+        StreamBroadcaster* self = (StreamBroadcaster*)arg;
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        Client* client = self->findClient(c);
+        if (client != nullptr) self->pumpClient(*client);
+        xSemaphoreGive(self->lock);
+    }, this);
+    tcp->onPoll([](void* arg, AsyncClient* c) {
+        StreamBroadcaster* self = (StreamBroadcaster*)arg;
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        Client* client = self->findClient(c);
+        if (client != nullptr) self->pumpClient(*client);
+        xSemaphoreGive(self->lock);
+    }, this);
+    tcp->onTimeout([](void* arg, AsyncClient* c, uint32_t time) {
+        c->close(true);
+    }, this);
+    tcp->onDisconnect([](void* arg, AsyncClient* c) {
+        ((StreamBroadcaster*)arg)->detach(c);
+        delete c;
+    }, this);
+    delete request;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Client* client = findClient(nullptr);
+    if (client != nullptr) {
+        // Start from the newest frame of every channel
+        client->tcp = tcp;
+        client->current = nullptr;
+        client->offset = 0;
+        for (int i = 0; i < STREAM_MAX_CHANNELS; i++) {
+            client->seen[i] = (latest[i] != nullptr) ? published[i] - 1 : published[i];
+        }
+        client->nextChannel = 0;
+        client->sent = 0;
+        client->dropped = 0;
+        client->connectedMs = millis();
+        clientCount++;
+        connectCount++;
+        pumpClient(*client);
+    }
+    xSemaphoreGive(lock);
+
+    if (client == nullptr) {
+        tcp->close();  // No free slot; the disconnect callback frees it
+    }
+}
+
+void StreamBroadcaster::detach(AsyncClient* tcp) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Client* client = findClient(tcp);
+    if (client != nullptr) {
+        if (client->current != nullptr) release(client->current);
+        client->current = nullptr;
+        client->tcp = nullptr;
+        clientCount--;
+    }
+    xSemaphoreGive(lock);
+}
+
+void StreamBroadcaster::closeAll() {
+    if (lock == nullptr) return;
+
+    // close() disconnects synchronously, which takes the lock in detach()
+    AsyncClient* open[STREAM_MAX_CLIENTS];
+    int count = 0;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        if (clients[i].tcp != nullptr) open[count++] = clients[i].tcp;
+    }
+    xSemaphoreGive(lock);
+
+    for (int i = 0; i < count; i++) {
+        open[i]->close(true);
+    }
+}
+
+StreamBroadcaster::Client* StreamBroadcaster::findClient(AsyncClient* tcp) {
+    for (int i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        if (clients[i].tcp == tcp) return &clients[i];
+    }
+    return nullptr;
+}
+
+StreamFrame* StreamBroadcaster::beginFrame(int channel, const char* event, uint32_t id) {
+    if (lock == nullptr || channel < 0 || channel >= STREAM_MAX_CHANNELS) return nullptr;
+
+    StreamFrame* frame = nullptr;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < STREAM_FRAME_POOL; i++) {
+        if (pool[i].refs == 0) {
+            frame = &pool[i];
+            frame->refs = 1;  // The channel's reference once committed
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+    if (frame == nullptr) return nullptr;
+
+    // Not yet visible to clients, so it is filled outside the lock
+    int n = snprintf(frame->data, sizeof(frame->data), "id: %u\r\nevent: %s\r\ndata: ",
+                     (unsigned)id, event);
+    frame->length = n;
+    return frame;
+}
+
+void StreamBroadcaster::commitFrame(int channel, StreamFrame* frame) {
+    memcpy(frame->data + frame->length, STREAM_FRAME_TRAILER, 4);
+    frame->length += 4;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (latest[channel] != nullptr) release(latest[channel]);
+    latest[channel] = frame;
+    published[channel]++;
+    xSemaphoreGive(lock);
+}
+
+void StreamBroadcaster::release(StreamFrame* frame) {
+    frame->refs--;
+}
+
+bool StreamBroadcaster::publish(int channel, const char* event, uint32_t id, const char* data) {
+    StreamFrame* frame = beginFrame(channel, event, id);
+    if (frame == nullptr) return false;
+
+    size_t length = strlen(data);
+    if (frame->length + length + 4 > sizeof(frame->data)) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        release(frame);
+        xSemaphoreGive(lock);
+        return false;
+    }
+    memcpy(frame->data + frame->length, data, length);
+    frame->length += length;
+    commitFrame(channel, frame);
+    return true;
+}
+
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+bool StreamBroadcaster::publishBinary(int channel, const char* event, uint32_t id,
+                                      const uint8_t* data, size_t length) {
+    StreamFrame* frame = beginFrame(channel, event, id);
+    if (frame == nullptr) return false;
+
+    if (frame->length + (length + 2) / 3 * 4 + 4 > sizeof(frame->data)) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        release(frame);
+        xSemaphoreGive(lock);
+        return false;
+    }
+    char* out = frame->data + frame->length;
+    size_t o = 0;
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t v = data[i] << 16;
+        if (i + 1 < length) v |= data[i + 1] << 8;
+        if (i + 2 < length) v |= data[i + 2];
+        out[o++] = BASE64_CHARS[(v >> 18) & 0x3F];
+        out[o++] = BASE64_CHARS[(v >> 12) & 0x3F];
+        out[o++] = (i + 1 < length) ? BASE64_CHARS[(v >> 6) & 0x3F] : '=';
+        out[o++] = (i + 2 < length) ? BASE64_CHARS[v & 0x3F] : '=';
+    }
+    frame->length += o;
+    commitFrame(channel, frame);
+    return true;
+}
+
+void StreamBroadcaster::pump() {
+    if (lock == nullptr || clientCount == 0) return;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        if (clients[i].tcp != nullptr) pumpClient(clients[i]);
+    }
+    xSemaphoreGive(lock);
+}
+
+// Called with the lock held
+void StreamBroadcaster::pumpClient(Client& client) {
+    bool added = false;
+
+    while (true) {
+        if (client.current == nullptr) {
+            // Next channel with a frame this client has not taken, round-robin
+            int channel = -1;
+            for (int i = 0; i < STREAM_MAX_CHANNELS; i++) {
+                int c = (client.nextChannel + i) % STREAM_MAX_CHANNELS;
+                if (latest[c] != nullptr && client.seen[c] != published[c]) {
+                    channel = c;
+                    break;
+                }
+            }
+            if (channel < 0) break;
+
+            client.dropped += published[channel] - client.seen[channel] - 1;
+            client.seen[channel] = published[channel];
+            client.nextChannel = (channel + 1) % STREAM_MAX_CHANNELS;
+            client.current = latest[channel];
+            client.current->refs++;
+            client.offset = 0;
+        }
+
+        // A full window leaves the frame in flight; newer ones replace
+        // whatever else is pending for this client in the meantime
+        size_t space = client.tcp->space();
+        if (space == 0) break;
+        size_t n = client.current->length - client.offset;
+        if (n > space) n = space;
+        n = client.tcp->add(client.current->data + client.offset, n);
+        if (n == 0) break;
+        added = true;
+
+        client.offset += n;
+        if (client.offset >= client.current->length) {
+            release(client.current);
+            client.current = nullptr;
+            client.sent++;
+        }
+    }
+
+    if (added) client.tcp->send();
+}
+
+int StreamBroadcaster::getClientCount() {
+    return clientCount;
+}
+
+uint32_t StreamBroadcaster::getConnectCount() {
+    return connectCount;
+}
+
+uint32_t StreamBroadcaster::getPublishedCount() {
+    uint32_t total = 0;
+    for (int i = 0; i < STREAM_MAX_CHANNELS; i++) {
+        total += published[i];
+    }
+    return total;
+}
+
+int StreamBroadcaster::getClientStats(StreamClientStats* out, int max) {
+    if (lock == nullptr) return 0;
+
+    int count = 0;
+    unsigned long now = millis();
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (int i = 0; i < STREAM_MAX_CLIENTS && count < max; i++) {
+        Client& client = clients[i];
+        if (client.tcp == nullptr) continue;
+        out[count].sent = client.sent;
+        out[count].dropped = client.dropped;
+        out[count].pendingBytes = (client.current != nullptr) ? client.current->length - client.offset : 0;
+        out[count].connectedMs = now - client.connectedMs;
+        count++;
+    }
+    xSemaphoreGive(lock);
+    return count;
+}
@@ -0,0 +1,83 @@
+#ifndef STREAM_BROADCAST_H
+#define STREAM_BROADCAST_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define STREAM_MAX_CLIENTS   4    // softAP station limit
+#define STREAM_MAX_CHANNELS  4
+#define STREAM_FRAME_MAX_LEN 320  // One serialized SSE message
+// Each channel holds its latest frame and each client at most one frame in
+// flight, plus one being written: publishing never waits for a free frame
+#define STREAM_FRAME_POOL    (STREAM_MAX_CHANNELS + STREAM_MAX_CLIENTS + 1)
+
+// Reference-counted SSE message, serialized once for all clients
+struct StreamFrame {
+    uint8_t refs;
+    uint16_t length;
+    char data[STREAM_FRAME_MAX_LEN];
+};
+
+struct StreamClientStats {
+    uint32_t sent;          // Frames fully handed to TCP
+    uint32_t dropped;       // Frames superseded before this client took them
+    uint32_t pendingBytes;  // Unsent tail of the frame in flight
+    unsigned long connectedMs;
+};
+
+// Server-Sent Events fan-out. Each published message is formatted once
+// into a pooled frame that every client sends from. A channel only keeps
+// its newest frame, so a slow client skips straight to the latest one
+// instead of queueing: memory stays fixed however far behind it falls.
+//
+// publish() and pump() run on the main loop; connects, acks and
+// disconnects arrive on the async TCP task; state is guarded by a mutex.
+class StreamBroadcaster {
+public:
+    StreamBroadcaster();
+    void begin();
+    AsyncWebServerResponse* createResponse();  // For GET on the stream URL
+    void attach(AsyncWebServerRequest* request);  // Takes over the connection
+
+    bool publish(int channel, const char* event, uint32_t id, const char* data);
+    // Same, with binary data base64-encoded (SSE carries text only)
+    bool publishBinary(int channel, const char* event, uint32_t id,
+                       const uint8_t* data, size_t length);
+    void pump();      // Moves pending frames into every client's TCP window
+    void closeAll();
+
+    int getClientCount();
+    uint32_t getConnectCount();   // Bumped by every new client
+    uint32_t getPublishedCount();
+    // Fills stats for up to max connected clients; returns how many
+    int getClientStats(StreamClientStats* out, int max);
+
+private:
+    struct Client {
+        AsyncClient* tcp;
+        StreamFrame* current;
+        size_t offset;
+        uint32_t seen[STREAM_MAX_CHANNELS];  // Channel counts taken so far
+        int nextChannel;
+        uint32_t sent;
+        uint32_t dropped;
+        unsigned long connectedMs;
+    };
+
+    SemaphoreHandle_t lock;
+    StreamFrame pool[STREAM_FRAME_POOL];
+    StreamFrame* latest[STREAM_MAX_CHANNELS];
+    uint32_t published[STREAM_MAX_CHANNELS];
+    Client clients[STREAM_MAX_CLIENTS];
+    int clientCount;
+    volatile uint32_t connectCount;
+
+    StreamFrame* beginFrame(int channel, const char* event, uint32_t id);
+    void commitFrame(int channel, StreamFrame* frame);
+    void release(StreamFrame* frame);
+    Client* findClient(AsyncClient* tcp);
+    void pumpClient(Client& client);
+    void detach(AsyncClient* tcp);
+};
+
+#endif
@@ -1,27 +1,51 @@
 #include "subghz_operations.h"
 #include "WORLD_IR_CODES.h"
+#include "label_cache.h"
+#include "idle_scheduler.h"
+#include "span_trace.h"
+#include "metrics.h"
+#include "replay_fidelity.h"
+#include "spi_profiler.h"
 #include <M5StickCPlus.h>
 #include <IRremoteESP8266.h>
 #include <IRsend.h>
 
 #define IR_PIN 9
 
-SubGhzOperations::SubGhzOperations(CC1101Interface* radio, MenuSystem* menu) {
+SubGhzOperations::SubGhzOperations(CC1101Interface* radio, MenuSystem* menu) : sweepJob(radio) {
     cc1101 = radio;
     menuSystem = menu;
     lastMode = MODE_IDLE;
+    stateVersion = 0;
+    latestRSSI = -100;
+    rssiSampleCount = 0;
+    spectrumVersion = 0;
+    spectrumStart = 0.0;
+    spectrumStep = 0.0;
     lastRSSI = -100;
     lastDisplayedRSSI = -999;  // Force first draw
     scanCounter = 0;
     lastScanUpdate = 0;
     lastSpectrumUpdate = 0;
+    spectrumDirty = false;
     lastListenUpdate = 0;
+    listenRSSI = -100;
+    lastDisplayedListenRSSI = -200;
     signalCount = 0;
+    lastDisplayedSignalCount = -1;
+    lastSignalState = false;
+    rxLength = 0;
+    rxDirty = false;
     forceListenDraw = true;
     lastListenFreq = 0.0;
     recordedSampleCount = 0;
     hasRecording = false;
+    captureId = 0;
+    captureGeneration = 0;
+    recordElapsed = 0;
+    lastDisplayedRecordElapsed = -1;
     isTransmitting = false;
+    replayDirty = true;
     recordStartTime = 0;
 }
 
@@ -39,6 +63,19 @@ void SubGhzOperations::begin() {
 }
 
 void SubGhzOperations::update() {
+    spiProfiler.setMode(menuSystem->getMode());
+    
+    if (sweepJob.isRunning()) {
+        sweepJob.step(SWEEP_SLICE_US);
+        if (!sweepJob.isRunning()) {
+            // Hand the radio back on the frequency the mode expects
+            cc1101->setFrequency(menuSystem->getSelectedFrequency());
+            lastListenFreq = 0.0;
+            stateVersion++;
+        }
+        return;
+    }
+    
     OperationMode mode = menuSystem->getMode();
     
     // Reset display state when mode changes
@@ -53,6 +90,8 @@ void SubGhzOperations::update() {
         } else if (mode == MODE_LISTENING) {
             signalCount = 0;  // Reset signal counter
             forceListenDraw = true;  // Force initial draw
+            lastSignalState = false;
+            rxDirty = false;
             lastListenUpdate = 0;  // Force immediate update
             lastListenFreq = 0.0;  // Reset frequency to force detection
         } else if (mode == MODE_SPECTRUM) {
@@ -60,8 +99,13 @@ void SubGhzOperations::update() {
             for (int i = 0; i < SPECTRUM_POINTS; i++) {
                 spectrumData[i] = -100;
             }
+        } else if (mode == MODE_RECORDING) {
+            lastDisplayedRecordElapsed = -1;
+        } else if (mode == MODE_REPLAYING) {
+            replayDirty = true;
         }
         lastMode = mode;
+        stateVersion++;
     }
     
     switch (mode) {
@@ -85,6 +129,166 @@ void SubGhzOperations::update() {
     }
 }
 
+void SubGhzOperations::render() {
+    switch (menuSystem->getMode()) {
+        case MODE_SCANNING:
+            renderScan();
+            break;
+        case MODE_SPECTRUM:
+            renderSpectrum();
+            break;
+        case MODE_LISTENING:
+            renderListen();
+            break;
+        case MODE_RECORDING:
+            renderRecord();
+            break;
+        case MODE_REPLAYING:
+            renderReplay();
+            break;
+        default:
+            break;
+    }
+}
+
+uint32_t SubGhzOperations::getStateVersion() {
+    return stateVersion;
+}
+
+int SubGhzOperations::getLatestRSSI() {
+    return latestRSSI;
+}
+
+uint32_t SubGhzOperations::getRSSISampleCount() {
+    return rssiSampleCount;
+}
+
+int SubGhzOperations::copyRSSISamples(uint32_t since, int* out, int max) {
+    uint32_t available = rssiSampleCount - since;
+    if (available > RSSI_RING_SIZE) available = RSSI_RING_SIZE;
+    if (available > (uint32_t)max) available = max;
+    
+    uint32_t first = rssiSampleCount - available;
+    for (uint32_t i = 0; i < available; i++) {
+        out[i] = recentRSSI[(first + i) % RSSI_RING_SIZE];
+    }
+    return available;
+}
+
+void SubGhzOperations::publishRSSI(int rssi) {
+    latestRSSI = rssi;
+    recentRSSI[rssiSampleCount % RSSI_RING_SIZE] = rssi;
+    rssiSampleCount++;
+}
+
+bool SubGhzOperations::hasCapture() {
+    return hasRecording;
+}
+
+uint32_t SubGhzOperations::getCaptureId() {
+    return captureId;
+}
+
+uint32_t SubGhzOperations::getCaptureGeneration() {
+    return captureGeneration;
+}
+
+int SubGhzOperations::getCaptureSampleCount() {
+    return recordedSampleCount;
+}
+
+const int* SubGhzOperations::getCaptureTimings() {
+    return recordedTimings;
+}
+
+bool SubGhzOperations::loadCapture(const int* timings, int count) {
+    if (count <= 0 || count > MAX_RECORDING_SAMPLES) return false;
+    
+    captureGeneration++;
+    memcpy(recordedTimings, timings, count * sizeof(int));
+    if (count < MAX_RECORDING_SAMPLES) {
+        recordedTimings[count] = 0;  // Terminator, as after a capture
+    }
+    recordedSampleCount = count;
+    captureId++;
+    captureGeneration++;
+    
+    hasRecording = true;
+    replayDirty = true;
+    stateVersion++;
+    return true;
+}
+
+RadioConfigError SubGhzOperations::tune(const RadioConfig& requested, RadioConfig* actual) {
+    RadioConfigError error = cc1101->applyConfig(requested, actual);
+    if (error == RADIO_CONFIG_OK) {
+        menuSystem->setFrequency(actual->frequency);
+        stateVersion++;
+    }
+    return error;
+}
+
+const RadioConfig& SubGhzOperations::getRadioConfig() {
+    return cc1101->getConfig();
+}
+
+bool SubGhzOperations::startSweep(uint32_t id, const SweepParams& params) {
+    return sweepJob.start(id, params);
+}
+
+void SubGhzOperations::cancelSweep(uint32_t id) {
+    if (sweepJob.getId() != id || !sweepJob.isRunning()) return;
+    sweepJob.cancel();
+    cc1101->setFrequency(menuSystem->getSelectedFrequency());
+    lastListenFreq = 0.0;
+    stateVersion++;
+}
+
+SweepJob& SubGhzOperations::getSweep() {
+    return sweepJob;
+}
+
+uint32_t SubGhzOperations::getSpectrumVersion() {
+    return spectrumVersion;
+}
+
+const int* SubGhzOperations::getSpectrumData() {
+    return spectrumData;
+}
+
+float SubGhzOperations::getSpectrumStart() {
+    return spectrumStart;
+}
+
+float SubGhzOperations::getSpectrumStep() {
+    return spectrumStep;
+}
+
+// Updates run once more than interval ms have passed since the last one
+static unsigned long timeUntilDue(unsigned long last, unsigned long interval) {
+    unsigned long elapsed = millis() - last;
+    return (elapsed > interval) ? 0 : interval - elapsed + 1;
+}
+
+unsigned long SubGhzOperations::getTimeUntilNextUpdate() {
+    if (sweepJob.isRunning()) return 0;
+    
+    switch (menuSystem->getMode()) {
+        case MODE_SCANNING:
+            return timeUntilDue(lastScanUpdate, 100);
+        case MODE_SPECTRUM:
+            return timeUntilDue(lastSpectrumUpdate, 500);
+        case MODE_LISTENING:
+            return timeUntilDue(lastListenUpdate, 50);
+        case MODE_RECORDING:
+            // Waiting for a signal polls RSSI continuously
+            return hasRecording ? NO_UPDATE_DUE : 0;
+        default:
+            // Replay and idle only react to buttons
+            return NO_UPDATE_DUE;
+    }
+}
+
 void SubGhzOperations::updateScan() {
     if (millis() - lastScanUpdate > 100) {
         // Set frequency and get real RSSI
@@ -92,29 +296,34 @@ void SubGhzOperations::updateScan() {
         cc1101->setRxMode();
         int rssi = cc1101->getRSSI();
         lastRSSI = rssi;
+        publishRSSI(rssi);
         
         // Add to history buffer
         rssiHistory[historyIndex] = rssi;
         historyIndex = (historyIndex + 1) % 120;
         
-        // Update RSSI display only if value changed significantly (±2 dBm)
-        // Draw below frequency text (y=32) and above waveform (y=52)
-        if (abs(rssi - lastDisplayedRSSI) >= 2) {
-            M5.Lcd.fillRect(10, 42, 220, 8, BLACK);  // Clear the text area
-            M5.Lcd.setCursor(10, 42);
-            M5.Lcd.setTextSize(1);
-            M5.Lcd.setTextColor(GREEN, BLACK);
-            M5.Lcd.printf("RSSI: %d dBm", rssi);
-            lastDisplayedRSSI = rssi;
-        }
-        
-        // Draw only the newest waveform segment (incremental drawing)
-        drawRSSIWaveform();
-        
+        stateVersion++;
         lastScanUpdate = millis();
     }
 }
 
+void SubGhzOperations::renderScan() {
+    // Update RSSI display only if value changed significantly (±2 dBm)
+    // Draw below frequency text (y=32) and above waveform (y=52)
+    if (abs(lastRSSI - lastDisplayedRSSI) >= 2) {
+        M5.Lcd.fillRect(10, 42, 220, 8, BLACK);  // Clear the text area
+        int x = labelCache.draw(10, 42, "RSSI: ", GREEN, BLACK);
+        M5.Lcd.setCursor(x, 42);
+        M5.Lcd.setTextSize(1);
+        M5.Lcd.setTextColor(GREEN, BLACK);
+        M5.Lcd.printf("%d dBm", lastRSSI);
+        lastDisplayedRSSI = lastRSSI;
+    }
+    
+    // Draw only the newest waveform segment (incremental drawing)
+    drawRSSIWaveform();
+}
+
 void SubGhzOperations::updateSpectrum() {
     if (millis() - lastSpectrumUpdate > 500) {
         float baseFreq = menuSystem->getSelectedFrequency();
@@ -124,15 +333,25 @@ void SubGhzOperations::updateSpectrum() {
         
         // Scan spectrum with real CC1101
         cc1101->scanSpectrum(startFreq, endFreq, step, spectrumData, SPECTRUM_POINTS);
+        spectrumDirty = true;
+        spectrumStart = startFreq;
+        spectrumStep = step;
+        spectrumVersion++;
         
-        // Draw spectrum
-        drawSpectrum();
-        
+        stateVersion++;
         lastSpectrumUpdate = millis();
     }
 }
 
+void SubGhzOperations::renderSpectrum() {
+    if (spectrumDirty) {
+        drawSpectrum();
+        spectrumDirty = false;
+    }
+}
+
 void SubGhzOperations::drawSpectrum() {
+    TRACE_SPAN("lcd", "drawSpectrum");
     // Clear spectrum graph area only (below text labels, above controls)
     // Text ends at line 45 (+ ~8 pixels = 53), controls start at 120
     M5.Lcd.fillRect(0, 56, 240, 60, BLACK);
@@ -156,81 +375,83 @@ void SubGhzOperations::drawSpectrum() {
 
 void SubGhzOperations::updateListen() {
     if (millis() - lastListenUpdate > 50) {
-        static int lastDisplayedListenRSSI = -200;  // Force first draw
-        static int lastSignalCount = -1;  // Force first draw
-        static bool lastSignalState = false;  // Track signal transitions
-        
-        // Reset static variables when forceListenDraw is set (mode entry or freq change)
-        if (forceListenDraw) {
-            lastDisplayedListenRSSI = -200;
-            lastSignalCount = -1;
-            lastSignalState = false;
-        }
-        
         // Check if frequency changed
         float currentFreq = menuSystem->getSelectedFrequency();
         if (currentFreq != lastListenFreq) {
             forceListenDraw = true;
+            lastSignalState = false;
             lastListenFreq = currentFreq;
-            lastDisplayedListenRSSI = -200;  // Force RSSI redraw
         }
         
         // Set frequency and RX mode
         cc1101->setFrequency(currentFreq);
         cc1101->setRxMode();
         delay(10);  // Allow CC1101 to stabilize
-        int rssi = cc1101->getRSSI();
-        
-        // Update RSSI display if changed by ±2 dBm or forced draw
-        if (forceListenDraw || abs(rssi - lastDisplayedListenRSSI) >= 2) {
-            M5.Lcd.fillRect(10, 55, 220, 10, BLACK);
-            M5.Lcd.setCursor(10, 55);
-            M5.Lcd.setTextSize(1);
-            M5.Lcd.setTextColor(WHITE, BLACK);
-            M5.Lcd.printf("RSSI: %d dBm", rssi);
-            lastDisplayedListenRSSI = rssi;
-            
-            displaySignalStrength(rssi);
-            
-            // If forced draw, also show signal counter
-            if (forceListenDraw) {
-                M5.Lcd.fillRect(10, 68, 220, 10, BLACK);
-                M5.Lcd.setCursor(10, 68);
-                M5.Lcd.setTextColor(GREEN, BLACK);
-                M5.Lcd.printf("Signals: %d", signalCount);
-                lastSignalCount = signalCount;
-            }
-            
-            forceListenDraw = false;
-        }
+        listenRSSI = cc1101->getRSSI();
+        publishRSSI(listenRSSI);
         
         // Check for real signal detection - only count on transition (not continuously)
         bool currentSignalState = cc1101->signalDetected();
         if (currentSignalState && !lastSignalState) {
             // Signal just appeared (rising edge)
             signalCount++;
-            if (signalCount != lastSignalCount) {
-                M5.Lcd.fillRect(10, 68, 220, 10, BLACK);
-                M5.Lcd.setCursor(10, 68);
-                M5.Lcd.setTextColor(GREEN, BLACK);
-                M5.Lcd.printf("Signals: %d", signalCount);
-                lastSignalCount = signalCount;
-            }
             
             // Try to receive data
             int len = cc1101->receiveData(rxBuffer, sizeof(rxBuffer));
             if (len > 0) {
-                M5.Lcd.fillRect(10, 81, 220, 10, BLACK);
-                M5.Lcd.setCursor(10, 81);
-                M5.Lcd.printf("RX: %d bytes", len);
+                rxLength = len;
+                rxDirty = true;
+            } else {
+                metrics.count(METRIC_FALSE_TRIGGERS);
             }
         }
         lastSignalState = currentSignalState;
         
+        stateVersion++;
         lastListenUpdate = millis();
     }
 }
 
+void SubGhzOperations::renderListen() {
+    // Mode entry or frequency change redraws everything
+    if (forceListenDraw) {
+        lastDisplayedListenRSSI = -200;
+        lastDisplayedSignalCount = -1;
+    }
+    
+    // Update RSSI display if changed by ±2 dBm or forced draw
+    if (abs(listenRSSI - lastDisplayedListenRSSI) >= 2) {
+        M5.Lcd.fillRect(10, 55, 220, 10, BLACK);
+        int x = labelCache.draw(10, 55, "RSSI: ", WHITE, BLACK);
+        M5.Lcd.setCursor(x, 55);
+        M5.Lcd.setTextSize(1);
+        M5.Lcd.setTextColor(WHITE, BLACK);
+        M5.Lcd.printf("%d dBm", listenRSSI);
+        lastDisplayedListenRSSI = listenRSSI;
+        
+        displaySignalStrength(listenRSSI);
+    }
+    
+    if (signalCount != lastDisplayedSignalCount) {
+        M5.Lcd.fillRect(10, 68, 220, 10, BLACK);
+        int x = labelCache.draw(10, 68, "Signals: ", GREEN, BLACK);
+        M5.Lcd.setCursor(x, 68);
+        M5.Lcd.setTextColor(GREEN, BLACK);
+        M5.Lcd.printf("%d", signalCount);
+        lastDisplayedSignalCount = signalCount;
+    }
+    
+    if (rxDirty) {
+        M5.Lcd.fillRect(10, 81, 220, 10, BLACK);
+        M5.Lcd.setCursor(10, 81);
+        M5.Lcd.setTextColor(GREEN, BLACK);
+        M5.Lcd.printf("RX: %d bytes", rxLength);
+        rxDirty = false;
+    }
+    
+    forceListenDraw = false;
+}
+
 void SubGhzOperations::updateRecord() {
     if (!hasRecording) {
         // Set frequency and RX mode
@@ -239,13 +460,14 @@ void SubGhzOperations::updateRecord() {
         
         // Check if signal detected
         if (cc1101->signalDetected()) {
+            // Capture blocks, so progress is drawn here rather than in render()
             M5.Lcd.fillRect(10, 80, 220, 20, BLACK);
-            M5.Lcd.setCursor(10, 80);
-            M5.Lcd.setTextColor(YELLOW, BLACK);
-            M5.Lcd.println("Recording...");
+            labelCache.draw(10, 80, "Recording...", YELLOW, BLACK);
             
             // Record signal
-            if (cc1101->recordSignal(recordedTimings, MAX_RECORDING_SAMPLES)) {
+            captureGeneration++;
+            bool captured = cc1101->recordSignal(recordedTimings, MAX_RECORDING_SAMPLES);
+            if (captured) {
                 recordedSampleCount = 0;
                 for (int i = 0; i < MAX_RECORDING_SAMPLES; i++) {
                     if (recordedTimings[i] > 0) {
@@ -254,7 +476,13 @@ void SubGhzOperations::updateRecord() {
                         break;
                     }
                 }
-                
+                captureId++;
+            } else {
+                metrics.count(METRIC_FALSE_TRIGGERS);
+            }
+            captureGeneration++;
+            
+            if (captured) {
                 hasRecording = true;
                 
                 M5.Lcd.fillRect(10, 80, 220, 30, BLACK);
@@ -267,18 +495,19 @@ void SubGhzOperations::updateRecord() {
                 delay(1000);
                 menuSystem->setMode(MODE_REPLAYING);
             }
+            lastDisplayedRecordElapsed = -1;
         }
         
-        // Show timeout
+        // Track timeout
         if (recordStartTime == 0) {
             recordStartTime = millis();
         }
         
         unsigned long elapsed = (millis() - recordStartTime) / 1000;
-        M5.Lcd.fillRect(10, 80, 220, 15, BLACK);
-        M5.Lcd.setCursor(10, 80);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        M5.Lcd.printf("Timeout: %d/30s", elapsed);
+        if ((int)elapsed != recordElapsed) {
+            recordElapsed = elapsed;
+            stateVersion++;
+        }
         
         if (elapsed >= 30) {
             recordStartTime = 0;
@@ -287,48 +516,67 @@ void SubGhzOperations::updateRecord() {
     }
 }
 
+void SubGhzOperations::renderRecord() {
+    if (hasRecording || recordElapsed == lastDisplayedRecordElapsed) return;
+    
+    M5.Lcd.fillRect(10, 80, 220, 15, BLACK);
+    M5.Lcd.setCursor(10, 80);
+    M5.Lcd.setTextSize(1);
+    M5.Lcd.setTextColor(WHITE, BLACK);
+    M5.Lcd.printf("Timeout: %d/30s", recordElapsed);
+    lastDisplayedRecordElapsed = recordElapsed;
+}
+
 void SubGhzOperations::updateReplay() {
-    if (!isTransmitting) {
+    // Check if button A pressed to transmit
+    if (!isTransmitting && hasRecording && M5.BtnA.wasPressed()) {
+        isTransmitting = true;
+        
+        // Transmission blocks, so status is drawn here rather than in render()
         M5.Lcd.fillRect(10, 60, 220, 40, BLACK);
-        M5.Lcd.setCursor(10, 60);
-        M5.Lcd.setTextSize(1);
-        M5.Lcd.setTextColor(WHITE, BLACK);
+        labelCache.draw(10, 60, "TRANSMITTING!", RED, BLACK);
         
-        if (hasRecording) {
-            M5.Lcd.printf("Ready to replay");
-            M5.Lcd.setCursor(10, 75);
-            M5.Lcd.printf("%d samples", recordedSampleCount);
-            
-            // Check if button A pressed to transmit
-            if (M5.BtnA.wasPressed()) {
-                isTransmitting = true;
-                
-                M5.Lcd.fillRect(10, 60, 220, 40, BLACK);
-                M5.Lcd.setCursor(10, 60);
-                M5.Lcd.setTextColor(RED, BLACK);
-                M5.Lcd.println("TRANSMITTING!");
-                
-                // Set frequency and replay signal
-                cc1101->setFrequency(menuSystem->getSelectedFrequency());
-                cc1101->replaySignal(recordedTimings, recordedSampleCount);
-                
-                delay(500);
-                
-                M5.Lcd.fillRect(10, 60, 220, 40, BLACK);
-                M5.Lcd.setCursor(10, 60);
-                M5.Lcd.setTextColor(GREEN, BLACK);
-                M5.Lcd.println("Transmitted!");
-                
-                isTransmitting = false;
-            }
-        } else {
-            M5.Lcd.setTextColor(RED, BLACK);
-            M5.Lcd.println("No recording!");
-            M5.Lcd.setCursor(10, 75);
-            M5.Lcd.setTextColor(YELLOW, BLACK);
-            M5.Lcd.println("Record signal first");
+        // Set frequency and replay signal
+        cc1101->setFrequency(menuSystem->getSelectedFrequency());
+        cc1101->replaySignal(recordedTimings, recordedSampleCount);
+        
+        delay(500);
+        
+        M5.Lcd.fillRect(10, 60, 220, 40, BLACK);
+        labelCache.draw(10, 60, "Transmitted!", GREEN, BLACK);
+        
+        isTransmitting = false;
+        replayDirty = true;
+        stateVersion++;
+    }
+}
+
+void SubGhzOperations::renderReplay() {
+    if (isTransmitting || !replayDirty) return;
+    
+    M5.Lcd.fillRect(10, 60, 220, 40, BLACK);
+    M5.Lcd.setCursor(10, 60);
+    M5.Lcd.setTextSize(1);
+    M5.Lcd.setTextColor(WHITE, BLACK);
+    
+    if (hasRecording) {
+        M5.Lcd.printf("Ready to replay");
+        M5.Lcd.setCursor(10, 75);
+        M5.Lcd.printf("%d samples", recordedSampleCount);
+        
+        // Last transmission's timing error (REPLAY_VERIFY builds)
+        if (replayFidelity.hasResult()) {
+            const FidelityStats& fidelity = replayFidelity.getOverall();
+            M5.Lcd.setCursor(10, 90);
+            M5.Lcd.setTextColor(DARKGREY, BLACK);
+            M5.Lcd.printf("Err %+.1f/%dus jit %.1fus", fidelity.meanErrUs, fidelity.maxAbsErrUs, fidelity.jitterUs);
         }
+    } else {
+        M5.Lcd.setTextColor(RED, BLACK);
+        M5.Lcd.println("No recording!");
+        labelCache.draw(10, 75, "Record signal first", YELLOW, BLACK);
     }
+    replayDirty = false;
 }
 
 void SubGhzOperations::drawRSSIWaveform() {
@@ -340,6 +588,7 @@ void SubGhzOperations::drawRSSIWaveform() {
     if (historyIndex % 2 != 0) return;
     if (lastDrawIndex == historyIndex) return;
     lastDrawIndex = historyIndex;
+    TRACE_SPAN("lcd", "drawRSSIWaveform");
     
     // Chart area: below freq text (ends ~y=48), above controls (start y=110)
     int chartTop = 52;
@@ -413,14 +662,10 @@ void SubGhzOperations::runTeslaChargePortHack() {
     
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(2);
-    M5.Lcd.setCursor(10, 10);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("TESLA HACK");
+    labelCache.draw(10, 10, "TESLA HACK", RED, BLACK, 2);
     
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 40);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Transmitting at 315MHz...");
+    labelCache.draw(10, 40, "Transmitting at 315MHz...", WHITE, BLACK);
     
     // Tesla signal sequence (from TeslaTaunter project)
     const uint8_t sequence[] = { 
@@ -443,9 +688,7 @@ void SubGhzOperations::runTeslaChargePortHack() {
     pinMode(cc1101->getGDO0Pin(), OUTPUT);
     digitalWrite(cc1101->getGDO0Pin(), LOW);
     
-    M5.Lcd.setCursor(10, 60);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("Sending signal...");
+    labelCache.draw(10, 60, "Sending signal...", YELLOW, BLACK);
     
     // Start TX mode
     cc1101->setTxMode();
@@ -475,17 +718,11 @@ void SubGhzOperations::runTeslaChargePortHack() {
     pinMode(cc1101->getGDO0Pin(), INPUT);
     
     M5.Lcd.fillRect(10, 60, 220, 10, BLACK);
-    M5.Lcd.setCursor(10, 60);
-    M5.Lcd.setTextColor(GREEN, BLACK);
-    M5.Lcd.println("Transmission complete!");
+    labelCache.draw(10, 60, "Transmission complete!", GREEN, BLACK);
     
-    M5.Lcd.setCursor(10, 80);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Check nearby Teslas");
+    labelCache.draw(10, 80, "Check nearby Teslas", WHITE, BLACK);
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("A: Again  B: Back");
+    labelCache.draw(10, 120, "A: Again  B: Back", YELLOW, BLACK);
     
     // Return to idle
     cc1101->setIdleMode();
@@ -505,7 +742,7 @@ void SubGhzOperations::runTeslaChargePortHack() {
             menuSystem->draw();
             return;
         }
-        delay(20);
+        idleScheduler.idle(20);
     }
 }
 
@@ -515,22 +752,14 @@ void SubGhzOperations::runGarageDoorBruteForce() {
     
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(2);
-    M5.Lcd.setCursor(10, 10);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("GARAGE BF");
+    labelCache.draw(10, 10, "GARAGE BF", RED, BLACK, 2);
     
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 35);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Fixed-code brute force");
-    M5.Lcd.setCursor(10, 45);
-    M5.Lcd.println("Freq: 433.92 MHz");
+    labelCache.draw(10, 35, "Fixed-code brute force", WHITE, BLACK);
+    labelCache.draw(10, 45, "Freq: 433.92 MHz", WHITE, BLACK);
     
-    M5.Lcd.setCursor(10, 65);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("A: 8-bit  B: Back");
-    M5.Lcd.setCursor(10, 75);
-    M5.Lcd.println("PWR: 12-bit");
+    labelCache.draw(10, 65, "A: 8-bit  B: Back", YELLOW, BLACK);
+    labelCache.draw(10, 75, "PWR: 12-bit", YELLOW, BLACK);
     
     // Wait for user selection
     while (true) {
@@ -553,7 +782,7 @@ void SubGhzOperations::runGarageDoorBruteForce() {
             return;
         }
         
-        delay(20);
+        idleScheduler.idle(20);
     }
 }
 
@@ -565,9 +794,7 @@ void SubGhzOperations::bruteForceGarageCodes(int bits) {
     M5.Lcd.printf("%d-BIT BF", bits);
     
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(10, 35);
-    M5.Lcd.setTextColor(WHITE, BLACK);
-    M5.Lcd.println("Transmitting codes...");
+    labelCache.draw(10, 35, "Transmitting codes...", WHITE, BLACK);
     
     // Configure CC1101 for 433.92MHz OOK
     cc1101->setFrequency(433.92);
@@ -584,9 +811,7 @@ void SubGhzOperations::bruteForceGarageCodes(int bits) {
     M5.Lcd.setTextColor(YELLOW, BLACK);
     M5.Lcd.printf("Total: %d codes", maxCodes);
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("B: Stop");
+    labelCache.draw(10, 120, "B: Stop", RED, BLACK);
     
     cc1101->setTxMode();
     
@@ -658,9 +883,7 @@ void SubGhzOperations::bruteForceGarageCodes(int bits) {
         M5.Lcd.printf("All %d codes sent", maxCodes);
     }
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("B: Back");
+    labelCache.draw(10, 120, "B: Back", YELLOW, BLACK);
     
     while (true) {
         M5.update();
@@ -670,7 +893,7 @@ void SubGhzOperations::bruteForceGarageCodes(int bits) {
             menuSystem->draw();
             return;
         }
-        delay(20);
+        idleScheduler.idle(20);
     }
 }
 
@@ -734,7 +957,7 @@ void SubGhzOperations::runHamptonBayFanBruteForce() {
         if (M5.BtnB.wasPressed()) {
             break;
         }
-        delay(10);
+        idleScheduler.idle(10);
     }
 }
 
@@ -764,13 +987,9 @@ void SubGhzOperations::bruteForceHamptonBay() {
     
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(1);
-    M5.Lcd.setCursor(5, 5);
-    M5.Lcd.setTextColor(YELLOW, BLACK);
-    M5.Lcd.println("Hampton Bay Brute Force");
+    labelCache.draw(5, 5, "Hampton Bay Brute Force", YELLOW, BLACK);
     
-    M5.Lcd.setCursor(5, 120);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("B: Stop");
+    labelCache.draw(5, 120, "B: Stop", RED, BLACK);
     
     int totalCmds = 16 * 4 * numFreqs;  // 16 IDs x 4 commands x 3 frequencies
     int cmdCount = 0;
@@ -790,10 +1009,8 @@ void SubGhzOperations::bruteForceHamptonBay() {
             M5.update();
             if (M5.BtnB.wasPressed()) {
                 M5.Lcd.fillRect(0, 110, 240, 10, BLACK);
-                M5.Lcd.setCursor(5, 110);
-                M5.Lcd.setTextColor(RED, BLACK);
-                M5.Lcd.println("STOPPED");
-                delay(1000);
+                labelCache.draw(5, 110, "STOPPED", RED, BLACK);
+                idleScheduler.hold(1000);
                 return;
             }
             
@@ -816,10 +1033,8 @@ void SubGhzOperations::bruteForceHamptonBay() {
                 M5.update();
                 if (M5.BtnB.wasPressed()) {
                     M5.Lcd.fillRect(0, 110, 240, 10, BLACK);
-                    M5.Lcd.setCursor(5, 110);
-                    M5.Lcd.setTextColor(RED, BLACK);
-                    M5.Lcd.println("STOPPED");
-                    delay(1000);
+                    labelCache.draw(5, 110, "STOPPED", RED, BLACK);
+                    idleScheduler.hold(1000);
                     return;
                 }
                 
@@ -864,7 +1079,7 @@ void SubGhzOperations::bruteForceHamptonBay() {
             menuSystem->draw();
             break;
         }
-        delay(10);
+        idleScheduler.idle(10);
     }
 }
 
@@ -953,9 +1168,7 @@ uint8_t read_bits(uint8_t count) {
 void SubGhzOperations::runTVBGone() {
     M5.Lcd.fillScreen(BLACK);
     M5.Lcd.setTextSize(2);
-    M5.Lcd.setCursor(10, 10);
-    M5.Lcd.setTextColor(ORANGE, BLACK);
-    M5.Lcd.println("TV-B-Gone");
+    labelCache.draw(10, 10, "TV-B-Gone", ORANGE, BLACK, 2);
     
     M5.Lcd.setTextSize(1);
     M5.Lcd.setCursor(10, 40);
@@ -964,9 +1177,7 @@ void SubGhzOperations::runTVBGone() {
     M5.Lcd.setCursor(10, 52);
     M5.Lcd.println("Point at TV...");
     
-    M5.Lcd.setCursor(10, 120);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("B: Stop");
+    labelCache.draw(10, 120, "B: Stop", RED, BLACK);
     
     // Initialize IR sender
     IRsend irsend(IR_PIN);
@@ -1033,7 +1244,7 @@ void SubGhzOperations::runTVBGone() {
         M5.Lcd.println("Complete!");
     }
     
-    delay(2000);
+    idleScheduler.hold(2000);
     
     // Reset screen state and force menu redraw
     M5.Lcd.fillScreen(BLACK);
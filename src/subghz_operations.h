@@ -4,27 +4,75 @@
 #include <Arduino.h>
 #include "cc1101_interface.h"
 #include "menu_system.h"
+#include "sweep_job.h"
 
 #define SPECTRUM_POINTS 120  // Number of points for spectrum display
 #define MAX_RECORDING_SAMPLES 512
+#define NO_UPDATE_DUE 0xFFFFFFFFUL  // Mode has no periodic radio work
+#define RSSI_RING_SIZE 32  // Recent scan/listen samples kept for remote clients
 
 class SubGhzOperations {
 public:
     SubGhzOperations(CC1101Interface* radio, MenuSystem* menu);
     void begin();
-    void update();
+    void update();   // Radio work for the current mode, publishes new state
+    void render();   // Draw the latest published state (driven by UIScheduler)
+    uint32_t getStateVersion();
+    
+    // Latest published samples, for remote clients
+    int getLatestRSSI();           // Most recent scan/listen RSSI (dBm)
+    uint32_t getRSSISampleCount(); // Total scan/listen samples taken
+    // Copies up to max samples taken after sample number since, oldest
+    // first; returns how many were copied
+    int copyRSSISamples(uint32_t since, int* out, int max);
+    uint32_t getSpectrumVersion(); // Bumped after each completed sweep
+    const int* getSpectrumData();  // SPECTRUM_POINTS bins (dBm)
+    float getSpectrumStart();      // MHz of bin 0
+    float getSpectrumStep();       // MHz between bins
+    
+    // Capture buffer, for remote download. The generation is odd while the
+    // buffer is being written, so readers on other tasks can detect tearing
+    bool hasCapture();
+    uint32_t getCaptureId();       // Bumped for each completed capture
+    uint32_t getCaptureGeneration();
+    int getCaptureSampleCount();
+    const int* getCaptureTimings();
+    // Replaces the capture with externally supplied timings (e.g. an
+    // upload), ready for replay; false if count is out of range
+    bool loadCapture(const int* timings, int count);
+    
+    // Retunes the radio (see CC1101Interface::applyConfig) and makes the
+    // frequency the selected one, so every mode keeps using it
+    RadioConfigError tune(const RadioConfig& requested, RadioConfig* actual);
+    const RadioConfig& getRadioConfig();
+    
+    // Remote survey (see SweepJob). While it runs it owns the radio and the
+    // current mode's radio work is paused; a new job replaces a running one
+    bool startSweep(uint32_t id, const SweepParams& params);
+    void cancelSweep(uint32_t id);
+    SweepJob& getSweep();
+    unsigned long getTimeUntilNextUpdate();  // ms until radio work is due
     void runTeslaChargePortHack();
     void runGarageDoorBruteForce();
     void runHamptonBayFanBruteForce();
     void runTVBGone();
     
 private:
+    friend class HostProbe;  // host/ tools drive and inspect internals directly
+    
     CC1101Interface* cc1101;
     MenuSystem* menuSystem;
     OperationMode lastMode;
+    uint32_t stateVersion;  // Bumped whenever render() has something new to draw
+    int latestRSSI;
+    int recentRSSI[RSSI_RING_SIZE];
+    uint32_t rssiSampleCount;
+    void publishRSSI(int rssi);
+    SweepJob sweepJob;
     
     // Scan mode
     void updateScan();
+    void renderScan();
     int lastRSSI;
     int lastDisplayedRSSI;
     int scanCounter;
@@ -35,28 +83,47 @@ private:
     
     // Spectrum analyzer
     void updateSpectrum();
+    void renderSpectrum();
     int spectrumData[SPECTRUM_POINTS];
     unsigned long lastSpectrumUpdate;
+    bool spectrumDirty;
+    uint32_t spectrumVersion;
+    float spectrumStart;
+    float spectrumStep;
     void drawSpectrum();
     
     // Listen mode
     void updateListen();
+    void renderListen();
     byte rxBuffer[64];
     unsigned long lastListenUpdate;
+    int listenRSSI;
+    int lastDisplayedListenRSSI;
     int signalCount;
+    int lastDisplayedSignalCount;
+    bool lastSignalState;
+    int rxLength;
+    bool rxDirty;
     bool forceListenDraw;
     float lastListenFreq;
     
     // Recording
     void updateRecord();
+    void renderRecord();
     int recordedTimings[MAX_RECORDING_SAMPLES];
     int recordedSampleCount;
     bool hasRecording;
+    uint32_t captureId;
+    volatile uint32_t captureGeneration;
     unsigned long recordStartTime;
+    int recordElapsed;
+    int lastDisplayedRecordElapsed;
     
     // Replay
     void updateReplay();
+    void renderReplay();
     bool isTransmitting;
+    bool replayDirty;
     
     // Helper functions
     void displayRSSI(int rssi, int x, int y);
@@ -0,0 +1,146 @@
+#include "sweep_job.h"
+#include "spectrum_frame.h"
+#include "span_trace.h"
+
+SweepJob::SweepJob(CC1101Interface* radio) {
+    cc1101 = radio;
+    id = 0;
+    state = SWEEP_IDLE;
+    params.startMHz = 0;
+    params.stopMHz = 0;
+    params.stepMHz = 0;
+    params.passes = 0;
+    params.aggregate = SWEEP_AGG_MAX;
+    points = 0;
+    pass = 0;
+    index = 0;
+    startMs = 0;
+    endMs = 0;
+}
+
+int SweepJob::pointCount(const SweepParams& params) {
+    if (!(params.stepMHz > 0)) return 0;
+    return (int)((params.stopMHz - params.startMHz) / params.stepMHz + 1.0001);
+}
+
+const char* SweepJob::validate(const SweepParams& params) {
+    if (!(params.stopMHz > params.startMHz)) return "stop must be above start";
+    // Steps arrive as floats, so 0.01 itself must not round below the limit
+    if (!(params.stepMHz >= SWEEP_MIN_STEP * 0.999)) return "step must be at least 0.01 MHz";
+    if (params.passes < 1 || params.passes > SWEEP_MAX_PASSES) return "passes must be 1-1000";
+
+    // The synthesizer cannot cross the gaps between the CC1101 bands
+    if (!CC1101Interface::isInBand(params.startMHz) || !CC1101Interface::isInBand(params.stopMHz)) {
+        return "start and stop must be in 300-348, 387-464 or 779-928 MHz";
+    }
+    for (float f = params.startMHz; f < params.stopMHz; f += 1.0) {
+        if (!CC1101Interface::isInBand(f)) return "range crosses a gap between bands";
+    }
+    if (pointCount(params) > SWEEP_MAX_POINTS) return "too many points (max 1024)";
+    return nullptr;
+}
+
+bool SweepJob::start(uint32_t id, const SweepParams& params) {
+    if (validate(params) != nullptr) return false;
+
+    this->id = id;
+    this->params = params;
+    points = pointCount(params);
+    pass = 0;
+    index = 0;
+    int initial = (params.aggregate == SWEEP_AGG_MAX) ? -128 : 0;
+    for (int i = 0; i < points; i++) {
+        bins[i] = initial;
+    }
+    startMs = millis();
+    endMs = 0;
+    state = SWEEP_RUNNING;
+
+    cc1101->setRxMode();
+    return true;
+}
+
+void SweepJob::cancel() {
+    if (state != SWEEP_RUNNING) return;
+    state = SWEEP_CANCELLED;
+    endMs = millis();
+}
+
+void SweepJob::step(unsigned long budgetUs) {
+    if (state != SWEEP_RUNNING) return;
+    TRACE_SPAN("radio", "sweepStep");
+
+    unsigned long start = micros();
+    while (micros() - start < budgetUs) {
+        cc1101->setFrequency(params.startMHz + index * params.stepMHz);
+        delayMicroseconds(SWEEP_SETTLE_US);
+        int rssi = cc1101->getRSSI();
+
+        if (params.aggregate == SWEEP_AGG_MAX) {
+            if (rssi > bins[index]) bins[index] = rssi;
+        } else {
+            bins[index] += rssi;
+        }
+
+        if (++index >= points) {
+            index = 0;
+            if (++pass >= params.passes) {
+                finish();
+                return;
+            }
+        }
+    }
+}
+
+void SweepJob::finish() {
+    if (params.aggregate == SWEEP_AGG_AVG) {
+        for (int i = 0; i < points; i++) {
+            // Round half away from zero (sums are negative)
+            bins[i] = (bins[i] - params.passes / 2) / params.passes;
+        }
+    }
+    state = SWEEP_DONE;
+    endMs = millis();
+}
+
+bool SweepJob::isRunning() {
+    return state == SWEEP_RUNNING;
+}
+
+uint32_t SweepJob::getId() {
+    return id;
+}
+
+SweepState SweepJob::getState() {
+    return state;
+}
+
+const SweepParams& SweepJob::getParams() {
+    return params;
+}
+
+int SweepJob::getPointCount() {
+    return points;
+}
+
+int SweepJob::getPass() {
+    return pass;
+}
+
+int SweepJob::getProgressPermille() {
+    if (state == SWEEP_DONE) return 1000;
+    long total = (long)points * params.passes;
+    if (total <= 0) return 0;
+    return (int)(((long)pass * points + index) * 1000 / total);
+}
+
+unsigned long SweepJob::getElapsedMs() {
+    if (state == SWEEP_IDLE) return 0;
+    return (endMs != 0 ? endMs : millis()) - startMs;
+}
+
+size_t SweepJob::encodeResult(uint8_t* out, size_t capacity) {
+    if (state != SWEEP_DONE) return 0;
+    return encodeSpectrumFrame(out, capacity, SPECTRUM_FRAME_SWEEP, params.startMHz, params.stepMHz,
+                               endMs, bins, points);
+}
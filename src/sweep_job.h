@@ -0,0 +1,76 @@
+#ifndef SWEEP_JOB_H
+#define SWEEP_JOB_H
+
+#include <Arduino.h>
+#include "cc1101_interface.h"
+
+#define SWEEP_MAX_POINTS  1024
+#define SWEEP_MAX_PASSES  1000
+#define SWEEP_MIN_STEP    0.01   // MHz
+#define SWEEP_SETTLE_US   2000   // PLL settle + RSSI filter after each retune
+#define SWEEP_SLICE_US    20000  // Radio time per step() call
+
+enum SweepAggregate {
+    SWEEP_AGG_MAX,
+    SWEEP_AGG_AVG
+};
+
+enum SweepState {
+    SWEEP_IDLE,
+    SWEEP_RUNNING,
+    SWEEP_DONE,
+    SWEEP_CANCELLED
+};
+
+struct SweepParams {
+    float startMHz;
+    float stopMHz;
+    float stepMHz;
+    int passes;
+    SweepAggregate aggregate;
+};
+
+// Multi-pass spectrum survey that runs in short slices on the loop that
+// owns the radio, so the UI and web server keep running. Passes are
+// aggregated in place (max or average per bin); only the final bins are
+// kept, however many passes run.
+class SweepJob {
+public:
+    SweepJob(CC1101Interface* radio);
+
+    // Error text for invalid parameters, nullptr if they are usable
+    static const char* validate(const SweepParams& params);
+    static int pointCount(const SweepParams& params);
+
+    bool start(uint32_t id, const SweepParams& params);
+    void cancel();
+    void step(unsigned long budgetUs);  // Does up to budgetUs of radio work
+
+    bool isRunning();
+    uint32_t getId();
+    SweepState getState();
+    const SweepParams& getParams();
+    int getPointCount();
+    int getPass();                // 0-based pass in progress
+    int getProgressPermille();
+    unsigned long getElapsedMs();
+
+    // Aggregated bins as a SPECTRUM_FRAME_SWEEP; 0 until the job is done
+    size_t encodeResult(uint8_t* out, size_t capacity);
+
+private:
+    CC1101Interface* cc1101;
+    uint32_t id;
+    SweepState state;
+    SweepParams params;
+    int points;
+    int pass;
+    int index;
+    unsigned long startMs;
+    unsigned long endMs;
+    int bins[SWEEP_MAX_POINTS];  // Running max, or sum until the job ends
+
+    void finish();
+};
+
+#endif
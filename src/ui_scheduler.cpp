@@ -0,0 +1,103 @@
+#include "ui_scheduler.h"
+#include "subghz_operations.h"
+#include "span_trace.h"
+#include "metrics.h"
+
+UIScheduler::UIScheduler(MenuSystem* menu, SubGhzOperations* ops) {
+    menuSystem = menu;
+    operations = ops;
+    nextFrameDue = 0;
+    lastState = MENU_MAIN;
+    lastStateVersion = 0;
+    frameCount = 0;
+    skippedFrames = 0;
+    overruns = 0;
+    lastFrameTime = 0;
+    maxFrameTime = 0;
+    totalFrameTime = 0;
+    setTargetFps(UI_TARGET_FPS);
+}
+
+void UIScheduler::setTargetFps(int fps) {
+    targetFps = constrain(fps, 1, 60);
+    framePeriod = 1000000UL / targetFps;
+}
+
+int UIScheduler::getTargetFps() {
+    return targetFps;
+}
+
+void UIScheduler::update() {
+    unsigned long now = micros();
+    if ((long)(now - nextFrameDue) < 0) return;
+    
+    // Keep a steady cadence, but don't try to catch up after a blocking
+    // screen (hacks, games) held the loop for several frames
+    nextFrameDue += framePeriod;
+    if ((long)(now - nextFrameDue) >= 0) {
+        nextFrameDue = now + framePeriod;
+    }
+    
+    MenuState state = menuSystem->getState();
+    bool menuDirty = (state != lastState) || menuSystem->needsRedraw();
+    uint32_t version = operations->getStateVersion();
+    
+    if (!menuDirty && version == lastStateVersion) {
+        skippedFrames++;
+        return;
+    }
+    
+    TRACE_SPAN("lcd", "frame");
+    unsigned long start = micros();
+    
+    // Static screen first so operations draw on top
+    if (menuDirty) {
+        menuSystem->draw();
+        menuSystem->clearRedrawFlag();
+        lastState = state;
+    }
+    operations->render();
+    lastStateVersion = version;
+    
+    lastFrameTime = micros() - start;
+    metrics.observe(METRIC_LCD_FRAME, lastFrameTime);
+    totalFrameTime += lastFrameTime;
+    if (lastFrameTime > maxFrameTime) maxFrameTime = lastFrameTime;
+    if (lastFrameTime > framePeriod) overruns++;
+    frameCount++;
+}
+
+unsigned long UIScheduler::getTimeUntilNextFrame() {
+    long remaining = (long)(nextFrameDue - micros());
+    if (remaining <= 0) return 0;
+    return (remaining + 999) / 1000;
+}
+
+unsigned long UIScheduler::getFrameCount() {
+    return frameCount;
+}
+
+unsigned long UIScheduler::getSkippedFrames() {
+    return skippedFrames;
+}
+
+unsigned long UIScheduler::getOverruns() {
+    return overruns;
+}
+
+unsigned long UIScheduler::getLastFrameTime() {
+    return lastFrameTime;
+}
+
+unsigned long UIScheduler::getMaxFrameTime() {
+    return maxFrameTime;
+}
+
+unsigned long UIScheduler::getAverageFrameTime() {
+    if (frameCount == 0) return 0;
+    return totalFrameTime / frameCount;
+}
+
+unsigned long UIScheduler::getFramePeriod() {
+    return framePeriod;
+}
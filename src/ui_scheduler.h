@@ -0,0 +1,53 @@
+#ifndef UI_SCHEDULER_H
+#define UI_SCHEDULER_H
+
+#include <Arduino.h>
+#include "menu_system.h"
+
+class SubGhzOperations;
+
+#define UI_TARGET_FPS 25
+
+// Renders the menu and operation screens at a fixed target rate from the
+// latest published state, independent of radio and web timing. Frames
+// with nothing new to draw are skipped.
+class UIScheduler {
+public:
+    UIScheduler(MenuSystem* menu, SubGhzOperations* ops);
+    void setTargetFps(int fps);
+    int getTargetFps();
+    
+    // Call every loop iteration; renders when a frame is due
+    void update();
+    unsigned long getTimeUntilNextFrame();  // ms
+    
+    // Metrics
+    unsigned long getFrameCount();
+    unsigned long getSkippedFrames();
+    unsigned long getOverruns();       // Frames that took longer than the frame period
+    unsigned long getLastFrameTime();  // us
+    unsigned long getMaxFrameTime();   // us
+    unsigned long getAverageFrameTime();  // us
+    unsigned long getFramePeriod();    // us
+    
+private:
+    MenuSystem* menuSystem;
+    SubGhzOperations* operations;
+    
+    int targetFps;
+    unsigned long framePeriod;
+    unsigned long nextFrameDue;
+    
+    // Last state that was rendered
+    MenuState lastState;
+    uint32_t lastStateVersion;
+    
+    unsigned long frameCount;
+    unsigned long skippedFrames;
+    unsigned long overruns;
+    unsigned long lastFrameTime;
+    unsigned long maxFrameTime;
+    unsigned long totalFrameTime;
+};
+
+#endif
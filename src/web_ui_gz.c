@@ -0,0 +1,223 @@
+// Generated by tools/web_ui_gz.py from web/index.html - do not edit
+// 12287 bytes minified, 3377 bytes gzipped
+
+#include "web_ui.h"
+
+const uint8_t web_ui_gz[3377] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xDD, 0x1A, 0x6B, 0x77, 0xDA, 0x46,
+    0xF6, 0x3B, 0xBF, 0x62, 0xC2, 0x9E, 0xAD, 0x44, 0x83, 0x40, 0x80, 0xED, 0x3A, 0x60, 0xE8, 0x3A,
+    0x0E, 0x6E, 0xBC, 0xF5, 0x6B, 0x8D, 0xD3, 0x3D, 0xDD, 0x9E, 0x9E, 0x9E, 0x41, 0x1A, 0x40, 0xB5,
+    0x90, 0xB4, 0xA3, 0x91, 0x1F, 0x6D, 0xFC, 0xDF, 0xF7, 0xDE, 0x19, 0xBD, 0x25, 0x08, 0x49, 0xB3,
+    0xD9, 0x3D, 0x8D, 0x4F, 0x00, 0x69, 0xEE, 0xFB, 0x35, 0xF7, 0x8E, 0x74, 0xF4, 0xE2, 0xCD, 0xD5,
+    0xC9, 0xED, 0x8F, 0xD7, 0x53, 0xB2, 0x12, 0x6B, 0x77, 0xD2, 0x38, 0x4A, 0xBE, 0x18, 0xB5, 0xE1,
+    0x6B, 0xCD, 0x04, 0x25, 0x1E, 0x5D, 0xB3, 0x71, 0xF3, 0xDE, 0x61, 0x0F, 0x81, 0xCF, 0x45, 0x93,
+    0x58, 0xBE, 0x27, 0x98, 0x27, 0xC6, 0xCD, 0x07, 0xC7, 0x16, 0xAB, 0xB1, 0xCD, 0xEE, 0x1D, 0x8B,
+    0x19, 0xF2, 0xA2, 0x4D, 0x1C, 0xCF, 0x11, 0x0E, 0x75, 0x8D, 0xD0, 0xA2, 0x2E, 0x1B, 0xF7, 0x3A,
+    0x66, 0x33, 0x21, 0x63, 0xAD, 0x28, 0x0F, 0x19, 0xA0, 0xBD, 0xBB, 0x3D, 0x35, 0x0E, 0xF1, 0xB6,
+    0x70, 0x84, 0xCB, 0x26, 0x17, 0xFB, 0xE4, 0xE6, 0x94, 0xDC, 0xFA, 0xBE, 0x1B, 0x12, 0x83, 0xDC,
+    0xB0, 0xB5, 0x2F, 0x18, 0x39, 0x01, 0x1E, 0xDC, 0x77, 0x8F, 0xBA, 0x0A, 0xA6, 0x71, 0x14, 0x8A,
+    0x27, 0xFC, 0xFE, 0x9A, 0xFC, 0xDE, 0x58, 0x53, 0xBE, 0x74, 0xBC, 0x21, 0x31, 0x47, 0x8D, 0x80,
+    0xDA, 0xB6, 0xE3, 0x2D, 0xE5, 0xEF, 0xB9, 0xFF, 0x68, 0x84, 0xCE, 0x6F, 0xF2, 0x72, 0xEE, 0x73,
+    0x9B, 0x71, 0x03, 0x6E, 0x8D, 0x1A, 0xCF, 0xB0, 0x62, 0x3F, 0x01, 0xDE, 0x02, 0x68, 0x1A, 0x0B,
+    0xBA, 0x76, 0xDC, 0xA7, 0x21, 0xD1, 0x4E, 0xFC, 0x88, 0x3B, 0x8C, 0x93, 0x4B, 0xF6, 0xA0, 0xB5,
+    0xC9, 0xDA, 0xF7, 0xFC, 0x30, 0xA0, 0x16, 0x03, 0x3A, 0xD4, 0xBA, 0x5B, 0x72, 0x3F, 0xF2, 0xEC,
+    0x21, 0xF9, 0x8B, 0x69, 0xE3, 0xDF, 0xA8, 0xB1, 0x76, 0x3C, 0x63, 0xC5, 0x9C, 0xE5, 0x4A, 0x0C,
+    0x49, 0xCF, 0x34, 0xEF, 0x57, 0x39, 0xDE, 0x7D, 0x33, 0x00, 0x36, 0x96, 0xEF, 0xFA, 0x1C, 0x31,
+    0xCC, 0xC5, 0xC2, 0x34, 0x91, 0x6D, 0x07, 0x0D, 0x45, 0x1D, 0x0F, 0x98, 0xA0, 0xD0, 0x8F, 0xCA,
+    0x44, 0x43, 0x72, 0x60, 0x4A, 0x84, 0x54, 0x0D, 0x42, 0x23, 0xE1, 0x97, 0xF8, 0xF6, 0x28, 0xFE,
+    0xA1, 0x52, 0xA8, 0x08, 0xF0, 0x08, 0x1E, 0x49, 0xE8, 0xBB, 0x8E, 0x9D, 0x31, 0x88, 0x75, 0xE4,
+    0xD4, 0x76, 0xA2, 0x70, 0x48, 0xF6, 0x91, 0x66, 0x2A, 0xD3, 0x40, 0xB2, 0x90, 0x26, 0x59, 0x51,
+    0xDB, 0x7F, 0x40, 0x36, 0xA6, 0x94, 0x94, 0xF0, 0xE5, 0x9C, 0xEA, 0x66, 0x9B, 0xF4, 0xF7, 0xF7,
+    0xDB, 0x04, 0xBE, 0xCD, 0xCE, 0xA0, 0x85, 0xE2, 0xAE, 0x7A, 0x20, 0xA6, 0x60, 0x8F, 0xC2, 0xA0,
+    0xAE, 0xB3, 0x04, 0xC1, 0x2C, 0x70, 0x32, 0xE3, 0x89, 0xA0, 0x60, 0x4C, 0x21, 0xFC, 0x35, 0xAA,
+    0x8F, 0xA4, 0xA5, 0x31, 0xC1, 0xDC, 0x0C, 0x64, 0x63, 0xEB, 0xAA, 0xFA, 0x92, 0x50, 0x9E, 0x37,
+    0xA2, 0x15, 0xAC, 0x13, 0x46, 0x73, 0xE9, 0xDC, 0xDD, 0xB8, 0x0E, 0x4A, 0x46, 0xB6, 0x2C, 0x24,
+    0x93, 0x93, 0xC2, 0xEC, 0xBC, 0x42, 0x39, 0x90, 0xB0, 0xA0, 0x22, 0x0A, 0x8D, 0x80, 0x7A, 0xCC,
+    0x05, 0xE2, 0xB5, 0xFE, 0x4C, 0xEC, 0xDA, 0xFB, 0x48, 0xBB, 0xF6, 0x73, 0xAE, 0x2B, 0xC9, 0x96,
+    0x71, 0x76, 0x04, 0x5B, 0x03, 0x63, 0xDB, 0x09, 0x03, 0x97, 0x42, 0xAC, 0x2D, 0x5C, 0x06, 0xEB,
+    0xBF, 0x46, 0xA1, 0x70, 0x16, 0x4F, 0x46, 0x9C, 0x3E, 0x43, 0x22, 0xE3, 0xCD, 0x98, 0x33, 0xF1,
+    0xC0, 0x98, 0xB7, 0xC1, 0xCC, 0x29, 0xE3, 0x43, 0x10, 0x34, 0x13, 0x2E, 0x05, 0xCA, 0x8B, 0x3F,
+    0x18, 0x24, 0x96, 0xCD, 0xC4, 0x18, 0xBA, 0x34, 0x14, 0x86, 0xB5, 0x72, 0x5C, 0x1B, 0x4D, 0x51,
+    0xC4, 0xF6, 0x7C, 0x8F, 0x55, 0xF8, 0x16, 0x48, 0xB8, 0x74, 0x2E, 0x6D, 0x98, 0xD9, 0x9D, 0xD2,
+    0x22, 0x93, 0x7B, 0xEA, 0x46, 0x2C, 0x49, 0xAE, 0x87, 0x38, 0x43, 0xE6, 0xBE, 0x6B, 0x6F, 0xCC,
+    0x08, 0x48, 0x6B, 0x23, 0x64, 0x96, 0x70, 0x7C, 0x2F, 0x4D, 0xE6, 0x94, 0x7B, 0x7F, 0x3F, 0x31,
+    0x65, 0x00, 0x20, 0x3C, 0x42, 0x3B, 0xC6, 0x69, 0x03, 0x69, 0xF7, 0xD7, 0x51, 0x23, 0x4D, 0x42,
+    0xE5, 0x89, 0xCF, 0xE1, 0xDC, 0xD4, 0x4F, 0x73, 0xD7, 0xB7, 0xEE, 0x0A, 0xDC, 0x01, 0xD0, 0x5B,
+    0xB2, 0x4F, 0xF6, 0xA5, 0xF0, 0x83, 0x98, 0x47, 0xD9, 0x80, 0x85, 0xC0, 0x3D, 0x8C, 0x03, 0xB7,
+    0x6C, 0x9D, 0x55, 0x3F, 0x31, 0xAC, 0x82, 0xEC, 0x75, 0x64, 0xAA, 0x95, 0x03, 0x65, 0x7F, 0x43,
+    0xF9, 0x59, 0x70, 0xF6, 0xEF, 0x88, 0x79, 0xD6, 0x13, 0x10, 0x74, 0x81, 0xA4, 0xCF, 0xF3, 0x8A,
+    0x2C, 0xB9, 0x03, 0xA6, 0xC2, 0x4F, 0x03, 0xE2, 0x04, 0xEE, 0x09, 0x06, 0xEA, 0xB8, 0xD1, 0xDA,
+    0x03, 0xBB, 0x70, 0x16, 0x30, 0x2A, 0xF4, 0x7E, 0x9B, 0xF4, 0x16, 0x1C, 0xAA, 0xC3, 0x92, 0x06,
+    0x49, 0x44, 0xD6, 0x72, 0x8F, 0xB9, 0x19, 0x73, 0x81, 0x3E, 0x4D, 0x83, 0xB6, 0xD7, 0xAF, 0xF8,
+    0xA8, 0x4F, 0xF1, 0x6F, 0x43, 0x61, 0xDB, 0xDB, 0xAB, 0xF1, 0xD1, 0xA0, 0x4E, 0xBD, 0x1D, 0x6B,
+    0x79, 0xDE, 0x78, 0xB2, 0x4A, 0x45, 0x3C, 0x44, 0x3A, 0x81, 0xEF, 0xA8, 0x2A, 0x23, 0xC0, 0xC1,
+    0xA1, 0x83, 0xD6, 0x1E, 0x12, 0xEA, 0xBA, 0xE0, 0x8C, 0x7E, 0x58, 0x50, 0x67, 0xB8, 0xF2, 0xEF,
+    0x65, 0x01, 0x2F, 0x68, 0x31, 0x90, 0xFF, 0x52, 0x51, 0xCB, 0xD2, 0x95, 0xEB, 0x6E, 0x6F, 0x5B,
+    0xDD, 0x4D, 0x59, 0x75, 0x28, 0xB8, 0xFD, 0x9E, 0x55, 0x4A, 0x56, 0x9C, 0xD8, 0xBB, 0xF2, 0xDA,
+    0xAF, 0xE5, 0xB5, 0xAF, 0x78, 0x89, 0xC8, 0x63, 0x06, 0xF7, 0x1F, 0x76, 0x8E, 0x84, 0xFE, 0x82,
+    0x63, 0x0C, 0xE0, 0xFF, 0x42, 0x18, 0xE4, 0x69, 0x39, 0x5E, 0x10, 0x89, 0x36, 0xC9, 0x6E, 0xA8,
+    0x78, 0xFB, 0xBF, 0x8E, 0x04, 0x90, 0x9F, 0xCA, 0x2C, 0x33, 0xE6, 0x11, 0x44, 0xB2, 0x17, 0x7E,
+    0x6C, 0x6E, 0x0C, 0x6A, 0x72, 0x23, 0x47, 0xB4, 0x94, 0x08, 0xE8, 0x94, 0x9E, 0xF9, 0x71, 0x36,
+    0xA8, 0xAD, 0x58, 0x9F, 0xC9, 0x06, 0xB0, 0x5B, 0xEE, 0xA3, 0x19, 0xEA, 0xCA, 0xF6, 0xCE, 0x39,
+    0x92, 0xE9, 0x5A, 0x9F, 0x25, 0x59, 0xE4, 0xEE, 0x14, 0xA2, 0x7B, 0xAD, 0x32, 0xD5, 0x34, 0x21,
+    0xA4, 0x08, 0x0B, 0x9F, 0x43, 0xC1, 0x91, 0x8D, 0xA5, 0x0E, 0xF2, 0x1F, 0x96, 0xC1, 0x3B, 0xAE,
+    0x13, 0x42, 0x35, 0x2E, 0x4B, 0x91, 0xD8, 0xB8, 0x08, 0xCB, 0x99, 0x05, 0x86, 0xDD, 0x15, 0x16,
+    0xC3, 0x62, 0x37, 0xD8, 0x10, 0x6A, 0x7E, 0x19, 0xB2, 0xD8, 0xCC, 0xA5, 0x19, 0x8C, 0xBE, 0x43,
+    0xF3, 0x94, 0xAF, 0x65, 0xDC, 0xA9, 0x70, 0x93, 0x1B, 0x8B, 0x47, 0x06, 0x75, 0x5C, 0x36, 0x55,
+    0x26, 0x45, 0x64, 0xB3, 0xCD, 0x53, 0x83, 0xE7, 0x6C, 0xBE, 0x66, 0x61, 0x48, 0xE5, 0x46, 0x97,
+    0xDF, 0xB9, 0xFA, 0xC5, 0x16, 0x44, 0x95, 0xFA, 0xBA, 0x78, 0xAC, 0xEB, 0xDF, 0xD2, 0x64, 0x52,
+    0x5D, 0xC6, 0x8E, 0x21, 0x9A, 0xC9, 0x02, 0xFD, 0xA1, 0x65, 0xC1, 0xCF, 0xED, 0xE5, 0xB0, 0x76,
+    0x93, 0xAF, 0xD9, 0x0B, 0x13, 0xA2, 0x8C, 0x73, 0x7F, 0x8B, 0xCD, 0x2A, 0x24, 0x37, 0xF9, 0x08,
+    0xCB, 0xB6, 0x0F, 0x83, 0x0A, 0xDF, 0xDE, 0xBD, 0x4A, 0x33, 0x96, 0x5B, 0xD7, 0x83, 0x83, 0x6A,
+    0x07, 0xB0, 0xAF, 0x6A, 0xD2, 0xDF, 0xD6, 0xCC, 0x76, 0x28, 0xD1, 0x73, 0xD3, 0xC2, 0xDE, 0x21,
+    0xA0, 0xB7, 0x80, 0x4D, 0x61, 0x9C, 0x28, 0x35, 0xA4, 0x71, 0xF7, 0x5E, 0xE8, 0x15, 0x62, 0x92,
+    0xF5, 0x6D, 0xC0, 0x86, 0xDA, 0x26, 0xAB, 0xFC, 0x33, 0xFC, 0x1D, 0x75, 0xE3, 0x81, 0xEB, 0xA8,
+    0x1B, 0x8F, 0x82, 0x38, 0x44, 0xC1, 0x97, 0xED, 0xDC, 0x13, 0x0B, 0x9A, 0xCA, 0x70, 0xDC, 0x4C,
+    0xE5, 0xC1, 0x59, 0x6E, 0xD5, 0x9B, 0xCC, 0x18, 0xA7, 0xC1, 0x8A, 0xCC, 0xA2, 0xF9, 0x77, 0x6F,
+    0xFF, 0x25, 0x07, 0xBA, 0x78, 0x9A, 0x03, 0x1A, 0xBD, 0x22, 0x6A, 0xD2, 0xFB, 0x37, 0x27, 0x37,
+    0xD3, 0x8B, 0xAB, 0xDB, 0x29, 0x99, 0xBD, 0x7B, 0x8D, 0x48, 0x27, 0x57, 0x97, 0xB7, 0x37, 0x57,
+    0xE7, 0xE4, 0xFA, 0xF8, 0x72, 0x7A, 0x7E, 0xD4, 0x05, 0x8C, 0x12, 0x5E, 0xAE, 0xB5, 0x6F, 0x12,
+    0xC7, 0x4E, 0xEE, 0x5C, 0xCB, 0x1B, 0xB5, 0xB0, 0xD8, 0x05, 0xE3, 0x8A, 0x4C, 0xA4, 0xE2, 0x92,
+    0xEC, 0x6E, 0x9B, 0x93, 0x0B, 0xDF, 0x66, 0x43, 0x50, 0x18, 0x00, 0xEA, 0xE1, 0x64, 0x8F, 0xAB,
+    0xD8, 0x41, 0x71, 0xE4, 0xE0, 0x62, 0x44, 0x69, 0x4E, 0xCE, 0x6C, 0x97, 0xA5, 0x78, 0x1B, 0x85,
+    0xFD, 0xB0, 0x00, 0x37, 0xB3, 0xD9, 0xD9, 0xAE, 0x02, 0xF0, 0x30, 0x74, 0x7E, 0x90, 0x97, 0x13,
+    0xC3, 0xF8, 0x1C, 0xCC, 0x4F, 0x5C, 0x07, 0x14, 0x0A, 0x77, 0x36, 0x80, 0x04, 0x87, 0xFC, 0xF5,
+    0x44, 0x73, 0x62, 0x7E, 0x0E, 0x01, 0xCE, 0xAE, 0x77, 0xE0, 0x3D, 0xE9, 0xBD, 0xEA, 0x77, 0x7A,
+    0x07, 0x87, 0x9D, 0xBD, 0x4E, 0xEF, 0x73, 0x30, 0x3D, 0x77, 0xBC, 0xBB, 0x5D, 0x55, 0x76, 0x01,
+    0x76, 0x06, 0x77, 0x41, 0x8A, 0x13, 0xDF, 0xF3, 0xB0, 0x39, 0xF7, 0x96, 0x65, 0x21, 0xAA, 0xB2,
+    0x94, 0xBA, 0x79, 0x99, 0x24, 0xFD, 0xC9, 0xEC, 0x7A, 0x7A, 0x72, 0x7B, 0xF3, 0xEE, 0x02, 0x72,
+    0xA2, 0x0F, 0x77, 0x2C, 0xEA, 0xDD, 0xD3, 0x30, 0xE5, 0x1D, 0x8F, 0x1D, 0x71, 0x68, 0xA7, 0x57,
+    0xEA, 0xA0, 0xA5, 0x09, 0xA5, 0xA0, 0x49, 0xD4, 0x00, 0x34, 0x6E, 0xC2, 0x00, 0xD4, 0x9C, 0x1C,
+    0x75, 0x15, 0x81, 0x92, 0x15, 0x0A, 0xD3, 0x4B, 0x6A, 0x88, 0x3C, 0x4D, 0xD0, 0x87, 0x8B, 0x42,
+    0x08, 0x55, 0x40, 0xA6, 0x9E, 0x5D, 0x17, 0x63, 0xBB, 0x2A, 0x7A, 0x7A, 0x33, 0xFD, 0xC7, 0xBB,
+    0xE9, 0xE5, 0xC9, 0x8F, 0x64, 0x36, 0x3D, 0x07, 0x9D, 0xCF, 0xAE, 0x2E, 0x63, 0x9D, 0x73, 0xA8,
+    0xD5, 0xDA, 0x84, 0xD8, 0xAA, 0x23, 0xCB, 0xC3, 0xE0, 0xA6, 0xD7, 0x24, 0x36, 0x15, 0xD4, 0xC0,
+    0xCB, 0x71, 0x73, 0xD0, 0xDB, 0x6F, 0x12, 0xDF, 0x83, 0x68, 0xB4, 0xEE, 0x40, 0x64, 0x89, 0x7C,
+    0x0A, 0x2B, 0x3A, 0x2C, 0xB4, 0x9A, 0x13, 0xF8, 0x24, 0x17, 0x6F, 0x7F, 0x3B, 0xEA, 0x2A, 0x52,
+    0x1B, 0x69, 0x12, 0xD5, 0x61, 0x14, 0x48, 0xEF, 0x0D, 0x06, 0x9D, 0x57, 0xFD, 0x7A, 0xEA, 0x6A,
+    0x0D, 0x18, 0xA8, 0x1F, 0x3B, 0xF1, 0x28, 0x10, 0x3F, 0x3C, 0x38, 0xAC, 0xA7, 0x0C, 0x0B, 0x40,
+    0x16, 0x3E, 0x3F, 0x9E, 0xE6, 0xAB, 0x4D, 0xB6, 0x78, 0x25, 0x6D, 0xF1, 0xAA, 0x62, 0x8B, 0xAA,
+    0x0B, 0x93, 0xCE, 0x1D, 0xAD, 0x2F, 0xBB, 0x79, 0x22, 0x9E, 0x02, 0x36, 0x6E, 0x7A, 0xD1, 0x7A,
+    0x0E, 0xF5, 0x5D, 0xC6, 0x05, 0xC2, 0x20, 0xD9, 0x26, 0x59, 0x3B, 0x1E, 0x78, 0xC0, 0x84, 0x60,
+    0x84, 0x7D, 0x0A, 0xF8, 0xF7, 0x41, 0x27, 0xE8, 0xBC, 0x82, 0x71, 0xD3, 0xEC, 0x98, 0x66, 0xAF,
+    0x49, 0x60, 0x57, 0xB1, 0xD8, 0x0A, 0xBA, 0x49, 0xC6, 0xC7, 0x4D, 0xE0, 0x2D, 0x43, 0x50, 0xCD,
+    0x04, 0x09, 0x25, 0xA8, 0xA0, 0x78, 0xD7, 0x0F, 0xE4, 0xA4, 0x2B, 0xB3, 0x6D, 0xDC, 0xA4, 0xE1,
+    0x5D, 0x73, 0x72, 0x3C, 0xFB, 0xBE, 0x7B, 0x75, 0xF5, 0xFD, 0x51, 0x57, 0xAD, 0x55, 0x80, 0xFA,
+    0x0B, 0x84, 0xEA, 0x1B, 0xA7, 0xB3, 0xCD, 0x30, 0x4B, 0x09, 0xF3, 0xDD, 0x36, 0x90, 0x3D, 0x09,
+    0xB2, 0xB7, 0x95, 0xCC, 0x1A, 0x41, 0x2E, 0x0A, 0x00, 0x5D, 0xA5, 0xC7, 0x16, 0xCF, 0xA4, 0x9E,
+    0x40, 0x35, 0x75, 0x70, 0xC0, 0xED, 0xBB, 0xCB, 0x69, 0xD5, 0xFA, 0xBB, 0xE6, 0xD1, 0xB1, 0x4C,
+    0x9D, 0x59, 0x35, 0x77, 0x8A, 0xE3, 0x4B, 0x35, 0x6F, 0x72, 0x93, 0x88, 0x6A, 0x8C, 0xF3, 0x41,
+    0x82, 0xE9, 0x7F, 0x2E, 0xEF, 0xA2, 0x84, 0xE7, 0x67, 0xB3, 0xDB, 0xE9, 0xE5, 0xC6, 0xA8, 0xCB,
+    0x51, 0x52, 0x6D, 0x73, 0x99, 0xD2, 0x8D, 0xBC, 0x8B, 0x94, 0x6E, 0xA6, 0x27, 0x57, 0x37, 0x6F,
+    0x76, 0xA3, 0x84, 0xED, 0x61, 0x95, 0x12, 0xDE, 0x55, 0x94, 0xAE, 0xCF, 0x8F, 0x7F, 0xDC, 0x85,
+    0x12, 0x36, 0xC3, 0x05, 0x3A, 0x7E, 0x70, 0x2C, 0x57, 0x91, 0xCC, 0xEC, 0xF6, 0xEA, 0x7A, 0xAB,
+    0xF1, 0x31, 0x20, 0xE3, 0xEE, 0xB0, 0x99, 0x10, 0x4F, 0xAE, 0x27, 0x35, 0x5E, 0x52, 0x6D, 0x1F,
+    0x98, 0x3B, 0xDF, 0xEE, 0xFC, 0xA6, 0xDA, 0x9D, 0x7B, 0x68, 0xA8, 0x3B, 0x66, 0x99, 0x4B, 0x68,
+    0x71, 0x27, 0x80, 0x88, 0x71, 0x99, 0x88, 0x27, 0x63, 0x66, 0x9F, 0x26, 0x85, 0x8F, 0x8C, 0x89,
+    0xAA, 0x25, 0xD0, 0x11, 0x46, 0x9E, 0x3A, 0xF7, 0xC9, 0xA5, 0x30, 0x86, 0x15, 0x36, 0x7F, 0x75,
+    0x78, 0xB8, 0x06, 0x7D, 0xB6, 0x6F, 0x45, 0x6B, 0xD8, 0x92, 0x3B, 0x70, 0x9F, 0x3F, 0xCD, 0xE2,
+    0x32, 0x7A, 0xEC, 0xBA, 0xBA, 0x96, 0x9E, 0x2C, 0x68, 0x2D, 0xE8, 0x56, 0xF9, 0x94, 0x5A, 0x2B,
+    0x1D, 0x0D, 0x36, 0x9E, 0x60, 0x07, 0x0C, 0x63, 0x84, 0x54, 0x09, 0xC3, 0x00, 0x46, 0x9C, 0x35,
+    0x4C, 0x13, 0xBA, 0xA6, 0xEA, 0xA1, 0x86, 0x53, 0x01, 0xFC, 0x67, 0xF7, 0x48, 0x18, 0xFC, 0xB2,
+    0x64, 0x22, 0x07, 0x0C, 0xBD, 0x67, 0x1E, 0x32, 0x5C, 0xF9, 0x0F, 0x17, 0xCA, 0x62, 0xBA, 0x96,
+    0x09, 0x18, 0x82, 0xBA, 0xC2, 0x27, 0x1A, 0x79, 0x29, 0x25, 0x85, 0x2F, 0x0D, 0xEB, 0x10, 0xF4,
+    0xFB, 0x5A, 0xDC, 0xDA, 0x4B, 0x36, 0x39, 0xB5, 0x73, 0x74, 0xB0, 0xA7, 0x6E, 0xCB, 0x22, 0xD4,
+    0x92, 0xC7, 0x8F, 0x5E, 0x28, 0xC8, 0x3A, 0x5C, 0xBE, 0x01, 0x3F, 0x8C, 0x49, 0xAA, 0x32, 0x88,
+    0x35, 0x75, 0x19, 0xFE, 0x7C, 0xFD, 0x74, 0x06, 0x32, 0xC5, 0x7E, 0x43, 0xBA, 0x0A, 0xB8, 0x83,
+    0x74, 0x4E, 0xD4, 0x21, 0x1D, 0x20, 0xE2, 0x55, 0xBA, 0x24, 0xF5, 0xB9, 0xA4, 0x6B, 0x06, 0x0B,
+    0x09, 0xA6, 0x94, 0x16, 0xB9, 0xA6, 0x50, 0xB2, 0x0D, 0xEE, 0xC4, 0xC3, 0x0C, 0x42, 0xCA, 0x43,
+    0x42, 0x0D, 0xB4, 0x66, 0xE2, 0xD6, 0x59, 0x33, 0x3F, 0x12, 0xBA, 0xDE, 0x52, 0x26, 0xDD, 0x84,
+    0x82, 0x13, 0x10, 0x60, 0x3C, 0xB7, 0x09, 0x0E, 0x1A, 0x52, 0x69, 0x1A, 0x3E, 0x79, 0x16, 0x49,
+    0x55, 0x57, 0xA5, 0x22, 0xD5, 0x54, 0xDA, 0x6B, 0x8B, 0x9E, 0x49, 0x29, 0x06, 0xBF, 0xCA, 0x4A,
+    0x35, 0x4A, 0x2C, 0xE4, 0xDB, 0x1F, 0x42, 0x83, 0xBA, 0x9B, 0x61, 0x09, 0xFE, 0x94, 0xF2, 0xE4,
+    0x2C, 0x0C, 0xE0, 0x07, 0x5A, 0x83, 0x3E, 0x50, 0x07, 0x84, 0x60, 0x02, 0xE2, 0x45, 0xEB, 0x22,
+    0x16, 0x38, 0x0D, 0xD4, 0x63, 0x62, 0xE5, 0xC3, 0xBC, 0xA4, 0x5D, 0x5F, 0xCD, 0x6E, 0xB5, 0x76,
+    0x03, 0x07, 0x03, 0xC6, 0x61, 0x6A, 0xF8, 0x5D, 0x8B, 0x4D, 0x6C, 0xDC, 0x82, 0xE9, 0x34, 0x80,
+    0xA0, 0x41, 0x00, 0xC9, 0x48, 0x51, 0xB7, 0x2E, 0x4C, 0x32, 0x0F, 0x0F, 0x06, 0x0E, 0xEF, 0x46,
+    0xC4, 0x5D, 0x08, 0x0D, 0xE8, 0x9D, 0x6D, 0xED, 0xB9, 0x2D, 0x1F, 0xCB, 0x00, 0x6C, 0xDA, 0x03,
+    0x8C, 0xF3, 0xA1, 0xF2, 0x15, 0xE8, 0x12, 0xB9, 0x92, 0x82, 0xBC, 0x0F, 0x97, 0x32, 0x24, 0x95,
+    0xB0, 0xB8, 0xFB, 0xA5, 0x82, 0x26, 0x92, 0x77, 0x7E, 0x0D, 0x31, 0xE7, 0x47, 0x0D, 0x67, 0x41,
+    0xF4, 0xF4, 0xA6, 0x7F, 0xB7, 0x29, 0x7F, 0x90, 0x48, 0x36, 0x1D, 0x7D, 0x6A, 0x26, 0x6D, 0xCF,
+    0xA3, 0x72, 0x7A, 0xDC, 0x82, 0x31, 0x6D, 0x19, 0x65, 0x45, 0xEE, 0x1D, 0xE1, 0x9F, 0x3A, 0x8F,
+    0xCC, 0xD6, 0x07, 0xAD, 0x24, 0x51, 0x32, 0xA8, 0xCC, 0x14, 0xE4, 0x65, 0x03, 0xF3, 0x27, 0x59,
+    0xC0, 0x8F, 0x5F, 0x38, 0x74, 0xA6, 0x29, 0x7A, 0x5F, 0xA1, 0xDF, 0xBD, 0xA6, 0x91, 0x9D, 0x03,
+    0x9C, 0x53, 0xCF, 0x96, 0x4D, 0xA4, 0x5A, 0xAD, 0x66, 0x21, 0x61, 0x6E, 0x88, 0xE3, 0x7F, 0x5E,
+    0x58, 0x89, 0xA9, 0x06, 0xE6, 0xF7, 0xEF, 0x89, 0x14, 0x9D, 0x2C, 0xA8, 0xE3, 0x82, 0xF7, 0x00,
+    0x5B, 0x2E, 0xA8, 0x0C, 0x7E, 0x26, 0xE0, 0x6A, 0x6B, 0x45, 0x74, 0x79, 0xAF, 0x55, 0x22, 0xA3,
+    0x4D, 0xF1, 0xEE, 0x50, 0x0A, 0x23, 0x01, 0x92, 0x61, 0xBC, 0x44, 0xA4, 0x9C, 0x13, 0x85, 0x3D,
+    0x4A, 0x9E, 0x01, 0xED, 0x10, 0xAC, 0x6A, 0xA7, 0xFB, 0x72, 0xE1, 0x5A, 0x89, 0xAB, 0x3F, 0x14,
+    0xA4, 0x79, 0xAB, 0x29, 0xCD, 0x61, 0xD2, 0x80, 0x9D, 0x8D, 0xD4, 0xB2, 0xDA, 0x50, 0x51, 0xA3,
+    0x00, 0x18, 0xB3, 0x99, 0x1C, 0x63, 0xF4, 0x1D, 0x7D, 0x7B, 0x2A, 0xDD, 0x8A, 0xE5, 0x5A, 0x5A,
+    0x3D, 0x6E, 0x18, 0x80, 0xF9, 0x97, 0xF3, 0x74, 0xD2, 0x43, 0xEC, 0xEA, 0x69, 0xD5, 0x89, 0xFC,
+    0x19, 0x3C, 0xAD, 0x34, 0xFF, 0x1F, 0x79, 0x9A, 0x27, 0xCC, 0xBF, 0xA4, 0xA7, 0x55, 0x8F, 0xB7,
+    0xBB, 0xA7, 0x11, 0xFE, 0xCF, 0xE1, 0x69, 0xD4, 0xE4, 0x8B, 0x7B, 0x3A, 0x35, 0xE0, 0x97, 0x70,
+    0x70, 0xD6, 0x7C, 0xEF, 0xEA, 0x5F, 0xC4, 0xA9, 0xF1, 0xEE, 0x67, 0xB3, 0xFA, 0x55, 0x00, 0x9D,
+    0x7A, 0x2A, 0x5D, 0xA0, 0xB6, 0xAF, 0x8F, 0x35, 0x6E, 0x21, 0x71, 0xFC, 0x80, 0xF8, 0x09, 0xD1,
+    0xFF, 0x8E, 0x59, 0x95, 0xDE, 0xA7, 0x37, 0xC7, 0x17, 0xD3, 0x5F, 0x7E, 0x98, 0xDE, 0xCC, 0x60,
+    0x04, 0x04, 0x03, 0xF4, 0x46, 0x85, 0x85, 0xB7, 0xD3, 0xE3, 0x37, 0xD3, 0x1B, 0xBC, 0x7F, 0x98,
+    0x9B, 0x1E, 0x6C, 0x86, 0xE1, 0x7D, 0xCA, 0xA1, 0xB3, 0xD5, 0xE7, 0xD1, 0x62, 0xC1, 0x78, 0xD6,
+    0x58, 0xE2, 0x4B, 0x3C, 0x00, 0xEF, 0xC1, 0xE7, 0x1B, 0xB0, 0xE9, 0x0F, 0x70, 0x99, 0xC0, 0x28,
+    0x3B, 0xAA, 0x8B, 0xCE, 0xFC, 0x49, 0xB0, 0x73, 0xE6, 0x2D, 0xA1, 0x61, 0x38, 0x2A, 0x32, 0x7B,
+    0xFF, 0xBE, 0x81, 0x44, 0xB0, 0xB7, 0x7C, 0xE7, 0x78, 0xE2, 0x50, 0x37, 0x5B, 0xE4, 0xC5, 0x78,
+    0x4C, 0xCC, 0xC7, 0xFD, 0x01, 0x86, 0x5D, 0x71, 0xB1, 0x97, 0x2C, 0xEE, 0x1D, 0x54, 0x31, 0xFB,
+    0x6A, 0xB1, 0xA0, 0x24, 0x8A, 0xCA, 0x99, 0x88, 0xB8, 0x47, 0xBC, 0xC8, 0x75, 0x47, 0xA9, 0x29,
+    0x2C, 0x3C, 0x71, 0x04, 0xD1, 0xF3, 0x24, 0x7A, 0x07, 0xFA, 0x1E, 0x0C, 0x09, 0x3C, 0x62, 0xBB,
+    0x4A, 0xFF, 0x52, 0xD1, 0x69, 0x91, 0x02, 0x8F, 0xF8, 0x02, 0xC2, 0x15, 0x6A, 0xC7, 0xB0, 0xA4,
+    0xC2, 0xA0, 0xD5, 0x6E, 0xC8, 0xB2, 0x55, 0x5C, 0x18, 0xF4, 0xF5, 0x83, 0x98, 0x37, 0xE9, 0xE2,
+    0xBB, 0x09, 0x26, 0x82, 0xB1, 0xA0, 0x02, 0xD5, 0x33, 0x73, 0x60, 0xEC, 0xA0, 0xDD, 0x10, 0x30,
+    0x35, 0x00, 0xC1, 0x75, 0x0D, 0x68, 0xA2, 0x0D, 0x14, 0x26, 0x07, 0x8F, 0xE3, 0xD1, 0x4F, 0x67,
+    0x20, 0xC4, 0x31, 0xE7, 0x50, 0x30, 0x95, 0x76, 0xED, 0x82, 0x46, 0xED, 0x58, 0xA1, 0xC6, 0x73,
+    0x61, 0x94, 0x52, 0x31, 0xF0, 0x9A, 0x86, 0xEC, 0x60, 0x4F, 0x45, 0x02, 0x8E, 0x3E, 0x59, 0x1C,
+    0x70, 0x8A, 0x61, 0x40, 0x85, 0x3F, 0x57, 0x0B, 0x49, 0x5C, 0xA1, 0xE5, 0xC2, 0x38, 0x40, 0xA4,
+    0xFA, 0x8A, 0x33, 0x80, 0x77, 0x5C, 0x69, 0xD0, 0x16, 0x3E, 0xB8, 0xE0, 0x44, 0xC7, 0x59, 0xD6,
+    0x01, 0x40, 0x73, 0x04, 0x5F, 0x47, 0x24, 0x03, 0x80, 0xEB, 0x97, 0x2F, 0x5B, 0x8A, 0xD0, 0x4F,
+    0xCE, 0xCF, 0x00, 0x82, 0x6B, 0xF8, 0xEE, 0xD7, 0x09, 0x48, 0x74, 0x2C, 0x74, 0xA7, 0x95, 0x1A,
+    0xBC, 0x10, 0xA9, 0x88, 0xD0, 0x49, 0x63, 0x31, 0xA7, 0x0B, 0x67, 0x1E, 0xD4, 0x78, 0x79, 0x00,
+    0x2B, 0x4B, 0x1C, 0x6A, 0xB1, 0x71, 0xC4, 0xC9, 0x9D, 0xCF, 0x43, 0xAB, 0x5E, 0x9C, 0xFE, 0x92,
+    0x5E, 0x9A, 0xC9, 0xF2, 0x88, 0x87, 0xF7, 0xDA, 0x68, 0x0B, 0xA5, 0xEC, 0xA0, 0xBB, 0x9E, 0x92,
+    0x02, 0x08, 0x25, 0x31, 0x53, 0x53, 0x01, 0x28, 0x17, 0xF0, 0x88, 0x5E, 0x46, 0x76, 0x04, 0x82,
+    0x2F, 0x1C, 0x68, 0xF8, 0xB7, 0x8A, 0x9C, 0x9E, 0xE8, 0xD7, 0xB3, 0x91, 0xD4, 0x70, 0x57, 0xB0,
+    0x5F, 0xAF, 0x35, 0x55, 0x1C, 0xCA, 0xA6, 0x89, 0x0F, 0x6C, 0x75, 0x19, 0xA6, 0x6D, 0x79, 0x14,
+    0xD7, 0x26, 0x18, 0x41, 0x99, 0xC3, 0xE3, 0x73, 0xE6, 0x2D, 0xC3, 0x61, 0x72, 0xEC, 0xAB, 0xA5,
+    0xC1, 0x60, 0x89, 0x47, 0x40, 0x50, 0x98, 0x08, 0x2E, 0x05, 0x7B, 0x14, 0xBA, 0xD6, 0xB7, 0x25,
+    0x90, 0x78, 0xEC, 0x2C, 0x1C, 0xD7, 0x9D, 0xE1, 0xB8, 0x8B, 0x63, 0x6E, 0xFC, 0xFE, 0x8D, 0x96,
+    0x2D, 0x41, 0x67, 0x23, 0x74, 0xF5, 0xA8, 0x31, 0x26, 0x13, 0xBF, 0x25, 0x18, 0x5F, 0xA9, 0xB3,
+    0xEC, 0x2C, 0xFA, 0x28, 0xFF, 0xA7, 0x1C, 0x52, 0xC6, 0x05, 0x70, 0x48, 0x1C, 0x54, 0x26, 0x09,
+    0xB0, 0xDA, 0x00, 0xCC, 0x03, 0xA8, 0x08, 0x4C, 0x34, 0x77, 0xD9, 0x3D, 0x73, 0x01, 0xF0, 0x82,
+    0x8A, 0x55, 0x67, 0xED, 0x78, 0xBA, 0xFA, 0x41, 0x1F, 0x75, 0x1D, 0x91, 0x30, 0x46, 0x5F, 0x62,
+    0xFE, 0x62, 0x7E, 0x7E, 0x83, 0xB2, 0xB6, 0xDA, 0xA4, 0x97, 0x8A, 0xA4, 0x24, 0x04, 0x74, 0x45,
+    0xE6, 0xEB, 0xA2, 0xE4, 0x55, 0x23, 0x24, 0x24, 0x27, 0xC4, 0xD8, 0x37, 0xC9, 0xB7, 0x60, 0x14,
+    0xF5, 0xC4, 0x50, 0x23, 0x43, 0xA2, 0xE7, 0x16, 0xBF, 0x49, 0x16, 0x71, 0x19, 0x17, 0xB5, 0xF8,
+    0x69, 0x65, 0xDE, 0xB2, 0xD2, 0x7C, 0x0E, 0x30, 0x4D, 0x0C, 0x53, 0x32, 0x1C, 0x31, 0x62, 0xF9,
+    0xDA, 0x24, 0x55, 0x2A, 0xB5, 0xA1, 0x41, 0x7A, 0xA8, 0x48, 0x9B, 0xA4, 0x46, 0x7E, 0x6E, 0x7C,
+    0xD0, 0xF9, 0xF2, 0xB1, 0x40, 0x25, 0x0E, 0x65, 0x5C, 0x95, 0x47, 0x4C, 0x6C, 0x52, 0x46, 0x1F,
+    0xA6, 0x38, 0xF5, 0xEC, 0x0A, 0x3D, 0x15, 0xA8, 0xD8, 0xFE, 0x40, 0xA4, 0xA2, 0x7A, 0x99, 0xF3,
+    0x5A, 0xF5, 0x6C, 0x2A, 0x7D, 0x46, 0x71, 0xCF, 0xDE, 0xBD, 0xD3, 0x40, 0x78, 0xED, 0xD3, 0xFB,
+    0x8A, 0x4A, 0x2D, 0xAA, 0xDF, 0xF2, 0x91, 0xBA, 0xEF, 0xC6, 0x4F, 0x9B, 0xF3, 0xAD, 0x83, 0x12,
+    0x9B, 0x28, 0x39, 0x86, 0xD0, 0x3A, 0x28, 0x14, 0x95, 0xD6, 0x18, 0xD2, 0x81, 0xEF, 0xBA, 0x78,
+    0xAC, 0xC4, 0xB1, 0x08, 0xCB, 0xCD, 0x29, 0x77, 0x2A, 0x28, 0xAE, 0x61, 0x15, 0xBA, 0x47, 0x9D,
+    0x79, 0x74, 0xEE, 0xAA, 0xB2, 0x82, 0x42, 0xC6, 0x97, 0xE4, 0xAB, 0xAF, 0xC8, 0x8B, 0x94, 0x00,
+    0x2E, 0xE6, 0xA9, 0x01, 0xFA, 0x19, 0x3E, 0x9B, 0xBE, 0xA7, 0xAE, 0x9E, 0xB7, 0x5E, 0x9B, 0xF4,
+    0xE3, 0x43, 0x29, 0xD5, 0xF6, 0x20, 0xC1, 0x17, 0x39, 0x8A, 0x05, 0x82, 0x96, 0xCB, 0x28, 0x4F,
+    0xC9, 0x64, 0x4B, 0xA3, 0x46, 0x55, 0xF0, 0x42, 0xA5, 0xB2, 0xD4, 0x83, 0xB3, 0x99, 0xE0, 0x8C,
+    0xAE, 0xF5, 0x44, 0xF0, 0x17, 0x0F, 0x8E, 0x67, 0xFB, 0x0F, 0x9D, 0x29, 0x9E, 0x33, 0xCE, 0xFC,
+    0x88, 0x5B, 0x6C, 0x6B, 0xA9, 0x4C, 0x9F, 0xC4, 0x55, 0x42, 0x4A, 0x8B, 0x4D, 0xA3, 0x0E, 0xE6,
+    0x12, 0x3B, 0xC5, 0xAD, 0x81, 0xDA, 0x6E, 0xB2, 0x5E, 0x22, 0x94, 0x52, 0xC4, 0xDB, 0x5C, 0x8E,
+    0x37, 0x44, 0x88, 0x3C, 0xF1, 0x94, 0x11, 0xA2, 0x80, 0x3A, 0xBE, 0x07, 0x9D, 0x9E, 0x87, 0x41,
+    0x1B, 0x1F, 0xF2, 0x7D, 0x8A, 0x70, 0xE7, 0x78, 0x16, 0x54, 0x90, 0x6C, 0x41, 0xC1, 0xD6, 0x68,
+    0xF4, 0x1C, 0x23, 0xD5, 0xBA, 0xFF, 0x31, 0x4E, 0x38, 0x4B, 0x26, 0x8F, 0x28, 0x6B, 0x6D, 0x91,
+    0x31, 0xA4, 0xB6, 0x2D, 0x75, 0x57, 0x07, 0x0D, 0x0C, 0xE2, 0x34, 0x94, 0x34, 0x21, 0x28, 0x91,
+    0x7F, 0x3E, 0xD4, 0xFF, 0x3E, 0xBB, 0xBA, 0xEC, 0x04, 0xF8, 0xFA, 0xB6, 0xCE, 0xE4, 0xA1, 0x53,
+    0xAB, 0xD5, 0xDA, 0x46, 0x27, 0xD9, 0x4A, 0x62, 0x52, 0xD9, 0xB1, 0xA6, 0x3A, 0x6D, 0xAD, 0x76,
+    0x27, 0x31, 0x55, 0x95, 0x73, 0x12, 0xAC, 0x55, 0xDE, 0xDC, 0xE4, 0xDD, 0x4E, 0xBC, 0xC5, 0x25,
+    0x17, 0xB8, 0xD1, 0xA9, 0xDF, 0x72, 0xBB, 0x53, 0xA7, 0xD6, 0x1B, 0xE5, 0xC2, 0xAD, 0xF4, 0x8F,
+    0xC8, 0x84, 0xE9, 0x90, 0x71, 0x4B, 0x2A, 0x56, 0xB6, 0xD3, 0x80, 0xA9, 0x42, 0x21, 0x0F, 0xE6,
+    0x13, 0x98, 0x9F, 0x2A, 0xE0, 0x58, 0x97, 0x7F, 0x1E, 0x7D, 0x4A, 0x37, 0x10, 0x93, 0x2F, 0xB4,
+    0x02, 0xB2, 0x72, 0x94, 0xE7, 0x97, 0x52, 0xAE, 0x8D, 0xF0, 0xA1, 0x55, 0xFC, 0x08, 0xE2, 0xA8,
+    0x1B, 0xBF, 0xC6, 0xD1, 0x55, 0xEF, 0xF9, 0xFF, 0x07, 0x0A, 0x1A, 0xDD, 0x53, 0xFF, 0x2F, 0x00,
+    0x00,
+};
+
+const uint32_t web_ui_gz_len = 3377;
+
+const char web_ui_etag[] = "\"4b33a842244d3bf6\"";
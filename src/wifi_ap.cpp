@@ -1,21 +1,91 @@
 #include "wifi_ap.h"
 #include "subghz_operations.h"
 #include "menu_system.h"
+#include "boot_profiler.h"
+#include "ui_scheduler.h"
+#include "idle_scheduler.h"
+#include "web_ui.h"
+#include "json_response.h"
+#include "span_trace.h"
+#include "metrics.h"
+#include "heap_monitor.h"
+#include "replay_fidelity.h"
 #include <M5StickCPlus.h>
 
+// POST /recordings with a urlencoded body, which is what curl -d and
+// --data-binary send unless told otherwise. The server parses such a body
+// into form params, buffering all of it, if its handler wants the request.
+// This handler is trivial, so the body is skipped unread and only the 415
+// is sent. It must be added ahead of the upload route to be matched first.
+class FormUploadRejecter : public AsyncWebHandler {
+public:
+    bool canHandle(AsyncWebServerRequest* request) override {
+        return request->method() == HTTP_POST && request->url() == "/recordings" &&
+               request->contentType().startsWith("application/x-www-form-urlencoded");
+    }
+    
+    void handleRequest(AsyncWebServerRequest* request) override {
+        JsonResponse* response = new JsonResponse(415);
+        JsonWriter& json = response->json();
+        json.beginObject();
+        json.field("error", "Send recordings as application/octet-stream or text/plain");
+        json.endObject();
+        request->send(response);
+    }
+    
+    bool isRequestHandlerTrivial() override { return true; }
+};
+
 WiFiAP::WiFiAP(SubGhzOperations* ops, MenuSystem* menu) {
     operations = ops;
     menuSystem = menu;
+    uiScheduler = nullptr;
     server = nullptr;
+    lastStreamPush = 0;
+    lastStreamVersion = 0;
+    lastStreamSpectrum = 0;
+    lastStreamRSSISample = 0;
+    spectrumSnapshotLen = 0;
+    spectrumSnapshotVersion = 0;
+    heapSnapshotLen = 0;
+    heapSnapshotSample = 0;
+    nextSweepId = 0;
+    queuedSweepId = 0;
+    memset(&sweepSnapshot, 0, sizeof(sweepSnapshot));
+    sweepSnapshot.state = SWEEP_IDLE;
+    sweepResultLen = 0;
+    sweepResultId = 0;
+    lastStreamMode = -1;
+    lastStreamFreq = 0.0;
+    lastStreamConnects = 0;
+    commandQueue = nullptr;
+    statusMutex = nullptr;
     active = false;
     lastStatusUpdate = 0;
     recordingActive = false;
-    recordedSignalData = "";
+    uploadOwner = nullptr;
+    uploadPending = false;
+    uploadStartMs = 0;
+    uploadLastMs = 0;
+    uploadParseUs = 0;
+    strcpy(statusSnapshot, "{}");
+    statusSnapshotLen = 2;
+    radioSnapshot.frequency = FREQ_433_MHZ;
+    radioSnapshot.modulation = RADIO_MOD_2FSK;
+    radioSnapshot.dataRate = 99.97;
+    radioSnapshot.rxBandwidth = 812.5;
+    modeSnapshot = MODE_IDLE;
 }
 
 void WiFiAP::begin() {
     if (active) return;
     
+    if (commandQueue == nullptr) {
+        commandQueue = xQueueCreate(WEB_COMMAND_QUEUE_LEN, sizeof(WebCommand));
+        statusMutex = xSemaphoreCreateMutex();
+    }
+    stream.begin();
+    
     // Configure Access Point
     WiFi.mode(WIFI_AP);
     WiFi.softAP("roku-hd", "");  // No password for easy access
@@ -24,17 +94,48 @@ void WiFiAP::begin() {
     Serial.print("AP IP address: ");
     Serial.println(IP);
     
-    // Create web server
-    server = new WebServer(80);
+    // Publish an initial status before the first request can arrive
+    refreshStatus();
+    
+    // Create web server (handlers run in the async TCP task)
+    server = new AsyncWebServer(80);
     
     // Register handlers
-    server->on("/", [this]() { handleRoot(); });
-    server->on("/listen", HTTP_POST, [this]() { handleListen(); });
-    server->on("/record", HTTP_POST, [this]() { handleRecord(); });
-    server->on("/replay", HTTP_POST, [this]() { handleReplay(); });
-    server->on("/status", HTTP_GET, [this]() { handleStatus(); });
-    server->on("/stop", HTTP_POST, [this]() { handleStop(); });
-    server->onNotFound([this]() { handleNotFound(); });
+    server->on("/", HTTP_GET, [this](AsyncWebServerRequest* request) { handleRoot(request); });
+    server->on("/listen", HTTP_POST, [this](AsyncWebServerRequest* request) { handleListen(request); });
+    server->on("/record", HTTP_POST, [this](AsyncWebServerRequest* request) { handleRecord(request); });
+    server->on("/replay", HTTP_POST, [this](AsyncWebServerRequest* request) { handleReplay(request); });
+    server->on("/status", HTTP_GET, [this](AsyncWebServerRequest* request) { handleStatus(request); });
+    server->on("/spectrum", HTTP_GET, [this](AsyncWebServerRequest* request) { handleSpectrum(request); });
+    server->on("/recordings", HTTP_GET, [this](AsyncWebServerRequest* request) { handleRecordings(request); });
+    server->addHandler(new FormUploadRejecter());
+    server->on("/recordings", HTTP_POST,
+        [this](AsyncWebServerRequest* request) { handleUploadDone(request); },
+        [this](AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final) {
+            handleUploadData(request, filename, data, len, index);
+        },
+        [this](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+            handleUploadData(request, String(), data, len, index);
+        });
+    server->on("/stop", HTTP_POST, [this](AsyncWebServerRequest* request) { handleStop(request); });
+    server->on("/tune", HTTP_POST, [this](AsyncWebServerRequest* request) { handleTune(request); });
+    server->on("/sweep", HTTP_POST, [this](AsyncWebServerRequest* request) { handleSweepStart(request); });
+    server->on("/sweep", HTTP_GET, [this](AsyncWebServerRequest* request) { handleSweep(request); });
+    server->on("/sweep", HTTP_DELETE, [this](AsyncWebServerRequest* request) { handleSweepCancel(request); });
+    server->on("/trace", HTTP_GET, [this](AsyncWebServerRequest* request) { handleTrace(request); });
+    server->on("/heap", HTTP_GET, [this](AsyncWebServerRequest* request) { handleHeap(request); });
+    server->on("/metrics", HTTP_GET, [this](AsyncWebServerRequest* request) { handleMetrics(request); });
+    
+    // Live stream; the first push after a connect carries the full state
+    server->on("/events", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (stream.getClientCount() >= STREAM_MAX_CLIENTS) {
+            sendError(request, 503, "Too many stream clients");
+            return;
+        }
+        request->send(stream.createResponse());
+    });
+    
+    server->onNotFound([this](AsyncWebServerRequest* request) { handleNotFound(request); });
     
     server->begin();
     active = true;
@@ -45,29 +146,48 @@ void WiFiAP::begin() {
 
 void WiFiAP::update() {
     if (!active || server == nullptr) return;
+    TRACE_SPAN("web", "WiFiAP::update");
     
-    server->handleClient();
+    // Apply commands posted by the web handlers
+    WebCommand command;
+    while (xQueueReceive(commandQueue, &command, 0) == pdTRUE) {
+        applyCommand(command);
+    }
     
-    // Update status display periodically
-    if (millis() - lastStatusUpdate > 1000) {
+    // Publish status for /status periodically
+    if (millis() - lastStatusUpdate > WEB_STATUS_INTERVAL_MS) {
+        refreshStatus();
         lastStatusUpdate = millis();
     }
+    refreshSpectrum();
+    refreshHeap();
+    refreshSweep();
+    
+    pushStream();
+    stream.pump();
 }
 
 void WiFiAP::stop() {
     if (!active) return;
     
     if (server != nullptr) {
-        server->stop();
+        server->end();
         delete server;
         server = nullptr;
     }
+    stream.closeAll();
     
     WiFi.softAPdisconnect(true);
     WiFi.mode(WIFI_OFF);
     active = false;
     recordingActive = false;
     
+    // Commands dropped with the queue never run: release what they reserved
+    xQueueReset(commandQueue);
+    queuedSweepId = sweepSnapshot.id;
+    uploadPending = false;
+    uploadOwner = nullptr;
+    
     Serial.println("WiFi AP stopped");
 }
 
@@ -85,453 +205,1124 @@ int WiFiAP::getClientCount() {
     return WiFi.softAPgetStationNum();
 }
 
-void WiFiAP::handleRoot() {
-    String page = getWebPage();
-    server->send(200, "text/html", page);
+void WiFiAP::setUIScheduler(UIScheduler* scheduler) {
+    uiScheduler = scheduler;
 }
 
-void WiFiAP::handleListen() {
-    if (server->hasArg("frequency")) {
-        float freq = server->arg("frequency").toFloat();
-        
-        // Set frequency based on argument
-        int freqIndex = 1; // Default 433MHz
-        if (freq >= 310 && freq <= 320) freqIndex = 0;
-        else if (freq >= 430 && freq <= 440) freqIndex = 1;
-        else if (freq >= 860 && freq <= 875) freqIndex = 2;
-        else if (freq >= 910 && freq <= 920) freqIndex = 3;
-        
-        // Set mode to listening
-        menuSystem->setMode(MODE_LISTENING);
-        
-        server->send(200, "application/json", "{\"status\":\"listening\",\"frequency\":" + String(freq) + "}");
-    } else {
-        server->send(400, "application/json", "{\"error\":\"Missing frequency parameter\"}");
+bool WiFiAP::postCommand(WebCommandType type, float frequency) {
+    WebCommand command;
+    command.type = type;
+    command.frequency = frequency;
+    return postCommand(command);
+}
+
+bool WiFiAP::postCommand(const WebCommand& command) {
+    return xQueueSend(commandQueue, &command, 0) == pdTRUE;
+}
+
+void WiFiAP::applyCommand(const WebCommand& command) {
+    switch (command.type) {
+        case WEB_CMD_LISTEN:
+            menuSystem->setFrequency(command.frequency);
+            menuSystem->setMode(MODE_LISTENING);
+            break;
+        case WEB_CMD_RECORD:
+            menuSystem->setFrequency(command.frequency);
+            menuSystem->setMode(MODE_RECORDING);
+            recordingActive = true;
+            break;
+        case WEB_CMD_REPLAY:
+            // Recording may have started after the request was accepted
+            if (menuSystem->getMode() != MODE_RECORDING) {
+                menuSystem->setFrequency(command.frequency);
+                menuSystem->setMode(MODE_REPLAYING);
+            }
+            break;
+        case WEB_CMD_STOP:
+            menuSystem->setMode(MODE_IDLE);
+            recordingActive = false;
+            operations->cancelSweep(operations->getSweep().getId());
+            break;
+        case WEB_CMD_LOAD_CAPTURE:
+            if (operations->loadCapture(uploadTimings, uploadParser.getSampleCount())) {
+                Serial.printf("Upload loaded: %d samples\n", uploadParser.getSampleCount());
+            }
+            uploadPending = false;
+            break;
+        case WEB_CMD_TUNE: {
+            RadioConfig actual;
+            RadioConfigError error = operations->tune(command.config, &actual);
+            if (error != RADIO_CONFIG_OK) {
+                Serial.printf("Tune rejected: %s\n", CC1101Interface::getConfigErrorText(error));
+            }
+            break;
+        }
+        case WEB_CMD_SWEEP:
+            if (operations->startSweep(command.sweepId, command.sweep)) {
+                Serial.printf("Sweep %u: %.3f-%.3f MHz, %d points x %d passes\n",
+                              (unsigned)command.sweepId, command.sweep.startMHz, command.sweep.stopMHz,
+                              operations->getSweep().getPointCount(), command.sweep.passes);
+            } else {
+                queuedSweepId = sweepSnapshot.id;  // Never started, so not busy
+            }
+            break;
+        case WEB_CMD_SWEEP_CANCEL:
+            operations->cancelSweep(command.sweepId);
+            break;
     }
+    refreshStatus();
 }
 
-void WiFiAP::handleRecord() {
-    if (server->hasArg("frequency")) {
-        float freq = server->arg("frequency").toFloat();
-        
-        // Set frequency
-        int freqIndex = 1;
-        if (freq >= 310 && freq <= 320) freqIndex = 0;
-        else if (freq >= 430 && freq <= 440) freqIndex = 1;
-        else if (freq >= 860 && freq <= 875) freqIndex = 2;
-        else if (freq >= 910 && freq <= 920) freqIndex = 3;
-        
-        // Start recording
-        menuSystem->setMode(MODE_RECORDING);
-        recordingActive = true;
-        
-        server->send(200, "application/json", "{\"status\":\"recording\",\"frequency\":" + String(freq) + "}");
-    } else {
-        server->send(400, "application/json", "{\"error\":\"Missing frequency parameter\"}");
+static const char* modeLabel(OperationMode mode) {
+    switch (mode) {
+        case MODE_SCANNING: return "Scanning";
+        case MODE_SPECTRUM: return "Spectrum";
+        case MODE_LISTENING: return "Listening";
+        case MODE_RECORDING: return "Recording";
+        case MODE_REPLAYING: return "Replaying";
+        default: return "Idle";
     }
 }
 
-void WiFiAP::handleReplay() {
-    if (menuSystem->getMode() == MODE_RECORDING) {
-        server->send(400, "application/json", "{\"error\":\"Still recording, cannot replay yet\"}");
+static const char* sweepStateLabel(SweepState state) {
+    switch (state) {
+        case SWEEP_RUNNING: return "running";
+        case SWEEP_DONE: return "done";
+        case SWEEP_CANCELLED: return "cancelled";
+        default: return "idle";
+    }
+}
+
+void WiFiAP::pushStream() {
+    if (stream.getClientCount() == 0) return;
+    
+    unsigned long now = millis();
+    if (now - lastStreamPush < 1000 / WEB_STREAM_MAX_HZ) return;
+    
+    // Coalesce: whatever changed since the last push goes out as one update
+    uint32_t connects = stream.getConnectCount();
+    bool resync = (connects != lastStreamConnects);
+    lastStreamConnects = connects;
+    OperationMode mode = menuSystem->getMode();
+    float freq = menuSystem->getSelectedFrequency();
+    uint32_t version = operations->getStateVersion();
+    uint32_t spectrum = operations->getSpectrumVersion();
+    bool stateChanged = resync || version != lastStreamVersion ||
+                        (int)mode != lastStreamMode || freq != lastStreamFreq;
+    bool spectrumChanged = spectrum != lastStreamSpectrum ||
+                           (resync && mode == MODE_SPECTRUM);
+    
+    if (!stateChanged && !spectrumChanged && now - lastStreamPush < WEB_STREAM_KEEPALIVE_MS) {
         return;
     }
     
-    if (server->hasArg("frequency")) {
-        float freq = server->arg("frequency").toFloat();
-        
-        // Set mode to replay
-        menuSystem->setMode(MODE_REPLAYING);
-        
-        server->send(200, "application/json", "{\"status\":\"replaying\",\"frequency\":" + String(freq) + "}");
-    } else {
-        server->send(400, "application/json", "{\"error\":\"Missing frequency parameter\"}");
+    char state[96];
+    JsonWriter json(state, sizeof(state));
+    json.beginObject();
+    json.field("mode", modeLabel(mode));
+    json.field("freq", freq);
+    json.field("rssi", operations->getLatestRSSI());
+    json.field("clients", getClientCount());
+    json.endObject();
+    stream.publish(WEB_STREAM_STATE, "state", now, state);
+    
+    // Sweeps and RSSI samples go out as binary frames
+    uint8_t frame[SPECTRUM_FRAME_SIZE(SPECTRUM_POINTS)];
+    if (spectrumChanged && spectrum > 0) {
+        size_t length = encodeSpectrumFrame(frame, sizeof(frame), SPECTRUM_FRAME_SWEEP,
+                                            operations->getSpectrumStart(),
+                                            operations->getSpectrumStep(), now,
+                                            operations->getSpectrumData(), SPECTRUM_POINTS);
+        stream.publishBinary(WEB_STREAM_SPECTRUM, "spectrum", now, frame, length);
+    }
+    
+    // Every sample taken since the last push, so coalescing loses nothing
+    uint32_t samples = operations->getRSSISampleCount();
+    if (samples != lastStreamRSSISample) {
+        int rssi[RSSI_RING_SIZE];
+        int count = operations->copyRSSISamples(lastStreamRSSISample, rssi, RSSI_RING_SIZE);
+        size_t length = encodeSpectrumFrame(frame, sizeof(frame), SPECTRUM_FRAME_RSSI,
+                                            freq, 0.0, now, rssi, count);
+        stream.publishBinary(WEB_STREAM_RSSI, "rssi", now, frame, length);
+        lastStreamRSSISample = samples;
     }
+    
+    lastStreamVersion = version;
+    lastStreamSpectrum = spectrum;
+    lastStreamMode = mode;
+    lastStreamFreq = freq;
+    lastStreamPush = now;
 }
 
-void WiFiAP::handleStatus() {
-    String status = getCurrentStatus();
-    server->send(200, "application/json", status);
+void WiFiAP::refreshSpectrum() {
+    uint32_t version = operations->getSpectrumVersion();
+    if (version == spectrumSnapshotVersion) return;
+    
+    uint8_t frame[SPECTRUM_FRAME_SIZE(SPECTRUM_POINTS)];
+    size_t length = encodeSpectrumFrame(frame, sizeof(frame), SPECTRUM_FRAME_SWEEP,
+                                        operations->getSpectrumStart(),
+                                        operations->getSpectrumStep(), millis(),
+                                        operations->getSpectrumData(), SPECTRUM_POINTS);
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    memcpy(spectrumSnapshot, frame, length);
+    spectrumSnapshotLen = length;
+    xSemaphoreGive(statusMutex);
+    spectrumSnapshotVersion = version;
 }
 
-void WiFiAP::handleStop() {
-    // Stop current operation
-    menuSystem->setMode(MODE_IDLE);
-    recordingActive = false;
+void WiFiAP::refreshHeap() {
+    uint32_t sample = heapMonitor.getSampleCount();
+    if (sample == heapSnapshotSample) return;
     
-    server->send(200, "application/json", "{\"status\":\"stopped\"}");
+    char buffer[WEB_HEAP_MAX_LEN];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.key("heap");
+    writeHeapSummary(json);
+    json.key("tasks");
+    json.beginArray();
+    for (int i = 0; i < heapMonitor.getTaskCount(); i++) {
+        const TaskStackInfo& task = heapMonitor.getTask(i);
+        json.beginObject();
+        json.field("name", (const char*)task.name);
+        json.field("stack_free", task.highWater);
+        json.field("core", (int)task.core);
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    if (json.overflowed()) return;
+    
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    memcpy(heapSnapshot, buffer, json.length() + 1);
+    heapSnapshotLen = json.length();
+    xSemaphoreGive(statusMutex);
+    heapSnapshotSample = sample;
 }
 
-void WiFiAP::handleNotFound() {
-    server->send(404, "text/plain", "Not found");
+void WiFiAP::refreshSweep() {
+    SweepJob& job = operations->getSweep();
+    SweepState state = job.getState();
+    if (state == SWEEP_IDLE) return;
+    
+    // Finished jobs publish once; the result frame is encoded a single time
+    // however many clients fetch it
+    bool finished = (state == SWEEP_DONE && sweepResultId != job.getId());
+    if (state != SWEEP_RUNNING && !finished &&
+        state == sweepSnapshot.state && job.getId() == sweepSnapshot.id) {
+        return;
+    }
+    
+    SweepStatus status;
+    status.id = job.getId();
+    status.state = state;
+    status.params = job.getParams();
+    status.points = job.getPointCount();
+    status.pass = job.getPass();
+    status.progress = job.getProgressPermille();
+    status.elapsedMs = job.getElapsedMs();
+    
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    sweepSnapshot = status;
+    if (finished) {
+        sweepResultLen = job.encodeResult(sweepResult, sizeof(sweepResult));
+        sweepResultId = status.id;
+    }
+    xSemaphoreGive(statusMutex);
 }
 
-String WiFiAP::getWebPage() {
-    String html = R"=====(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <meta charset="UTF-8">
-    <title>M5 RF Tools - Remote Control</title>
-    <style>
-        * {
-            margin: 0;
-            padding: 0;
-            box-sizing: border-box;
-        }
-        body {
-            font-family: 'Courier New', monospace;
-            background: #0d0d0d;
-            min-height: 100vh;
-            padding: 20px;
-            color: #00ff00;
-        }
-        .container {
-            max-width: 600px;
-            margin: 0 auto;
-            background: #1a1a1a;
-            border: 2px solid #00ff00;
-            border-radius: 5px;
-            padding: 30px;
-            box-shadow: 0 0 20px rgba(0, 255, 0, 0.3);
-        }
-        h1 {
-            text-align: center;
-            margin-bottom: 10px;
-            font-size: 2em;
-            color: #00ff00;
-            text-shadow: 0 0 10px #00ff00;
-        }
-        .subtitle {
-            text-align: center;
-            margin-bottom: 30px;
-            color: #00cc00;
-            font-size: 0.9em;
-        }
-        .status-panel {
-            background: #0d0d0d;
-            border: 1px solid #00ff00;
-            border-radius: 5px;
-            padding: 20px;
-            margin-bottom: 30px;
-        }
-        .status-item {
-            display: flex;
-            justify-content: space-between;
-            margin-bottom: 10px;
-            padding: 8px 0;
-            border-bottom: 1px solid #003300;
-        }
-        .status-item:last-child {
-            border-bottom: none;
-            margin-bottom: 0;
-        }
-        .status-label {
-            color: #00aa00;
-        }
-        .status-value {
-            font-weight: bold;
-            color: #00ff00;
-        }
-        .control-section {
-            margin-bottom: 25px;
-        }
-        .control-section h2 {
-            font-size: 1.2em;
-            margin-bottom: 15px;
-            color: #00ff00;
-        }
-        .frequency-selector {
-            display: grid;
-            grid-template-columns: repeat(2, 1fr);
-            gap: 10px;
-            margin-bottom: 15px;
-        }
-        .freq-btn {
-            padding: 12px;
-            background: #2a2a2a;
-            border: 2px solid #004400;
-            border-radius: 3px;
-            color: #00ff00;
-            font-family: 'Courier New', monospace;
-            font-size: 1em;
-            cursor: pointer;
-            transition: all 0.2s;
-        }
-        .freq-btn:hover {
-            background: #333333;
-            border-color: #00ff00;
-            box-shadow: 0 0 10px rgba(0, 255, 0, 0.3);
-        }
-        .freq-btn.active {
-            background: #003300;
-            border-color: #00ff00;
-            box-shadow: 0 0 15px rgba(0, 255, 0, 0.5);
-        }
-        .action-buttons {
-            display: grid;
-            grid-template-columns: repeat(3, 1fr);
-            gap: 10px;
-        }
-        .action-btn {
-            padding: 15px 10px;
-            background: #2a2a2a;
-            border: 2px solid #00ff00;
-            border-radius: 3px;
-            color: #00ff00;
-            font-family: 'Courier New', monospace;
-            font-size: 0.95em;
-            font-weight: bold;
-            cursor: pointer;
-            transition: all 0.2s;
-        }
-        .action-btn:hover {
-            background: #003300;
-            box-shadow: 0 0 15px rgba(0, 255, 0, 0.4);
-        }
-        .action-btn:active {
-            transform: scale(0.98);
-        }
-        .action-btn.listen {
-            background: #2a2a2a;
-        }
-        .action-btn.record {
-            background: #2a2a2a;
-        }
-        .action-btn.replay {
-            background: #2a2a2a;
-        }
-        .action-btn.stop {
-            background: #1a1a1a;
-            border-color: #ff0000;
-            color: #ff0000;
-            grid-column: span 3;
-        }
-        .action-btn.stop:hover {
-            background: #330000;
-            box-shadow: 0 0 15px rgba(255, 0, 0, 0.4);
-        }
-        .message {
-            margin-top: 20px;
-            padding: 15px;
-            border-radius: 3px;
-            text-align: center;
-            display: none;
-            font-family: 'Courier New', monospace;
-        }
-        .message.success {
-            background: #003300;
-            border: 1px solid #00ff00;
-            color: #00ff00;
+void WiFiAP::refreshStatus() {
+    // Serialize outside the lock, publish with a copy
+    char buffer[WEB_STATUS_MAX_LEN];
+    JsonWriter json(buffer, sizeof(buffer));
+    writeStatus(json);
+    if (json.overflowed()) {
+        Serial.println("WiFi AP status too large, keeping previous snapshot");
+        return;
+    }
+    
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    memcpy(statusSnapshot, buffer, json.length() + 1);
+    statusSnapshotLen = json.length();
+    radioSnapshot = operations->getRadioConfig();
+    modeSnapshot = menuSystem->getMode();
+    xSemaphoreGive(statusMutex);
+}
+
+bool WiFiAP::getArg(AsyncWebServerRequest* request, const char* name, String* value) {
+    // Form body first, then query string
+    AsyncWebParameter* param = nullptr;
+    if (request->hasParam(name, true)) {
+        param = request->getParam(name, true);
+    } else if (request->hasParam(name)) {
+        param = request->getParam(name);
+    }
+    if (param == nullptr) return false;
+    
+    *value = param->value();
+    return true;
+}
+
+bool WiFiAP::getFrequencyArg(AsyncWebServerRequest* request, float* freq) {
+    String value;
+    if (!getArg(request, "frequency", &value)) return false;
+    *freq = value.toFloat();
+    return true;
+}
+
+void WiFiAP::handleRoot(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    // The page is immutable for a given firmware image: a matching ETag
+    // costs a bare 304, anything else streams the gzip blob from flash
+    if (request->hasHeader("If-None-Match") &&
+        strcmp(request->header("If-None-Match").c_str(), web_ui_etag) == 0) {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", web_ui_etag);
+        response->addHeader("Cache-Control", WEB_UI_CACHE_CONTROL);
+        request->send(response);
+        return;
+    }
+    
+    AsyncWebServerResponse* response =
+        request->beginResponse_P(200, "text/html", web_ui_gz, web_ui_gz_len);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", web_ui_etag);
+    response->addHeader("Cache-Control", WEB_UI_CACHE_CONTROL);
+    request->send(response);
+}
+
+void WiFiAP::sendError(AsyncWebServerRequest* request, int code, const char* message) {
+    JsonResponse* response = new JsonResponse(code);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("error", message);
+    json.endObject();
+    request->send(response);
+}
+
+void WiFiAP::sendAccepted(AsyncWebServerRequest* request, const char* status, float freq) {
+    JsonResponse* response = new JsonResponse(200);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("status", status);
+    json.field("frequency", freq);
+    json.endObject();
+    request->send(response);
+}
+
+void WiFiAP::handleListen(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /listen");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    float freq;
+    if (!getFrequencyArg(request, &freq)) {
+        sendError(request, 400, "Missing frequency parameter");
+        return;
+    }
+    if (!CC1101Interface::isInBand(freq)) {
+        sendError(request, 400, CC1101Interface::getConfigErrorText(RADIO_CONFIG_BAD_FREQUENCY));
+        return;
+    }
+    if (!postCommand(WEB_CMD_LISTEN, freq)) {
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    sendAccepted(request, "listening", freq);
+}
+
+void WiFiAP::handleRecord(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /record");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    float freq;
+    if (!getFrequencyArg(request, &freq)) {
+        sendError(request, 400, "Missing frequency parameter");
+        return;
+    }
+    if (!CC1101Interface::isInBand(freq)) {
+        sendError(request, 400, CC1101Interface::getConfigErrorText(RADIO_CONFIG_BAD_FREQUENCY));
+        return;
+    }
+    if (!postCommand(WEB_CMD_RECORD, freq)) {
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    sendAccepted(request, "recording", freq);
+}
+
+void WiFiAP::handleReplay(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /replay");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    // The published mode; applyCommand() checks again when it runs
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    OperationMode mode = modeSnapshot;
+    xSemaphoreGive(statusMutex);
+    if (mode == MODE_RECORDING) {
+        sendError(request, 400, "Still recording, cannot replay yet");
+        return;
+    }
+    
+    float freq;
+    if (!getFrequencyArg(request, &freq)) {
+        sendError(request, 400, "Missing frequency parameter");
+        return;
+    }
+    if (!CC1101Interface::isInBand(freq)) {
+        sendError(request, 400, CC1101Interface::getConfigErrorText(RADIO_CONFIG_BAD_FREQUENCY));
+        return;
+    }
+    if (!postCommand(WEB_CMD_REPLAY, freq)) {
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    sendAccepted(request, "replaying", freq);
+}
+
+void WiFiAP::handleStatus(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /status");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    // Served from the snapshot published by the main loop
+    JsonResponse* response = new JsonResponse(200);
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    response->setBody(statusSnapshot, statusSnapshotLen);
+    xSemaphoreGive(statusMutex);
+    request->send(response);
+}
+
+void WiFiAP::handleSpectrum(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /spectrum");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    uint8_t frame[SPECTRUM_FRAME_SIZE(SPECTRUM_POINTS)];
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    size_t length = spectrumSnapshotLen;
+    memcpy(frame, spectrumSnapshot, length);
+    xSemaphoreGive(statusMutex);
+    
+    if (length == 0) {
+        sendError(request, 404, "No sweep yet");
+        return;
+    }
+    AsyncResponseStream* response = request->beginResponseStream("application/octet-stream");
+    response->write(frame, length);
+    request->send(response);
+}
+
+// GET /recordings lists the capture, GET /recordings/<id> downloads it
+void WiFiAP::handleRecordings(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /recordings");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    const char* url = request->url().c_str();
+    if (strncmp(url, "/recordings/", 12) == 0 && url[12] != '\0') {
+        handleRecordingDownload(request, url + 12);
+        return;
+    }
+    
+    JsonResponse* response = new JsonResponse(200);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.key("recordings");
+    json.beginArray();
+    if (operations->hasCapture()) {
+        int samples = operations->getCaptureSampleCount();
+        json.beginObject();
+        json.field("id", operations->getCaptureId());
+        json.field("samples", samples);
+        json.field("raw_bytes", (unsigned long)recordingEncodedSize(RECORDING_FORMAT_RAW, samples));
+        json.field("text_bytes", (unsigned long)recordingEncodedSize(RECORDING_FORMAT_TEXT, samples));
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    request->send(response);
+}
+
+void WiFiAP::handleRecordingDownload(AsyncWebServerRequest* request, const char* id) {
+    // Only the current capture is kept; "latest" names it without an id
+    uint32_t generation = operations->getCaptureGeneration();
+    if (!operations->hasCapture() ||
+        (strcmp(id, "latest") != 0 && strtoul(id, nullptr, 10) != operations->getCaptureId())) {
+        sendError(request, 404, "No such recording");
+        return;
+    }
+    if (generation & 1) {
+        sendError(request, 503, "Capture in progress, try again");
+        return;
+    }
+    
+    RecordingFormat format = RECORDING_FORMAT_RAW;
+    if (request->hasParam("format")) {
+        const String& name = request->getParam("format")->value();
+        if (name == "text") {
+            format = RECORDING_FORMAT_TEXT;
+        } else if (name != "raw") {
+            sendError(request, 400, "Unknown format (raw, text)");
+            return;
         }
-        .message.error {
-            background: #330000;
-            border: 1px solid #ff0000;
-            color: #ff0000;
+    }
+    
+    size_t total = recordingEncodedSize(format, operations->getCaptureSampleCount());
+    size_t start = 0;
+    size_t end = total;
+    bool ranged = false;
+    // Multi-range and non-byte units are ignored: the full body is sent
+    String rangeHeader = request->hasHeader("Range") ? request->header("Range") : String();
+    if (rangeHeader.startsWith("bytes=") && rangeHeader.indexOf(',') < 0) {
+        if (!parseRange(rangeHeader, total, &start, &end)) {
+            char range[32];
+            snprintf(range, sizeof(range), "bytes */%u", (unsigned)total);
+            AsyncWebServerResponse* response = request->beginResponse(416);
+            response->addHeader("Content-Range", range);
+            request->send(response);
+            return;
         }
-        .footer {
-            text-align: center;
-            margin-top: 30px;
-            color: #006600;
-            font-size: 0.85em;
+        ranged = true;
+    }
+    
+    // Bytes are produced straight from the capture buffer as the socket
+    // drains, so memory use does not depend on the capture length. A new
+    // capture replacing the buffer mid-download drops the connection:
+    // ending the body (a last empty chunk, or short of Content-Length)
+    // would pass for a complete file.
+    SubGhzOperations* ops = operations;
+    AsyncClient* client = request->client();
+    AwsResponseFiller filler = [ops, client, generation, format, start, end](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        size_t offset = start + index;
+        if (offset >= end) return 0;
+        
+        size_t n = 0;
+        if (ops->getCaptureGeneration() == generation) {
+            n = encodeRecordingRange(format, ops->getCaptureTimings(), ops->getCaptureSampleCount(),
+                                     offset, buffer, min(maxLen, end - offset));
         }
-        @media (max-width: 480px) {
-            .container {
-                padding: 20px;
-            }
-            h1 {
-                font-size: 1.5em;
-            }
-            .frequency-selector {
-                grid-template-columns: 1fr;
-            }
+        if (ops->getCaptureGeneration() != generation) {
+            client->abort();
+            return 0;
         }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>Seraph SubGHZ Tool Remote</h1>
-        <div class="subtitle">REMOTE SUBGHZ CONTROL PANEL</div>
-        
-        <div class="status-panel" id="statusPanel">
-            <div class="status-item">
-                <span class="status-label">Mode:</span>
-                <span class="status-value" id="currentMode">Idle</span>
-            </div>
-            <div class="status-item">
-                <span class="status-label">Clients:</span>
-                <span class="status-value" id="clientCount">0</span>
-            </div>
-            <div class="status-item">
-                <span class="status-label">IP:</span>
-                <span class="status-value">192.168.4.1</span>
-            </div>
-        </div>
-        
-        <div class="control-section">
-            <h2>FREQUENCY SELECTION</h2>
-            <div class="frequency-selector">
-                <button class="freq-btn" data-freq="315" onclick="selectFreq(315)">315 MHz</button>
-                <button class="freq-btn active" data-freq="433.92" onclick="selectFreq(433.92)">433.92 MHz</button>
-                <button class="freq-btn" data-freq="868" onclick="selectFreq(868)">868 MHz</button>
-                <button class="freq-btn" data-freq="915" onclick="selectFreq(915)">915 MHz</button>
-            </div>
-        </div>
+        return n;
+    };
+    
+    const char* contentType = (format == RECORDING_FORMAT_TEXT) ? "text/plain" : "application/octet-stream";
+    AsyncWebServerResponse* response;
+    if (ranged) {
+        // Partial content needs an exact length for the client to resume
+        response = request->beginResponse(contentType, end - start, filler);
+        response->setCode(206);
+        char range[48];
+        snprintf(range, sizeof(range), "bytes %u-%u/%u", (unsigned)start, (unsigned)(end - 1), (unsigned)total);
+        response->addHeader("Content-Range", range);
+    } else {
+        response = request->beginChunkedResponse(contentType, filler);
+    }
+    
+    char disposition[64];
+    snprintf(disposition, sizeof(disposition), "attachment; filename=\"recording-%u.%s\"",
+             (unsigned)operations->getCaptureId(), (format == RECORDING_FORMAT_TEXT) ? "txt" : "raw");
+    response->addHeader("Content-Disposition", disposition);
+    response->addHeader("Accept-Ranges", "bytes");
+    request->send(response);
+}
+
+// POST /recordings body chunks (raw body or multipart file part). Format
+// comes from ?format=, else an octet-stream body or .raw file is raw and
+// anything else is text.
+void WiFiAP::handleUploadData(AsyncWebServerRequest* request, const String& filename,
+                              uint8_t* data, size_t len, size_t index) {
+    unsigned long now = millis();
+    
+    if (index == 0) {
+        // Only one upload is staged at a time; an abandoned one times out
+        bool busy = uploadPending ||
+                    (uploadOwner != nullptr && now - uploadLastMs < WEB_UPLOAD_TIMEOUT_MS);
+        if (busy) return;
         
-        <div class="control-section">
-            <h2>ACTIONS</h2>
-            <div class="action-buttons">
-                <button class="action-btn listen" onclick="startListen()">LISTEN</button>
-                <button class="action-btn record" onclick="startRecord()">RECORD</button>
-                <button class="action-btn replay" onclick="startReplay()">REPLAY</button>
-                <button class="action-btn stop" onclick="stopAction()">STOP</button>
-            </div>
-        </div>
+        RecordingFormat format = RECORDING_FORMAT_TEXT;
+        if (request->hasParam("format")) {
+            if (request->getParam("format")->value() == "raw") format = RECORDING_FORMAT_RAW;
+        } else if (request->contentType() == "application/octet-stream" || filename.endsWith(".raw")) {
+            format = RECORDING_FORMAT_RAW;
+        }
         
-        <div id="message" class="message"></div>
+        uploadParser.begin(format, uploadTimings, MAX_RECORDING_SAMPLES);
+        uploadOwner = request;
+        uploadStartMs = now;
+        uploadParseUs = 0;
         
-        <div class="footer">
-            Seraph SubGHz Tool v0.4.0
-        </div>
-    </div>
+        // A dropped upload frees the slot before its request is freed, so
+        // a retry allocated at the same address is not taken for it
+        request->onDisconnect([this, request]() {
+            if (uploadOwner == request) uploadOwner = nullptr;
+        });
+    }
+    if (uploadOwner != request) return;
     
-    <script>
-        let selectedFrequency = 433.92;
-        
-        function selectFreq(freq) {
-            selectedFrequency = freq;
-            document.querySelectorAll('.freq-btn').forEach(btn => {
-                btn.classList.remove('active');
-            });
-            event.target.classList.add('active');
-            showMessage('Frequency set to ' + freq + ' MHz', 'success');
+    unsigned long start = micros();
+    uploadParser.feed(data, len);
+    uploadParseUs += micros() - start;
+    uploadLastMs = now;
+}
+
+void WiFiAP::handleUploadDone(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /recordings");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    if (request->url() != "/recordings") {
+        sendError(request, 404, "Not found");
+        return;
+    }
+    if (uploadOwner != request) {
+        if (uploadPending || uploadOwner != nullptr) {
+            sendError(request, 409, "Another upload is in progress");
+        } else {
+            sendError(request, 400, "No recording data");
         }
-        
-        function showMessage(text, type) {
-            const msgDiv = document.getElementById('message');
-            msgDiv.textContent = text;
-            msgDiv.className = 'message ' + type;
-            msgDiv.style.display = 'block';
-            setTimeout(() => {
-                msgDiv.style.display = 'none';
-            }, 3000);
+        return;
+    }
+    uploadOwner = nullptr;
+    
+    if (!uploadParser.finish()) {
+        JsonResponse* response = new JsonResponse(
+            uploadParser.getError() == RECORDING_PARSE_TOO_MANY ? 413 : 400);
+        JsonWriter& json = response->json();
+        json.beginObject();
+        json.field("error", uploadParser.getErrorText());
+        json.field("offset", (unsigned long)uploadParser.getErrorOffset());
+        json.field("max_samples", MAX_RECORDING_SAMPLES);
+        json.endObject();
+        request->send(response);
+        return;
+    }
+    
+    uploadPending = true;
+    if (!postCommand(WEB_CMD_LOAD_CAPTURE, 0)) {
+        uploadPending = false;
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    
+    // Parse throughput counts only time spent in the parser
+    unsigned long bytes = uploadParser.getBytesParsed();
+    unsigned long parseUs = uploadParseUs > 0 ? uploadParseUs : 1;
+    JsonResponse* response = new JsonResponse(200);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("status", "loaded");
+    json.field("samples", uploadParser.getSampleCount());
+    json.field("bytes", bytes);
+    json.field("elapsed_ms", millis() - uploadStartMs);
+    json.field("parse_us", uploadParseUs);
+    json.field("parse_kb_per_s", (unsigned long)((uint64_t)bytes * 1000000 / parseUs / 1024));
+    json.endObject();
+    request->send(response);
+}
+
+// Only trailing whitespace may follow a range
+static bool rangeEnds(const char* rest) {
+    while (*rest == ' ' || *rest == '\t') rest++;
+    return *rest == '\0';
+}
+
+// Single "bytes=" range; sets [start, end) and returns false if it is
+// malformed or unsatisfiable. Numbers are plain digits: strtoul() would
+// also take signs and leading spaces
+bool WiFiAP::parseRange(const String& header, size_t total, size_t* start, size_t* end) {
+    const char* spec = header.c_str() + 6;
+    
+    char* rest;
+    if (*spec == '-') {
+        // Suffix range: last N bytes
+        if (!isdigit((unsigned char)spec[1])) return false;
+        unsigned long suffix = strtoul(spec + 1, &rest, 10);
+        if (!rangeEnds(rest) || suffix == 0 || total == 0) return false;
+        *start = (suffix >= total) ? 0 : total - suffix;
+        *end = total;
+        return true;
+    }
+    
+    if (!isdigit((unsigned char)*spec)) return false;
+    unsigned long first = strtoul(spec, &rest, 10);
+    if (*rest != '-' || first >= total) return false;
+    const char* last = rest + 1;
+    if (rangeEnds(last)) {
+        *start = first;
+        *end = total;
+        return true;
+    }
+    if (!isdigit((unsigned char)*last)) return false;
+    unsigned long lastByte = strtoul(last, &rest, 10);
+    if (!rangeEnds(rest) || lastByte < first) return false;
+    *start = first;
+    *end = (lastByte + 1 < total) ? lastByte + 1 : total;
+    return true;
+}
+
+void WiFiAP::handleStop(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /stop");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    if (!postCommand(WEB_CMD_STOP, 0)) {
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    JsonResponse* response = new JsonResponse(200);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("status", "stopped");
+    json.endObject();
+    request->send(response);
+}
+
+// POST /tune: frequency (MHz) plus optional modulation (0-4 or name),
+// data_rate (kBaud) and bandwidth (kHz); omitted fields keep their value
+void WiFiAP::handleTune(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /tune");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    WebCommand command;
+    command.type = WEB_CMD_TUNE;
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    command.config = radioSnapshot;
+    xSemaphoreGive(statusMutex);
+    
+    String value;
+    if (getArg(request, "frequency", &value)) command.config.frequency = value.toFloat();
+    if (getArg(request, "data_rate", &value)) command.config.dataRate = value.toFloat();
+    if (getArg(request, "bandwidth", &value)) command.config.rxBandwidth = value.toFloat();
+    if (getArg(request, "modulation", &value)) {
+        value.toLowerCase();
+        if (value == "2fsk" || value == "2-fsk" || value == "fsk") command.config.modulation = RADIO_MOD_2FSK;
+        else if (value == "gfsk") command.config.modulation = RADIO_MOD_GFSK;
+        else if (value == "ask" || value == "ook" || value == "ask/ook") command.config.modulation = RADIO_MOD_ASK;
+        else if (value == "4fsk" || value == "4-fsk") command.config.modulation = RADIO_MOD_4FSK;
+        else if (value == "msk") command.config.modulation = RADIO_MOD_MSK;
+        else if (value.length() == 1 && isdigit(value[0])) command.config.modulation = value.toInt();
+        else command.config.modulation = -1;
+    }
+    
+    // Validate and round here, so the reply echoes exactly what the main
+    // loop will program
+    RadioConfig actual;
+    RadioConfigError error = CC1101Interface::quantizeConfig(command.config, &actual);
+    if (error != RADIO_CONFIG_OK) {
+        sendError(request, 400, CC1101Interface::getConfigErrorText(error));
+        return;
+    }
+    if (!postCommand(command)) {
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    
+    JsonResponse* response = new JsonResponse(200);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("status", "tuned");
+    json.field("frequency", actual.frequency, 4);
+    json.field("modulation", CC1101Interface::getModulationName(actual.modulation));
+    json.field("data_rate", actual.dataRate, 3);
+    json.field("bandwidth", actual.rxBandwidth, 1);
+    json.endObject();
+    request->send(response);
+}
+
+// POST /sweep: start, stop and step (MHz), optional passes (default 1) and
+// aggregate (max or avg, default max). Replies 202 with the job id to poll
+void WiFiAP::handleSweepStart(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "POST /sweep");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    if (request->url() != "/sweep") {
+        sendError(request, 404, "Not found");
+        return;
+    }
+    
+    WebCommand command;
+    command.type = WEB_CMD_SWEEP;
+    command.frequency = 0;
+    SweepParams& params = command.sweep;
+    params.passes = 1;
+    params.aggregate = SWEEP_AGG_MAX;
+    
+    String value;
+    if (!getArg(request, "start", &value)) {
+        sendError(request, 400, "Missing start parameter");
+        return;
+    }
+    params.startMHz = value.toFloat();
+    if (!getArg(request, "stop", &value)) {
+        sendError(request, 400, "Missing stop parameter");
+        return;
+    }
+    params.stopMHz = value.toFloat();
+    if (!getArg(request, "step", &value)) {
+        sendError(request, 400, "Missing step parameter");
+        return;
+    }
+    params.stepMHz = value.toFloat();
+    if (getArg(request, "passes", &value)) params.passes = value.toInt();
+    if (getArg(request, "aggregate", &value)) {
+        if (value == "avg") {
+            params.aggregate = SWEEP_AGG_AVG;
+        } else if (value != "max") {
+            sendError(request, 400, "Unknown aggregate (max, avg)");
+            return;
         }
-        
-        async function startListen() {
-            try {
-                const response = await fetch('/listen', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-                    body: 'frequency=' + selectedFrequency
-                });
-                const data = await response.json();
-                if (response.ok) {
-                    showMessage('Listening on ' + selectedFrequency + ' MHz', 'success');
-                    updateStatus();
-                } else {
-                    showMessage(data.error || 'Failed to start listening', 'error');
-                }
-            } catch (error) {
-                showMessage('Error: ' + error.message, 'error');
-            }
+    }
+    
+    const char* error = SweepJob::validate(params);
+    if (error != nullptr) {
+        sendError(request, 400, error);
+        return;
+    }
+    
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    bool busy = sweepSnapshot.state == SWEEP_RUNNING || queuedSweepId != sweepSnapshot.id;
+    xSemaphoreGive(statusMutex);
+    if (busy) {
+        sendError(request, 409, "A sweep is already running");
+        return;
+    }
+    
+    // Reserved before posting: the main loop may apply (and release) it
+    // before postCommand() returns
+    command.sweepId = ++nextSweepId;
+    uint32_t previous = queuedSweepId;
+    queuedSweepId = command.sweepId;
+    if (!postCommand(command)) {
+        queuedSweepId = previous;
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    
+    char url[32];
+    snprintf(url, sizeof(url), "/sweep/%u", (unsigned)command.sweepId);
+    JsonResponse* response = new JsonResponse(202);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("id", command.sweepId);
+    json.field("state", "queued");
+    json.field("points", SweepJob::pointCount(params));
+    json.field("passes", params.passes);
+    json.field("aggregate", params.aggregate == SWEEP_AGG_AVG ? "avg" : "max");
+    json.field("status_url", url);
+    json.endObject();
+    request->send(response);
+}
+
+void WiFiAP::writeSweepStatus(JsonWriter& json, const SweepStatus& status) {
+    json.beginObject();
+    json.field("id", status.id);
+    json.field("state", sweepStateLabel(status.state));
+    json.field("start", status.params.startMHz, 3);
+    json.field("stop", status.params.stopMHz, 3);
+    json.field("step", status.params.stepMHz, 3);
+    json.field("aggregate", status.params.aggregate == SWEEP_AGG_AVG ? "avg" : "max");
+    json.field("points", status.points);
+    json.field("pass", status.state == SWEEP_DONE ? status.params.passes : status.pass);
+    json.field("passes", status.params.passes);
+    json.field("progress_pm", status.progress);
+    json.field("elapsed_ms", status.elapsedMs);
+    json.endObject();
+}
+
+// GET /sweep (latest job), /sweep/<id> (progress) or /sweep/<id>/result
+// (aggregated bins as one SPECTRUM_FRAME_SWEEP)
+void WiFiAP::handleSweep(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /sweep");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    const char* url = request->url().c_str();
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    SweepStatus status = sweepSnapshot;
+    uint32_t resultId = sweepResultId;
+    xSemaphoreGive(statusMutex);
+    uint32_t queued = queuedSweepId;
+    
+    uint32_t id = queued;
+    bool wantResult = false;
+    if (strncmp(url, "/sweep/", 7) == 0) {
+        char* rest;
+        id = strtoul(url + 7, &rest, 10);
+        if (rest == url + 7 || (*rest != '\0' && strcmp(rest, "/result") != 0)) {
+            sendError(request, 404, "Not found");
+            return;
         }
-        
-        async function startRecord() {
-            try {
-                const response = await fetch('/record', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-                    body: 'frequency=' + selectedFrequency
-                });
-                const data = await response.json();
-                if (response.ok) {
-                    showMessage('Recording on ' + selectedFrequency + ' MHz', 'success');
-                    updateStatus();
-                } else {
-                    showMessage(data.error || 'Failed to start recording', 'error');
-                }
-            } catch (error) {
-                showMessage('Error: ' + error.message, 'error');
-            }
+        wantResult = (*rest != '\0');
+    } else if (strcmp(url, "/sweep") != 0) {
+        sendError(request, 404, "Not found");
+        return;
+    }
+    
+    if (wantResult) {
+        if (id == 0 || id != resultId) {
+            bool pending = (id == status.id && status.state == SWEEP_RUNNING) ||
+                           (id == queued && id != status.id);
+            sendError(request, pending ? 409 : 404, pending ? "Sweep not finished" : "No such sweep result");
+            return;
         }
         
-        async function startReplay() {
-            try {
-                const response = await fetch('/replay', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-                    body: 'frequency=' + selectedFrequency
-                });
-                const data = await response.json();
-                if (response.ok) {
-                    showMessage('Replaying on ' + selectedFrequency + ' MHz', 'success');
-                    updateStatus();
-                } else {
-                    showMessage(data.error || 'Failed to replay', 'error');
-                }
-            } catch (error) {
-                showMessage('Error: ' + error.message, 'error');
+        // Streamed from the published frame; a newer result replacing it
+        // mid-response ends the body early
+        WiFiAP* ap = this;
+        AwsResponseFiller filler = [ap, id](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            xSemaphoreTake(ap->statusMutex, portMAX_DELAY);
+            size_t n = 0;
+            if (ap->sweepResultId == id && index < ap->sweepResultLen) {
+                n = min(maxLen, ap->sweepResultLen - index);
+                memcpy(buffer, ap->sweepResult + index, n);
             }
-        }
-        
-        async function stopAction() {
-            try {
-                const response = await fetch('/stop', {
-                    method: 'POST'
-                });
-                const data = await response.json();
-                if (response.ok) {
-                    showMessage('Operation stopped', 'success');
-                    updateStatus();
-                } else {
-                    showMessage('Failed to stop operation', 'error');
-                }
-            } catch (error) {
-                showMessage('Error: ' + error.message, 'error');
+            xSemaphoreGive(ap->statusMutex);
+            return n;
+        };
+        xSemaphoreTake(statusMutex, portMAX_DELAY);
+        size_t length = sweepResultLen;
+        xSemaphoreGive(statusMutex);
+        AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", length, filler);
+        request->send(response);
+        return;
+    }
+    
+    if (id != 0 && id == queued && id != status.id) {
+        // Accepted, not yet picked up by the main loop
+        JsonResponse* response = new JsonResponse(200);
+        JsonWriter& json = response->json();
+        json.beginObject();
+        json.field("id", id);
+        json.field("state", "queued");
+        json.field("progress_pm", 0);
+        json.endObject();
+        request->send(response);
+        return;
+    }
+    if (id == 0 || id != status.id) {
+        sendError(request, 404, "No such sweep");
+        return;
+    }
+    JsonResponse* response = new JsonResponse(200);
+    writeSweepStatus(response->json(), status);
+    request->send(response);
+}
+
+// DELETE /sweep/<id> stops the job; bins gathered so far are discarded
+void WiFiAP::handleSweepCancel(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "DELETE /sweep");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    const char* url = request->url().c_str();
+    if (strncmp(url, "/sweep/", 7) != 0) {
+        sendError(request, 404, "Not found");
+        return;
+    }
+    uint32_t id = strtoul(url + 7, nullptr, 10);
+    
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    bool running = (id == sweepSnapshot.id && sweepSnapshot.state == SWEEP_RUNNING);
+    xSemaphoreGive(statusMutex);
+    if (id == 0 || (!running && id != queuedSweepId)) {
+        sendError(request, 404, "No such sweep");
+        return;
+    }
+    
+    WebCommand command;
+    command.type = WEB_CMD_SWEEP_CANCEL;
+    command.frequency = 0;
+    command.sweepId = id;
+    if (!postCommand(command)) {
+        sendError(request, 503, "Busy, try again");
+        return;
+    }
+    JsonResponse* response = new JsonResponse(200);
+    JsonWriter& json = response->json();
+    json.beginObject();
+    json.field("id", id);
+    json.field("status", "cancelled");
+    json.endObject();
+    request->send(response);
+}
+
+void WiFiAP::handleHeap(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /heap");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    bool sampled = heapSnapshotLen > 0;
+    xSemaphoreGive(statusMutex);
+    if (!sampled) {
+        sendError(request, 404, "No heap sample yet");
+        return;
+    }
+    
+    // Served from the snapshot published by the main loop
+    JsonResponse* response = new JsonResponse(200);
+    xSemaphoreTake(statusMutex, portMAX_DELAY);
+    response->setBody(heapSnapshot, heapSnapshotLen);
+    xSemaphoreGive(statusMutex);
+    request->send(response);
+}
+
+// Span ring as Chrome trace JSON; recording pauses until the download ends
+void WiFiAP::handleTrace(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /trace");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    uint32_t id = spanTrace.beginDump();
+    if (id == 0) {
+        sendError(request, 409, "Trace dump in progress");
+        return;
+    }
+    // A dump that stalled past TRACE_DUMP_TIMEOUT_MS may be taken over;
+    // its connection is dropped rather than ended as if complete
+    AsyncClient* client = request->client();
+    request->onDisconnect([id]() { spanTrace.endDump(id); });
+    AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+        [client, id](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            if (!spanTrace.ownsDump(id)) {
+                client->abort();
+                return 0;
             }
-        }
-        
-        async function updateStatus() {
-            try {
-                const response = await fetch('/status');
-                const data = await response.json();
-                if (response.ok) {
-                    document.getElementById('currentMode').textContent = data.mode || 'Idle';
-                    document.getElementById('clientCount').textContent = data.clients || '0';
-                }
-            } catch (error) {
-                console.error('Failed to update status:', error);
+            return spanTrace.readDump(id, buffer, maxLen);
+        });
+    response->addHeader("Content-Disposition", "attachment; filename=\"trace.json\"");
+    request->send(response);
+}
+
+// Prometheus text exposition, formatted from a snapshot as it is sent
+void WiFiAP::handleMetrics(AsyncWebServerRequest* request) {
+    TRACE_SPAN("web", "GET /metrics");
+    METRIC_TIME(METRIC_HTTP_HANDLER);
+    uint32_t id = metrics.beginScrape();
+    if (id == 0) {
+        sendError(request, 503, "Scrape in progress");
+        return;
+    }
+    // As with /trace: a scrape taken over after it stalled is dropped
+    AsyncClient* client = request->client();
+    request->onDisconnect([id]() { metrics.endScrape(id); });
+    request->send(request->beginChunkedResponse("text/plain; version=0.0.4",
+        [client, id](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            if (!metrics.ownsScrape(id)) {
+                client->abort();
+                return 0;
             }
-        }
-        
-        // Update status every 2 seconds
-        setInterval(updateStatus, 2000);
-        updateStatus();
-    </script>
-</body>
-</html>
-)=====";
-    return html;
-}
-
-String WiFiAP::getCurrentStatus() {
-    String mode = "idle";
-    switch (menuSystem->getMode()) {
-        case MODE_IDLE: mode = "Idle"; break;
-        case MODE_SCANNING: mode = "Scanning"; break;
-        case MODE_SPECTRUM: mode = "Spectrum"; break;
-        case MODE_LISTENING: mode = "Listening"; break;
-        case MODE_RECORDING: mode = "Recording"; break;
-        case MODE_REPLAYING: mode = "Replaying"; break;
-    }
-    
-    String json = "{";
-    json += "\"mode\":\"" + mode + "\",";
-    json += "\"clients\":" + String(getClientCount()) + ",";
-    json += "\"ip\":\"" + getIPAddress() + "\",";
-    json += "\"frequency\":" + String(menuSystem->getSelectedFrequency());
-    json += "}";
-    
-    return json;
+            return metrics.readScrape(id, buffer, maxLen);
+        }));
+}
+
+void WiFiAP::handleNotFound(AsyncWebServerRequest* request) {
+    sendError(request, 404, "Not found");
+}
+
+// Warn flags use the thresholds in heap_monitor.h
+void WiFiAP::writeHeapSummary(JsonWriter& json) {
+    json.beginObject();
+    json.field("free", heapMonitor.getFreeHeap());
+    json.field("largest_block", heapMonitor.getLargestBlock());
+    json.field("min_free", heapMonitor.getMinFreeHeap());
+    json.field("fragmentation_pct", heapMonitor.getFragmentation());
+    json.field("fragmented", heapMonitor.isFragmented());
+    json.field("stack_low", heapMonitor.isStackLow());
+    json.endObject();
+}
+
+void WiFiAP::writeStatus(JsonWriter& json) {
+    char ip[16];
+    IPAddress addr = WiFi.softAPIP();
+    snprintf(ip, sizeof(ip), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+    
+    json.beginObject();
+    json.field("mode", modeLabel(menuSystem->getMode()));
+    json.field("clients", getClientCount());
+    json.field("ip", active ? ip : "N/A");
+    json.field("frequency", menuSystem->getSelectedFrequency());
+    json.field("boot_ms", bootProfiler.getBootTime());
+    
+    const RadioConfig& radio = operations->getRadioConfig();
+    json.key("radio");
+    json.beginObject();
+    json.field("frequency", radio.frequency, 4);
+    json.field("modulation", CC1101Interface::getModulationName(radio.modulation));
+    json.field("data_rate", radio.dataRate, 3);
+    json.field("bandwidth", radio.rxBandwidth, 1);
+    json.endObject();
+    
+    SweepJob& sweep = operations->getSweep();
+    if (sweep.getState() != SWEEP_IDLE) {
+        json.key("sweep");
+        json.beginObject();
+        json.field("id", sweep.getId());
+        json.field("state", sweepStateLabel(sweep.getState()));
+        json.field("progress_pm", sweep.getProgressPermille());
+        json.endObject();
+    }
+    
+    json.key("stream");
+    json.beginObject();
+    json.field("clients", stream.getClientCount());
+    json.field("max_hz", WEB_STREAM_MAX_HZ);
+    json.field("published", stream.getPublishedCount());
+    // Per client: frames sent, frames skipped for falling behind, bytes
+    // of the current frame still waiting for TCP window
+    StreamClientStats lag[STREAM_MAX_CLIENTS];
+    int lagCount = stream.getClientStats(lag, STREAM_MAX_CLIENTS);
+    json.key("lag");
+    json.beginArray();
+    for (int i = 0; i < lagCount; i++) {
+        json.beginObject();
+        json.field("sent", lag[i].sent);
+        json.field("dropped", lag[i].dropped);
+        json.field("pending_bytes", lag[i].pendingBytes);
+        json.field("connected_ms", lag[i].connectedMs);
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    
+    if (uiScheduler != nullptr) {
+        json.key("ui");
+        json.beginObject();
+        json.field("fps", uiScheduler->getTargetFps());
+        json.field("frames", uiScheduler->getFrameCount());
+        json.field("skipped", uiScheduler->getSkippedFrames());
+        json.field("overruns", uiScheduler->getOverruns());
+        json.field("frame_us", uiScheduler->getLastFrameTime());
+        json.field("avg_frame_us", uiScheduler->getAverageFrameTime());
+        json.field("max_frame_us", uiScheduler->getMaxFrameTime());
+        json.endObject();
+    }
+    
+    // Last replay's timing error vs. its source (REPLAY_VERIFY builds)
+    if (replayFidelity.hasResult()) {
+        const FidelityStats& fidelity = replayFidelity.getOverall();
+        json.key("replay_fidelity");
+        json.beginObject();
+        json.field("backend", replayFidelity.getBackend());
+        json.field("pulses", fidelity.count);
+        json.field("missing", replayFidelity.getMissingEdges());
+        json.field("mean_err_us", fidelity.meanErrUs, 1);
+        json.field("jitter_us", fidelity.jitterUs, 1);
+        json.field("max_err_us", fidelity.maxAbsErrUs);
+        json.field("p99_us", fidelity.p99Us);
+        json.endObject();
+    }
+    
+    // Heap summary; GET /heap has every task's stack
+    json.key("heap");
+    writeHeapSummary(json);
+    
+    json.key("trace");
+    json.beginObject();
+    json.field("enabled", spanTrace.isEnabled());
+    json.field("spans", spanTrace.getSpanCount());
+    json.field("cycles_per_span", spanTrace.getCyclesPerSpan());
+    json.field("overhead_pct", spanTrace.getOverheadPercent(), 3);
+    json.endObject();
+    
+    // Per-mode duty cycle (permille of time in each mode)
+    json.key("power");
+    json.beginObject();
+    json.field("light_sleep", idleScheduler.isEnabled());
+    json.field("wakeups", idleScheduler.getWakeCount());
+    json.key("duty");
+    json.beginArray();
+    for (int i = 0; i < IDLE_MODE_COUNT; i++) {
+        json.beginObject();
+        json.field("mode", idleScheduler.getModeName(i));
+        json.field("ms", idleScheduler.getTotalTime(i));
+        json.field("active_pm", idleScheduler.getActivePermille(i));
+        json.field("sleep_pm", idleScheduler.getSleepPermille(i));
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    
+    json.endObject();
 }
@@ -3,12 +3,70 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include "cc1101_interface.h"
+#include "subghz_operations.h"
+#include "spectrum_frame.h"
+#include "json_writer.h"
+#include "recording_format.h"
+#include "sweep_job.h"
+#include "stream_broadcast.h"
 
 // Forward declarations
-class SubGhzOperations;
-class MenuSystem;
+class UIScheduler;
+
+#define WEB_COMMAND_QUEUE_LEN  8
+#define WEB_STATUS_INTERVAL_MS 500
+#define WEB_STATUS_MAX_LEN     1536  // Fits a JsonResponse body
+#define WEB_HEAP_MAX_LEN       1280  // /heap with HEAP_MAX_TASKS tasks
+#define WEB_UPLOAD_TIMEOUT_MS  10000 // Idle upload that a new one may take over
+
+// Live stream on /events (Server-Sent Events). Updates are coalesced to at
+// most WEB_STREAM_MAX_HZ; an unchanged state is still re-sent as a keepalive
+#define WEB_STREAM_MAX_HZ       10
+#define WEB_STREAM_KEEPALIVE_MS 2000
+
+// Broadcast channels on /events; each keeps only its newest frame
+enum WebStreamChannel {
+    WEB_STREAM_STATE,
+    WEB_STREAM_SPECTRUM,
+    WEB_STREAM_RSSI
+};
+
+// The page URL never changes across firmware updates, so browsers may keep
+// it for a day but must revalidate afterwards; the ETag makes that a 304
+#define WEB_UI_CACHE_CONTROL   "public, max-age=86400, must-revalidate"
+
+// Requests accepted by the web handlers, applied by the main loop
+enum WebCommandType {
+    WEB_CMD_LISTEN,
+    WEB_CMD_RECORD,
+    WEB_CMD_REPLAY,
+    WEB_CMD_STOP,
+    WEB_CMD_LOAD_CAPTURE, // Install the parsed upload as the capture
+    WEB_CMD_TUNE,
+    WEB_CMD_SWEEP,
+    WEB_CMD_SWEEP_CANCEL
+};
+
+struct WebCommand {
+    WebCommandType type;
+    float frequency;
+    RadioConfig config;  // WEB_CMD_TUNE only
+    SweepParams sweep;   // WEB_CMD_SWEEP only
+    uint32_t sweepId;    // WEB_CMD_SWEEP and WEB_CMD_SWEEP_CANCEL
+};
+
+// Sweep job progress as last published by the main loop
+struct SweepStatus {
+    uint32_t id;
+    SweepState state;
+    SweepParams params;
+    int points;
+    int pass;
+    int progress;  // Permille
+    unsigned long elapsedMs;
+};
 
 class WiFiAP {
 public:
@@ -19,30 +77,111 @@ public:
     bool isActive();
     String getIPAddress();
     int getClientCount();
+    void setUIScheduler(UIScheduler* scheduler);
     
 private:
+    friend class HostProbe;  // host/ tests drive the handlers directly
+    
     SubGhzOperations* operations;
     MenuSystem* menuSystem;
-    WebServer* server;
+    UIScheduler* uiScheduler;
+    AsyncWebServer* server;
     bool active;
     unsigned long lastStatusUpdate;
     
+    // Handlers run in the async TCP task and never touch the radio or
+    // display directly: they post commands for update() to apply
+    QueueHandle_t commandQueue;
+    bool postCommand(WebCommandType type, float frequency);
+    bool postCommand(const WebCommand& command);
+    void applyCommand(const WebCommand& command);
+    
+    // Status published by the main loop for /status
+    SemaphoreHandle_t statusMutex;
+    char statusSnapshot[WEB_STATUS_MAX_LEN];
+    size_t statusSnapshotLen;
+    RadioConfig radioSnapshot;  // Current tuning, for /tune defaults
+    OperationMode modeSnapshot;  // For handlers that depend on the mode
+    void refreshStatus();
+    
+    // Latest sweep as a binary frame for /spectrum, guarded by statusMutex
+    uint8_t spectrumSnapshot[SPECTRUM_FRAME_SIZE(SPECTRUM_POINTS)];
+    size_t spectrumSnapshotLen;
+    uint32_t spectrumSnapshotVersion;
+    void refreshSpectrum();
+    
+    // Heap figures and per-task stacks for /heap, guarded by statusMutex
+    char heapSnapshot[WEB_HEAP_MAX_LEN];
+    size_t heapSnapshotLen;
+    uint32_t heapSnapshotSample;
+    void refreshHeap();
+    
+    // Sweep jobs: ids are handed out by the POST handler, the job runs on
+    // the main loop and its status and finished result are published here
+    // (guarded by statusMutex)
+    uint32_t nextSweepId;             // Async TCP task only
+    volatile uint32_t queuedSweepId;  // Last posted, maybe not started yet
+    SweepStatus sweepSnapshot;
+    uint8_t sweepResult[SPECTRUM_FRAME_SIZE(SWEEP_MAX_POINTS)];
+    size_t sweepResultLen;
+    uint32_t sweepResultId;
+    void refreshSweep();
+    
+    // Live stream, published from the main loop
+    StreamBroadcaster stream;
+    uint32_t lastStreamConnects;
+    unsigned long lastStreamPush;
+    uint32_t lastStreamVersion;
+    uint32_t lastStreamSpectrum;
+    uint32_t lastStreamRSSISample;
+    int lastStreamMode;
+    float lastStreamFreq;
+    void pushStream();
+    
     // Recording state
     bool recordingActive;
-    String recordedSignalData;
+    
+    // Upload staging: one upload at a time, parsed as the body arrives
+    // (async TCP task) and installed by the main loop
+    RecordingParser uploadParser;
+    int uploadTimings[MAX_RECORDING_SAMPLES];
+    AsyncWebServerRequest* uploadOwner;  // Cleared when its connection closes
+    volatile bool uploadPending;
+    unsigned long uploadStartMs;
+    unsigned long uploadLastMs;
+    unsigned long uploadParseUs;
+    void handleUploadData(AsyncWebServerRequest* request, const String& filename,
+                          uint8_t* data, size_t len, size_t index);
+    void handleUploadDone(AsyncWebServerRequest* request);
     
     // Web handlers
-    void handleRoot();
-    void handleListen();
-    void handleRecord();
-    void handleReplay();
-    void handleStatus();
-    void handleStop();
-    void handleNotFound();
+    void handleRoot(AsyncWebServerRequest* request);
+    void handleListen(AsyncWebServerRequest* request);
+    void handleRecord(AsyncWebServerRequest* request);
+    void handleReplay(AsyncWebServerRequest* request);
+    void handleStatus(AsyncWebServerRequest* request);
+    void handleSpectrum(AsyncWebServerRequest* request);
+    void handleRecordings(AsyncWebServerRequest* request);
+    void handleRecordingDownload(AsyncWebServerRequest* request, const char* id);
+    void handleStop(AsyncWebServerRequest* request);
+    void handleTune(AsyncWebServerRequest* request);
+    void handleSweepStart(AsyncWebServerRequest* request);
+    void handleSweep(AsyncWebServerRequest* request);
+    void handleSweepCancel(AsyncWebServerRequest* request);
+    void handleHeap(AsyncWebServerRequest* request);
+    void handleTrace(AsyncWebServerRequest* request);
+    void handleMetrics(AsyncWebServerRequest* request);
+    void handleNotFound(AsyncWebServerRequest* request);
     
     // Helper functions
-    String getWebPage();
-    String getCurrentStatus();
+    bool getFrequencyArg(AsyncWebServerRequest* request, float* freq);
+    bool getArg(AsyncWebServerRequest* request, const char* name, String* value);
+    static bool parseRange(const String& header, size_t total, size_t* start, size_t* end);
+    void writeStatus(JsonWriter& json);
+    void writeHeapSummary(JsonWriter& json);
+    void sendError(AsyncWebServerRequest* request, int code, const char* message);
+    void sendAccepted(AsyncWebServerRequest* request, const char* status, float freq);
+    void writeSweepStatus(JsonWriter& json, const SweepStatus& status);
 };
 
 #endif
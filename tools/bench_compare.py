@@ -0,0 +1,60 @@
+"""
+Benchmark comparison
+
+Diffs two JSON result files written by the host benchmark executable
+(build-host/subghz_bench --benchmark_out=<file>) and flags benchmarks whose
+time per iteration grew by more than the threshold:
+
+    python3 tools/bench_compare.py before.json after.json [--threshold 10]
+
+Exits with status 1 when any benchmark regressed, so it can gate a script.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {b["name"]: b for b in data.get("benchmarks", [])}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("before")
+    parser.add_argument("after")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="percent slowdown counted as a regression (default 10)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time")
+    args = parser.parse_args()
+
+    before = load(args.before)
+    after = load(args.after)
+
+    regressions = 0
+    print("%-40s %14s %14s %9s" % ("Benchmark", "Before (ns)", "After (ns)", "Change"))
+    for name, new in after.items():
+        old = before.get(name)
+        if old is None:
+            print("%-40s %14s %14.0f %9s" % (name, "-", new[args.metric], "new"))
+            continue
+        change = (new[args.metric] - old[args.metric]) * 100.0 / old[args.metric]
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print("%-40s %14.0f %14.0f %+8.1f%%%s" % (name, old[args.metric], new[args.metric], change, flag))
+    for name in before:
+        if name not in after:
+            print("%-40s %14.0f %14s %9s" % (name, before[name][args.metric], "-", "removed"))
+
+    if regressions:
+        print("%d benchmark(s) slower by more than %.0f%%" % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
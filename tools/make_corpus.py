@@ -0,0 +1,164 @@
+"""
+Golden corpus generator
+
+Writes the RSSI/edge traces in host/corpus/ that the host simulator
+(build-host/subghz_sim) plays through SubGhzOperations. The traces are
+checked in; rerun this only to add or change a case, then refresh the
+expected results with `subghz_sim --update`:
+
+    python3 tools/make_corpus.py
+
+Trace format, one directive per line (# starts a comment):
+
+    freq <MHz>                    carrier frequency; RSSI elsewhere is the floor
+    rssi <t_us> <dBm>             RSSI from t onward, until the next rssi line
+    burst <t_us> <d0> <d1> ...    GDO0 high for d0 us, low for d1, ... from t
+
+Overlapping bursts are OR-ed together, as a receiver sees two transmitters.
+"""
+
+import os
+import random
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CORPUS_DIR = os.path.join(PROJECT_DIR, "host", "corpus")
+
+FLOOR_DBM = -98
+
+
+def pwm_code(bits, value, short_us, long_us, sync_low_us):
+    """Fixed-code PWM remote: sync pulse, then MSB-first bits (1 = long high)."""
+    durations = [short_us, sync_low_us]
+    for i in range(bits - 1, -1, -1):
+        if (value >> i) & 1:
+            durations += [long_us, short_us]
+        else:
+            durations += [short_us, long_us]
+    return durations
+
+
+def repeat(durations, count, gap_us):
+    out = []
+    for n in range(count):
+        out += durations
+        if n < count - 1:
+            out[-1] += gap_us
+    return out
+
+
+class Trace:
+    def __init__(self, name, description, freq):
+        self.name = name
+        self.description = description
+        self.freq = freq
+        self.levels = []
+        self.bursts = []
+
+    def level(self, start_us, end_us, dbm):
+        self.levels.append((start_us, end_us, dbm))
+
+    def rssi_steps(self):
+        """Strongest level at each breakpoint, as (t, dBm) steps."""
+        points = sorted({0} | {s for s, _, _ in self.levels} | {e for _, e, _ in self.levels})
+        steps = []
+        for t in points:
+            dbm = max([d for s, e, d in self.levels if s <= t < e] + [FLOOR_DBM])
+            if not steps or steps[-1][1] != dbm:
+                steps.append((t, dbm))
+        return steps
+
+    def burst(self, start_us, durations, dbm=-45):
+        self.bursts.append((start_us, durations))
+        # Carrier up slightly before the first edge and after the last
+        self.level(start_us - 1000, start_us + sum(durations) + 1000, dbm)
+
+    def write(self):
+        path = os.path.join(CORPUS_DIR, self.name + ".trace")
+        with open(path, "w") as f:
+            f.write("# %s\n" % self.description)
+            f.write("# Generated by tools/make_corpus.py\n")
+            f.write("freq %.2f\n" % self.freq)
+            for t, dbm in self.rssi_steps():
+                f.write("rssi %d %d\n" % (t, dbm))
+            for start, durations in self.bursts:
+                f.write("burst %d %s\n" % (start, " ".join(str(d) for d in durations)))
+        return path
+
+
+def clean_ook():
+    t = Trace("clean_ook_433", "Clean 24-bit PWM remote, 3 repeats", 433.92)
+    t.burst(200000, repeat(pwm_code(24, 0xA5C3F0, 350, 1050, 10850), 3, 0))
+    return t
+
+
+def long_capture():
+    t = Trace("long_capture_315", "12 repeats of a 24-bit code, more edges than the capture buffer", 315.00)
+    t.burst(150000, repeat(pwm_code(24, 0x5AA55A, 320, 960, 9920), 12, 0))
+    return t
+
+
+def two_transmissions():
+    t = Trace("two_transmissions_433", "Two separate presses 400 ms apart", 433.92)
+    code = repeat(pwm_code(24, 0x123456, 400, 1200, 12400), 3, 0)
+    t.burst(100000, code)
+    t.burst(100000 + sum(code) + 400000, code)
+    return t
+
+
+def weak_signal():
+    t = Trace("weak_signal_433", "Burst below the -70 dBm detection threshold", 433.92)
+    t.burst(200000, repeat(pwm_code(24, 0xA5C3F0, 350, 1050, 10850), 3, 0), dbm=-76)
+    return t
+
+
+def short_burst():
+    t = Trace("short_burst_433", "Burst with too few edges to count as a capture", 433.92)
+    t.burst(200000, [500, 500, 500, 500, 500, 500, 500, 500])
+    return t
+
+
+def noisy_rssi():
+    t = Trace("noisy_rssi_868", "Burst whose RSSI flutters across the detection threshold", 868.35)
+    rng = random.Random(868)
+    code = repeat(pwm_code(24, 0x0F0F0F, 300, 900, 9300), 4, 0)
+    start = 150000
+    t.bursts.append((start, code))
+    end = start + sum(code)
+    for step in range(start - 1000, end + 1000, 5000):
+        t.level(step, min(step + 5000, end + 1000), -70 + rng.randint(-6, 6))
+    return t
+
+
+def glitches():
+    t = Trace("glitches_433", "Clean code with short noise spikes in the gaps", 433.92)
+    rng = random.Random(433)
+    code = repeat(pwm_code(24, 0xC0FFEE, 350, 1050, 10850), 2, 0)
+    start = 200000
+    t.burst(start, code)
+    # Spikes land in the long lows, so they add edges without merging pulses
+    at = start
+    for i, d in enumerate(code):
+        if i % 2 == 1 and d >= 1000 and rng.random() < 0.3:
+            t.bursts.append((at + d // 2, [rng.randint(40, 120)]))
+        at += d
+    return t
+
+
+def overlapping():
+    t = Trace("overlapping_433", "Two remotes with different timing transmitting at once", 433.92)
+    a = repeat(pwm_code(24, 0xAAAAAA, 350, 1050, 10850), 2, 0)
+    b = repeat(pwm_code(12, 0x5A5, 600, 1800, 18600), 2, 0)
+    t.burst(200000, a)
+    t.burst(215000, b, dbm=-55)
+    return t
+
+
+def main():
+    os.makedirs(CORPUS_DIR, exist_ok=True)
+    for make in (clean_ook, long_capture, two_transmissions, weak_signal, short_burst,
+                 noisy_rssi, glitches, overlapping):
+        print("wrote", os.path.relpath(make().write(), PROJECT_DIR))
+
+
+if __name__ == "__main__":
+    main()
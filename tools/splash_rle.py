@@ -0,0 +1,122 @@
+"""
+Splash image converter
+
+Converts the 24-bit RGB orca image exported by lcd-image-converter
+(assets/orca_m5.c) into RLE-compressed RGB565 (src/orca_m5_rle.c).
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand:
+
+    python3 tools/splash_rle.py
+
+Stream format (uint16_t tokens):
+- bit 15 set:   repeat run, low 15 bits = count, next word = color
+- bit 15 clear: literal run, low 15 bits = count, next <count> words = colors
+"""
+
+import os
+import re
+import sys
+
+WIDTH = 240
+HEIGHT = 135
+MAX_RUN = 0x7FFF
+MIN_REPEAT = 3  # Shorter repeats are cheaper inside a literal run
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "assets", "orca_m5.c")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "orca_m5_rle.c")
+
+
+def read_rgb24(path):
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index("= {"):]
+    data = [int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", body)]
+    if len(data) != WIDTH * HEIGHT * 3:
+        sys.exit("splash_rle: expected %d bytes in %s, found %d"
+                 % (WIDTH * HEIGHT * 3, path, len(data)))
+    return data
+
+
+def to_rgb565(data):
+    return [((data[i] & 0xF8) << 8) | ((data[i + 1] & 0xFC) << 3) | (data[i + 2] >> 3)
+            for i in range(0, len(data), 3)]
+
+
+def repeat_length(pixels, i):
+    j = i
+    while j < len(pixels) and pixels[j] == pixels[i] and j - i < MAX_RUN:
+        j += 1
+    return j - i
+
+
+def encode(pixels):
+    out = []
+    i = 0
+    while i < len(pixels):
+        run = repeat_length(pixels, i)
+        if run >= MIN_REPEAT:
+            out += [0x8000 | run, pixels[i]]
+            i += run
+            continue
+
+        # Literal run: extend until the next worthwhile repeat starts
+        j = i
+        while j < len(pixels) and j - i < MAX_RUN and repeat_length(pixels, j) < MIN_REPEAT:
+            j += 1
+        out += [j - i] + pixels[i:j]
+        i = j
+    return out
+
+
+def decode(tokens):
+    pixels = []
+    i = 0
+    while i < len(tokens):
+        count = tokens[i] & MAX_RUN
+        if tokens[i] & 0x8000:
+            pixels += [tokens[i + 1]] * count
+            i += 2
+        else:
+            pixels += tokens[i + 1:i + 1 + count]
+            i += 1 + count
+    return pixels
+
+
+def write_output(path, tokens):
+    lines = []
+    for i in range(0, len(tokens), 12):
+        lines.append("    " + ", ".join("0x%04X" % t for t in tokens[i:i + 12]) + ",")
+
+    with open(path, "w") as f:
+        f.write("// Generated by tools/splash_rle.py from assets/orca_m5.c - do not edit\n")
+        f.write("// %dx%d RGB565, RLE compressed (%d bytes)\n\n" % (WIDTH, HEIGHT, len(tokens) * 2))
+        f.write("#include \"orca_m5.h\"\n\n")
+        f.write("const uint16_t image_data_orca_m5_rle[%d] = {\n" % len(tokens))
+        f.write("\n".join(lines))
+        f.write("\n};\n\n")
+        f.write("const uint32_t image_data_orca_m5_rle_len = %d;\n" % len(tokens))
+
+
+def main():
+    if os.path.exists(OUTPUT) and os.path.getmtime(OUTPUT) >= os.path.getmtime(SOURCE):
+        return
+
+    pixels = to_rgb565(read_rgb24(SOURCE))
+    tokens = encode(pixels)
+    if decode(tokens) != pixels:
+        sys.exit("splash_rle: round-trip check failed")
+
+    write_output(OUTPUT, tokens)
+    print("splash_rle: %s -> %s (%d -> %d bytes)"
+          % (os.path.relpath(SOURCE, PROJECT_DIR), os.path.relpath(OUTPUT, PROJECT_DIR),
+             WIDTH * HEIGHT * 3, len(tokens) * 2))
+
+
+main()
@@ -0,0 +1,86 @@
+"""
+Web UI packer
+
+Minifies web/index.html, gzips it and writes the result as a flash-resident
+byte array (src/web_ui_gz.c) together with a strong ETag derived from the
+compressed bytes.
+
+Runs as a PlatformIO pre-build script (see extra_scripts in platformio.ini)
+and can also be run by hand:
+
+    python3 tools/web_ui_gz.py
+
+Minification is deliberately conservative: it only drops indentation, blank
+lines and whole-line // and /* */ comments, so inline scripts and styles are
+never rewritten.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "web", "index.html")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "web_ui_gz.c")
+
+BLOCK_COMMENT = re.compile(r"^/\*.*\*/$")
+
+
+def minify(text):
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//") or BLOCK_COMMENT.match(line):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def compress(data):
+    # mtime=0 keeps the output (and so the ETag) reproducible between builds
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def write_output(path, blob, etag, raw_len):
+    lines = []
+    for i in range(0, len(blob), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+
+    with open(path, "w") as f:
+        f.write("// Generated by tools/web_ui_gz.py from web/index.html - do not edit\n")
+        f.write("// %d bytes minified, %d bytes gzipped\n\n" % (raw_len, len(blob)))
+        f.write("#include \"web_ui.h\"\n\n")
+        f.write("const uint8_t web_ui_gz[%d] PROGMEM = {\n" % len(blob))
+        f.write("\n".join(lines))
+        f.write("\n};\n\n")
+        f.write("const uint32_t web_ui_gz_len = %d;\n\n" % len(blob))
+        f.write("const char web_ui_etag[] = \"\\\"%s\\\"\";\n" % etag)
+
+
+def main():
+    if os.path.exists(OUTPUT) and os.path.getmtime(OUTPUT) >= os.path.getmtime(SOURCE):
+        return
+
+    with open(SOURCE, encoding="utf-8") as f:
+        text = f.read()
+
+    raw = minify(text).encode("utf-8")
+    blob = compress(raw)
+    if gzip.decompress(blob) != raw:
+        sys.exit("web_ui_gz: round-trip check failed")
+
+    etag = hashlib.sha1(blob).hexdigest()[:16]
+    write_output(OUTPUT, blob, etag, len(raw))
+    print("web_ui_gz: %s -> %s (%d -> %d bytes, etag %s)"
+          % (os.path.relpath(SOURCE, PROJECT_DIR), os.path.relpath(OUTPUT, PROJECT_DIR),
+             len(text.encode("utf-8")), len(blob), etag))
+
+
+main()